@@ -0,0 +1,975 @@
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Windows.h>
+
+#include "SyntheticUniverse.h"
+
+#include "Unreal/ObjectArray.h"
+#include "Unreal/UnrealTypes.h"
+#include "OffsetFinder/Offsets.h"
+#include "Utils.h"
+#include "Stats/DumpStats.h"
+
+
+/* Layout of all fabricated objects, matches a UE5 game using FProperty and non-case-preserving FNames. Off::Init() has to find the same offsets */
+namespace SyntheticLayout
+{
+	constexpr int32 FNameSize = 0x08;
+
+	constexpr int32 FUObjectItemSize = 0x18;
+	constexpr int32 NumElementsPerChunk = 0x10000;
+
+	constexpr int32 ProcessEventIndex = 0x4C;
+	constexpr int32 NumVTableEntries = 0x80;
+
+	namespace UObject
+	{
+		constexpr int32 Vft = 0x00;
+		constexpr int32 Flags = 0x08;
+		constexpr int32 Index = 0x0C;
+		constexpr int32 Class = 0x10;
+		constexpr int32 Name = 0x18;
+		constexpr int32 Outer = 0x20;
+
+		constexpr int32 SizeOf = 0x28;
+	}
+
+	namespace UField
+	{
+		constexpr int32 Next = 0x28;
+
+		constexpr int32 SizeOf = 0x30;
+	}
+
+	namespace UEnum
+	{
+		constexpr int32 Names = 0x40;
+
+		constexpr int32 SizeOf = 0x60;
+	}
+
+	namespace UStruct
+	{
+		constexpr int32 SuperStruct = 0x40;
+		constexpr int32 Children = 0x48;
+		constexpr int32 ChildProperties = 0x50;
+		constexpr int32 Size = 0x58;
+		constexpr int32 MinAlignment = 0x5C;
+
+		constexpr int32 SizeOf = 0xB0;
+	}
+
+	namespace UScriptStruct
+	{
+		constexpr int32 SizeOf = 0xC0;
+	}
+
+	namespace UFunction
+	{
+		constexpr int32 FunctionFlags = 0xB0;
+		constexpr int32 ExecFunction = 0xD8;
+
+		constexpr int32 SizeOf = 0xE0;
+	}
+
+	namespace UClass
+	{
+		constexpr int32 CastFlags = 0xD0;
+		constexpr int32 ClassDefaultObject = 0x110;
+		constexpr int32 ImplementedInterfaces = 0x1D8;
+
+		constexpr int32 SizeOf = 0x200;
+	}
+
+	namespace ULevel
+	{
+		constexpr int32 Actors = 0x98;
+
+		constexpr int32 SizeOf = 0xB0;
+	}
+
+	namespace UDataTable
+	{
+		constexpr int32 RowMap = 0x30;
+
+		constexpr int32 SizeOf = 0x80;
+	}
+
+	namespace FFieldClass
+	{
+		constexpr int32 Name = 0x00;
+		constexpr int32 Id = 0x08;
+		constexpr int32 CastFlags = 0x10;
+		constexpr int32 ClassFlags = 0x18;
+		constexpr int32 SuperClass = 0x20;
+
+		constexpr int32 SizeOf = 0x28;
+	}
+
+	namespace FField
+	{
+		constexpr int32 Vft = 0x00;
+		constexpr int32 Class = 0x08;
+		constexpr int32 Owner = 0x10; // FFieldVariant, bool 'bIsUObject' at Owner + 0x8
+		constexpr int32 Next = 0x20;
+		constexpr int32 Name = 0x28;
+		constexpr int32 Flags = 0x30;
+	}
+
+	namespace FProperty
+	{
+		constexpr int32 ArrayDim = 0x38;
+		constexpr int32 ElementSize = 0x3C;
+		constexpr int32 PropertyFlags = 0x40;
+		constexpr int32 Offset_Internal = 0x4C;
+
+		/* Start of the members of FProperty subclasses */
+		constexpr int32 SizeOf = 0x78;
+
+		/* Largest subclass, FMapProperty/FEnumProperty store two pointers */
+		constexpr int32 AllocationSize = SizeOf + 0x10;
+	}
+
+	namespace FText
+	{
+		constexpr int32 TextData = 0x00;
+		constexpr int32 InTextDataString = 0x28;
+
+		constexpr int32 SizeOf = 0x18;
+	}
+}
+
+enum class ESyntheticPropertyType : uint8
+{
+	Int,
+	Float,
+	Double,
+	Bool,
+	Byte,
+	Name,
+	Str,
+	Object,
+	Struct,
+	Array,
+	Map,
+	Enum,
+
+	Num
+};
+
+struct SyntheticPropertyTypeInfo
+{
+	const char* ClassName;
+	const char* MemberPrefix;
+	EClassCastFlags CastFlags;
+
+	/* Size and alignment of StructProperties are taken from the underlying struct */
+	int32 Size;
+	int32 Alignment;
+};
+
+static const SyntheticPropertyTypeInfo PropertyTypeInfos[] =
+{
+	{ "IntProperty",    "Count",    EClassCastFlags::IntProperty | EClassCastFlags::NumericProperty,    0x04, 0x4 },
+	{ "FloatProperty",  "Scale",    EClassCastFlags::FloatProperty | EClassCastFlags::NumericProperty,  0x04, 0x4 },
+	{ "DoubleProperty", "Distance", EClassCastFlags::DoubleProperty | EClassCastFlags::NumericProperty, 0x08, 0x8 },
+	{ "BoolProperty",   "bEnabled", EClassCastFlags::BoolProperty,                                      0x01, 0x1 },
+	{ "ByteProperty",   "Mode",     EClassCastFlags::ByteProperty | EClassCastFlags::NumericProperty,   0x01, 0x1 },
+	{ "NameProperty",   "Id",       EClassCastFlags::NameProperty,                                      0x08, 0x4 },
+	{ "StrProperty",    "Label",    EClassCastFlags::StrProperty,                                       0x10, 0x8 },
+	{ "ObjectProperty", "Target",   EClassCastFlags::ObjectProperty | EClassCastFlags::ObjectPropertyBase, 0x08, 0x8 },
+	{ "StructProperty", "Data",     EClassCastFlags::StructProperty,                                    0x00, 0x0 },
+	{ "ArrayProperty",  "Items",    EClassCastFlags::ArrayProperty,                                     0x10, 0x8 },
+	{ "MapProperty",    "Lookup",   EClassCastFlags::MapProperty,                                       0x50, 0x8 },
+	{ "EnumProperty",   "State",    EClassCastFlags::EnumProperty,                                      0x01, 0x1 },
+};
+
+static_assert(std::size(PropertyTypeInfos) == static_cast<size_t>(ESyntheticPropertyType::Num), "Every ESyntheticPropertyType requires a SyntheticPropertyTypeInfo!");
+
+/* Types of generated members, duplicates make a type more common */
+static constexpr ESyntheticPropertyType MemberTypeDistribution[] =
+{
+	ESyntheticPropertyType::Int,    ESyntheticPropertyType::Int,    ESyntheticPropertyType::Float,  ESyntheticPropertyType::Float,
+	ESyntheticPropertyType::Double, ESyntheticPropertyType::Bool,   ESyntheticPropertyType::Bool,   ESyntheticPropertyType::Byte,
+	ESyntheticPropertyType::Name,   ESyntheticPropertyType::Str,    ESyntheticPropertyType::Object, ESyntheticPropertyType::Object,
+	ESyntheticPropertyType::Struct, ESyntheticPropertyType::Struct, ESyntheticPropertyType::Array,  ESyntheticPropertyType::Map,
+	ESyntheticPropertyType::Enum,
+};
+
+/* Layout of UC::FString and UC::TArray, their members aren't accessible from outside */
+struct FSyntheticArray
+{
+	void* Data;
+	int32 NumElements;
+	int32 MaxElements;
+};
+
+struct FSyntheticEnumName
+{
+	int32 ComparisonIndex;
+	int32 Number;
+	int64 Value;
+};
+
+struct FSyntheticChunkedObjectArray
+{
+	uint8** Objects;
+	uint8* PreAllocatedObjects;
+	int32 MaxElements;
+	int32 NumElements;
+	int32 MaxChunks;
+	int32 NumChunks;
+};
+
+/* State of a struct, or class, while its members are added */
+struct SyntheticStructBuilder
+{
+	uint8* Object;
+
+	int32 CurrentOffset;
+	int32 Alignment;
+
+	uint8* LastProperty = nullptr;
+	uint8* LastChild = nullptr;
+};
+
+
+/* All of these have to be stored inside of this module, they're found through their offset from the image-base or by scanning .data */
+static FSyntheticChunkedObjectArray GSyntheticObjects;
+static void* GSyntheticVTable[SyntheticLayout::NumVTableEntries];
+static void* volatile GSyntheticWorld = nullptr;
+static void* volatile GSyntheticEngine = nullptr;
+
+static std::vector<std::unique_ptr<uint8[]>> Allocations;
+static std::vector<uint8*> Objects;
+
+static std::vector<std::wstring> Names;
+static std::unordered_map<std::wstring, int32> NameLookup;
+
+static uint8* PropertyClasses[static_cast<size_t>(ESyntheticPropertyType::Num)];
+
+static uint8* ClassClass = nullptr;
+static uint8* ScriptStructClass = nullptr;
+static uint8* FunctionClass = nullptr;
+static uint8* EnumClass = nullptr;
+static uint8* PackageClass = nullptr;
+
+
+static void SyntheticVirtualFunction()
+{
+}
+
+static void SyntheticExecFunction(void* Context, void* Stack, void* Result)
+{
+}
+
+/* Replacement for FName::AppendString, appends the name to the content of 'Out' like the engine does */
+static void SyntheticAppendString(const void* Name, FString& Out)
+{
+	const int32 ComparisonIndex = static_cast<const int32*>(Name)[0];
+	const int32 Number = static_cast<const int32*>(Name)[1];
+
+	FSyntheticArray& String = reinterpret_cast<FSyntheticArray&>(Out);
+	wchar_t* Data = static_cast<wchar_t*>(String.Data);
+
+	auto Append = [&](const std::wstring& Str) -> void
+	{
+		/* Overwrite the null-terminator of the previous content */
+		const int32 Start = String.NumElements > 0 ? String.NumElements - 1 : 0;
+		const int32 NumToCopy = std::min(static_cast<int32>(Str.size()), String.MaxElements - Start - 1);
+
+		if (NumToCopy < 0)
+			return;
+
+		memcpy(Data + Start, Str.data(), NumToCopy * sizeof(wchar_t));
+		Data[Start + NumToCopy] = L'\0';
+
+		String.NumElements = Start + NumToCopy + 1;
+	};
+
+	Append(Names[ComparisonIndex]);
+
+	if (Number > 0)
+		Append(L'_' + std::to_wstring(Number - 1));
+}
+
+template<typename T>
+static inline void Write(uint8* Base, int32 Offset, T Value)
+{
+	memcpy(Base + Offset, &Value, sizeof(T));
+}
+
+template<typename T>
+static inline T Read(const uint8* Base, int32 Offset)
+{
+	T Value;
+	memcpy(&Value, Base + Offset, sizeof(T));
+
+	return Value;
+}
+
+static uint8* Allocate(int32 Size)
+{
+	/* Zero-initialized */
+	Allocations.push_back(std::make_unique<uint8[]>(Size));
+
+	return Allocations.back().get();
+}
+
+static int32 AddName(const std::string& Name)
+{
+	std::wstring WideName(Name.begin(), Name.end());
+
+	auto [It, bWasInserted] = NameLookup.emplace(std::move(WideName), static_cast<int32>(Names.size()));
+
+	if (bWasInserted)
+		Names.push_back(It->first);
+
+	return It->second;
+}
+
+static void WriteName(uint8* Address, const std::string& Name)
+{
+	Write<int32>(Address, 0x0, AddName(Name));
+	Write<int32>(Address, 0x4, 0);
+}
+
+/* Public | Standalone | Transient (0x43), the flags of most native objects. Off::Init() finds UObject::Flags by how common this value is */
+static constexpr EObjectFlags NativeObjectFlags = EObjectFlags::Public | EObjectFlags::Standalone | EObjectFlags::Transient;
+
+static uint8* CreateObject(int32 Size, uint8* Class, const std::string& Name, uint8* Outer, EObjectFlags Flags = NativeObjectFlags)
+{
+	using namespace SyntheticLayout;
+
+	uint8* Object = Allocate(Size);
+
+	Write<void*>(Object, UObject::Vft, GSyntheticVTable);
+	Write<EObjectFlags>(Object, UObject::Flags, Flags);
+	Write<int32>(Object, UObject::Index, static_cast<int32>(Objects.size()));
+	Write<uint8*>(Object, UObject::Class, Class);
+	WriteName(Object + UObject::Name, Name);
+	Write<uint8*>(Object, UObject::Outer, Outer);
+
+	Objects.push_back(Object);
+
+	return Object;
+}
+
+static uint8* CreateFieldClass(const std::string& Name, EClassCastFlags CastFlags)
+{
+	using namespace SyntheticLayout;
+
+	uint8* FieldClass = Allocate(FFieldClass::SizeOf);
+
+	WriteName(FieldClass + FFieldClass::Name, Name);
+	Write<EClassCastFlags>(FieldClass, FFieldClass::Id, CastFlags); // EFieldClassID uses the bits of the type-specific cast-flag
+	Write<EClassCastFlags>(FieldClass, FFieldClass::CastFlags, CastFlags | EClassCastFlags::Property | EClassCastFlags::Field);
+
+	return FieldClass;
+}
+
+static uint8* CreateProperty(ESyntheticPropertyType Type, const std::string& Name, uint8* Owner, bool bIsOwnerUObject, int32 Size, int32 Offset, EPropertyFlags Flags)
+{
+	using namespace SyntheticLayout;
+
+	uint8* Property = Allocate(FProperty::AllocationSize);
+
+	Write<void*>(Property, FField::Vft, GSyntheticVTable);
+	Write<uint8*>(Property, FField::Class, PropertyClasses[static_cast<size_t>(Type)]);
+	Write<uint8*>(Property, FField::Owner, Owner);
+	Write<bool>(Property, FField::Owner + 0x8, bIsOwnerUObject);
+	WriteName(Property + FField::Name, Name);
+	Write<EObjectFlags>(Property, FField::Flags, EObjectFlags::Public | EObjectFlags::MarkAsNative); // Mustn't be 0x1, FField::Flags is right before FProperty::ArrayDim
+
+	Write<int32>(Property, FProperty::ArrayDim, 0x1);
+	Write<int32>(Property, FProperty::ElementSize, Size);
+	Write<EPropertyFlags>(Property, FProperty::PropertyFlags, Flags);
+	Write<int32>(Property, FProperty::Offset_Internal, Offset);
+
+	return Property;
+}
+
+static uint8* CreateInnerProperty(ESyntheticPropertyType Type, const std::string& Name, uint8* OwnerProperty, uint8* Referenced = nullptr)
+{
+	const SyntheticPropertyTypeInfo& Info = PropertyTypeInfos[static_cast<size_t>(Type)];
+
+	uint8* Property = CreateProperty(Type, Name, OwnerProperty, false, Info.Size, 0x0, EPropertyFlags::None);
+
+	if (Type == ESyntheticPropertyType::Object)
+		Write<uint8*>(Property, SyntheticLayout::FProperty::SizeOf, Referenced);
+
+	return Property;
+}
+
+static SyntheticStructBuilder BeginStruct(uint8* Struct, uint8* Super)
+{
+	using namespace SyntheticLayout;
+
+	Write<uint8*>(Struct, UStruct::SuperStruct, Super);
+
+	if (!Super)
+		return SyntheticStructBuilder{ Struct, 0x0, 0x1 };
+
+	return SyntheticStructBuilder{ Struct, Read<int32>(Super, UStruct::Size), Read<int32>(Super, UStruct::MinAlignment) };
+}
+
+static void FinishStruct(SyntheticStructBuilder& Builder)
+{
+	using namespace SyntheticLayout;
+
+	/* Empty structs still have a size of 1 */
+	const int32 Size = Builder.CurrentOffset > 0 ? Align(Builder.CurrentOffset, Builder.Alignment) : 0x1;
+
+	Write<int32>(Builder.Object, UStruct::Size, Size);
+	Write<int32>(Builder.Object, UStruct::MinAlignment, Builder.Alignment);
+}
+
+/* Appends a member to 'Builder' at the next correctly aligned offset. 'Referenced' is the enum, class or struct used by the member, or the class of the elements of an array */
+static uint8* AddMember(SyntheticStructBuilder& Builder, ESyntheticPropertyType Type, const std::string& Name, EPropertyFlags Flags, uint8* Referenced = nullptr)
+{
+	using namespace SyntheticLayout;
+
+	const SyntheticPropertyTypeInfo& Info = PropertyTypeInfos[static_cast<size_t>(Type)];
+
+	int32 Size = Info.Size;
+	int32 Alignment = Info.Alignment;
+
+	if (Type == ESyntheticPropertyType::Struct)
+	{
+		Size = Read<int32>(Referenced, UStruct::Size);
+		Alignment = Read<int32>(Referenced, UStruct::MinAlignment);
+	}
+
+	const int32 Offset = Align(Builder.CurrentOffset, Alignment);
+
+	uint8* Property = CreateProperty(Type, Name, Builder.Object, true, Size, Offset, Flags);
+
+	switch (Type)
+	{
+	case ESyntheticPropertyType::Bool:
+		Write<Off::BoolProperty::UBoolPropertyBase>(Property, FProperty::SizeOf, { 0x1, 0x0, 0x1, 0xFF }); // native bool
+		break;
+	case ESyntheticPropertyType::Byte:
+	case ESyntheticPropertyType::Object:
+	case ESyntheticPropertyType::Struct:
+		Write<uint8*>(Property, FProperty::SizeOf, Referenced);
+		break;
+	case ESyntheticPropertyType::Array:
+		Write<uint8*>(Property, FProperty::SizeOf, Referenced ? CreateInnerProperty(ESyntheticPropertyType::Object, Name, Property, Referenced) : CreateInnerProperty(ESyntheticPropertyType::Int, Name, Property));
+		break;
+	case ESyntheticPropertyType::Map:
+		Write<uint8*>(Property, FProperty::SizeOf + 0x0, CreateInnerProperty(ESyntheticPropertyType::Name, Name + "_Key", Property));
+		Write<uint8*>(Property, FProperty::SizeOf + 0x8, CreateInnerProperty(ESyntheticPropertyType::Int, Name + "_Value", Property));
+		break;
+	case ESyntheticPropertyType::Enum:
+		Write<uint8*>(Property, FProperty::SizeOf + 0x0, CreateInnerProperty(ESyntheticPropertyType::Byte, "UnderlyingType", Property));
+		Write<uint8*>(Property, FProperty::SizeOf + 0x8, Referenced);
+		break;
+	default:
+		break;
+	}
+
+	if (Builder.LastProperty)
+	{
+		Write<uint8*>(Builder.LastProperty, FField::Next, Property);
+	}
+	else
+	{
+		Write<uint8*>(Builder.Object, UStruct::ChildProperties, Property);
+	}
+
+	Builder.LastProperty = Property;
+	Builder.CurrentOffset = Offset + Size;
+	Builder.Alignment = std::max(Builder.Alignment, Alignment);
+
+	return Property;
+}
+
+/* Turns a bool created by AddMember() into a single bit of a bitfield */
+static void MakeBitfieldMember(uint8* Property, uint8 Mask)
+{
+	Write<Off::BoolProperty::UBoolPropertyBase>(Property, SyntheticLayout::FProperty::SizeOf, { 0x1, 0x0, Mask, Mask });
+}
+
+static SyntheticStructBuilder BeginClass(uint8* Package, const std::string& Name, uint8* Super, EClassCastFlags CastFlags = EClassCastFlags::None)
+{
+	using namespace SyntheticLayout;
+
+	uint8* Class = CreateObject(UClass::SizeOf, ClassClass, Name, Package);
+
+	Write<EClassCastFlags>(Class, UClass::CastFlags, CastFlags | (Super ? Read<EClassCastFlags>(Super, UClass::CastFlags) : EClassCastFlags::None));
+
+	return BeginStruct(Class, Super);
+}
+
+/* 'MinSize' accounts for native members which aren't reflected */
+static uint8* FinishClass(SyntheticStructBuilder& Builder, int32 MinSize)
+{
+	Builder.CurrentOffset = std::max(Builder.CurrentOffset, MinSize);
+	Builder.Alignment = std::max(Builder.Alignment, 0x8);
+	FinishStruct(Builder);
+
+	return Builder.Object;
+}
+
+static uint8* CreateClass(uint8* Package, const std::string& Name, uint8* Super, int32 Size, EClassCastFlags CastFlags = EClassCastFlags::None)
+{
+	SyntheticStructBuilder Builder = BeginClass(Package, Name, Super, CastFlags);
+
+	return FinishClass(Builder, Size);
+}
+
+static void CreateDefaultObject(uint8* Class)
+{
+	using namespace SyntheticLayout;
+
+	const int32 Size = std::max(Read<int32>(Class, UStruct::Size), UObject::SizeOf);
+	const std::wstring& ClassName = Names[Read<int32>(Class, UObject::Name)];
+	const std::string Name = "Default__" + std::string(ClassName.begin(), ClassName.end());
+
+	uint8* DefaultObject = CreateObject(Size, Class, Name, Read<uint8*>(Class, UObject::Outer), EObjectFlags::Public | EObjectFlags::ClassDefaultObject);
+
+	Write<uint8*>(Class, UClass::ClassDefaultObject, DefaultObject);
+}
+
+static uint8* CreateScriptStruct(uint8* Package, const std::string& Name)
+{
+	return CreateObject(SyntheticLayout::UScriptStruct::SizeOf, ScriptStructClass, Name, Package);
+}
+
+static void AddFunction(SyntheticStructBuilder& ClassBuilder, const std::string& Name, uint8* ParamClass, EFunctionFlags Flags = EFunctionFlags::Native | EFunctionFlags::Public | EFunctionFlags::BlueprintCallable)
+{
+	using namespace SyntheticLayout;
+
+	uint8* Function = CreateObject(UFunction::SizeOf, FunctionClass, Name, ClassBuilder.Object);
+
+	Write<EFunctionFlags>(Function, UFunction::FunctionFlags, Flags);
+	Write<void*>(Function, UFunction::ExecFunction, reinterpret_cast<void*>(&SyntheticExecFunction));
+
+	SyntheticStructBuilder Params = BeginStruct(Function, nullptr);
+	AddMember(Params, ESyntheticPropertyType::Int, "Value", EPropertyFlags::Parm);
+	AddMember(Params, ESyntheticPropertyType::Object, "Target", EPropertyFlags::Parm, ParamClass);
+	AddMember(Params, ESyntheticPropertyType::Bool, "ReturnValue", EPropertyFlags::Parm | EPropertyFlags::OutParm | EPropertyFlags::ReturnParm);
+	FinishStruct(Params);
+
+	if (ClassBuilder.LastChild)
+	{
+		Write<uint8*>(ClassBuilder.LastChild, UField::Next, Function);
+	}
+	else
+	{
+		Write<uint8*>(ClassBuilder.Object, UStruct::Children, Function);
+	}
+
+	ClassBuilder.LastChild = Function;
+}
+
+static uint8* CreateEnum(uint8* Package, const std::string& Name, int32 NumValues)
+{
+	using namespace SyntheticLayout;
+
+	uint8* Enum = CreateObject(UEnum::SizeOf, EnumClass, Name, Package);
+
+	/* All values, followed by the implicit '_MAX' value */
+	const int32 NumNames = NumValues + 1;
+	FSyntheticEnumName* EnumNames = reinterpret_cast<FSyntheticEnumName*>(Allocate(NumNames * sizeof(FSyntheticEnumName)));
+
+	for (int32 i = 0; i < NumValues; i++)
+		EnumNames[i] = { AddName(std::format("{}::Value{}", Name, i)), 0, i };
+
+	EnumNames[NumValues] = { AddName(std::format("{}::{}_MAX", Name, Name)), 0, NumValues };
+
+	Write<FSyntheticArray>(Enum, UEnum::Names, { EnumNames, NumNames, NumNames });
+
+	return Enum;
+}
+
+
+void SyntheticUniverse::Build(const SyntheticUniverseConfig& Config)
+{
+	using namespace SyntheticLayout;
+
+	std::mt19937 Random(Config.Seed);
+
+	auto RandomIndex = [&Random](size_t Count) -> size_t
+	{
+		return std::uniform_int_distribution<size_t>(0, Count - 1)(Random);
+	};
+
+	for (void*& Entry : GSyntheticVTable)
+		Entry = reinterpret_cast<void*>(&SyntheticVirtualFunction);
+
+	/* Index 0 is always the name 'None' */
+	AddName("None");
+
+	for (size_t i = 0; i < static_cast<size_t>(ESyntheticPropertyType::Num); i++)
+		PropertyClasses[i] = CreateFieldClass(PropertyTypeInfos[i].ClassName, PropertyTypeInfos[i].CastFlags);
+
+	/* Bootstrap /Script/CoreUObject, the classes 'Class' and 'Package' don't exist yet when the first objects are created */
+	uint8* CoreUObject = CreateObject(UObject::SizeOf, nullptr, "/Script/CoreUObject", nullptr);
+
+	uint8* ObjectClass = CreateClass(CoreUObject, "Object", nullptr, UObject::SizeOf);
+	uint8* FieldClass = CreateClass(CoreUObject, "Field", ObjectClass, UField::SizeOf, EClassCastFlags::Field);
+	uint8* StructClass = CreateClass(CoreUObject, "Struct", FieldClass, UStruct::SizeOf, EClassCastFlags::Struct);
+	ScriptStructClass = CreateClass(CoreUObject, "ScriptStruct", StructClass, UScriptStruct::SizeOf, EClassCastFlags::ScriptStruct);
+	ClassClass = CreateClass(CoreUObject, "Class", StructClass, UClass::SizeOf, EClassCastFlags::Class);
+	FunctionClass = CreateClass(CoreUObject, "Function", StructClass, UFunction::SizeOf, EClassCastFlags::Function);
+	EnumClass = CreateClass(CoreUObject, "Enum", FieldClass, UEnum::SizeOf, EClassCastFlags::Enum);
+	PackageClass = CreateClass(CoreUObject, "Package", ObjectClass, UObject::SizeOf, EClassCastFlags::Package);
+	uint8* InterfaceClass = CreateClass(CoreUObject, "Interface", ObjectClass, UObject::SizeOf);
+
+	Write<uint8*>(CoreUObject, UObject::Class, PackageClass);
+
+	for (uint8* Object : Objects)
+	{
+		if (!Read<uint8*>(Object, UObject::Class))
+			Write<uint8*>(Object, UObject::Class, ClassClass);
+	}
+
+	std::vector<uint8*> AllClasses = { ObjectClass, FieldClass, StructClass, ScriptStructClass, ClassClass, FunctionClass, EnumClass, PackageClass, InterfaceClass };
+
+	using MemberList = std::initializer_list<std::pair<ESyntheticPropertyType, const char*>>;
+
+	auto CreateCoreStruct = [&](uint8* Package, const std::string& Name, MemberList Members, EPropertyFlags Flags = EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible, int32 MinAlignment = 0x1) -> uint8*
+	{
+		SyntheticStructBuilder Builder = BeginStruct(CreateScriptStruct(Package, Name), nullptr);
+
+		for (const auto& [Type, MemberName] : Members)
+			AddMember(Builder, Type, MemberName, Flags);
+
+		Builder.Alignment = std::max(Builder.Alignment, MinAlignment);
+		FinishStruct(Builder);
+
+		return Builder.Object;
+	};
+
+	/*
+	* Everything below, up to the synthetic packages, is looked up by name in Off::Init(). The values the OffsetFinder compares against
+	* (sizes, flags, the order of members and functions) match the ones of the engine, see OffsetFinder.cpp.
+	*/
+	constexpr EPropertyFlags PlainOldDataFlags = EPropertyFlags::Edit | EPropertyFlags::ZeroConstructor | EPropertyFlags::SaveGame | EPropertyFlags::IsPlainOldData | EPropertyFlags::NoDestructor | EPropertyFlags::HasGetValueTypeHash;
+
+	/* Large world coordinates, FVector uses double */
+	uint8* VectorStruct = CreateCoreStruct(CoreUObject, "Vector", { { ESyntheticPropertyType::Double, "X" }, { ESyntheticPropertyType::Double, "Y" }, { ESyntheticPropertyType::Double, "Z" } });
+	CreateCoreStruct(CoreUObject, "Vector2D", { { ESyntheticPropertyType::Double, "X" }, { ESyntheticPropertyType::Double, "Y" } });
+	CreateCoreStruct(CoreUObject, "SoftObjectPath", { { ESyntheticPropertyType::Name, "AssetPathName" }, { ESyntheticPropertyType::Str, "SubPathString" } });
+	CreateCoreStruct(CoreUObject, "Guid", { { ESyntheticPropertyType::Int, "A" }, { ESyntheticPropertyType::Int, "B" }, { ESyntheticPropertyType::Int, "C" }, { ESyntheticPropertyType::Int, "D" } }, PlainOldDataFlags);
+	CreateCoreStruct(CoreUObject, "Color", { { ESyntheticPropertyType::Byte, "B" }, { ESyntheticPropertyType::Byte, "G" }, { ESyntheticPropertyType::Byte, "R" }, { ESyntheticPropertyType::Byte, "A" } }, PlainOldDataFlags | EPropertyFlags::BlueprintVisible);
+
+	/* FQuat and FTransform are 16-byte aligned for SIMD */
+	uint8* QuatStruct = CreateCoreStruct(CoreUObject, "Quat", { { ESyntheticPropertyType::Double, "X" }, { ESyntheticPropertyType::Double, "Y" }, { ESyntheticPropertyType::Double, "Z" }, { ESyntheticPropertyType::Double, "W" } }, EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible, 0x10);
+
+	SyntheticStructBuilder TransformBuilder = BeginStruct(CreateScriptStruct(CoreUObject, "Transform"), nullptr);
+	AddMember(TransformBuilder, ESyntheticPropertyType::Struct, "Rotation", EPropertyFlags::Edit, QuatStruct);
+	AddMember(TransformBuilder, ESyntheticPropertyType::Struct, "Translation", EPropertyFlags::Edit, VectorStruct);
+	AddMember(TransformBuilder, ESyntheticPropertyType::Struct, "Scale3D", EPropertyFlags::Edit, VectorStruct);
+	FinishStruct(TransformBuilder);
+
+	/* Classes of /Script/Engine which the OffsetFinder, the generators, or the generated SDK, rely on */
+	uint8* EnginePackage = CreateObject(UObject::SizeOf, PackageClass, "/Script/Engine", nullptr);
+
+	CreateEnum(EnginePackage, "ENetRole", 4);
+	CreateEnum(EnginePackage, "ETraceTypeQuery", 33);
+
+	uint8* URLStruct = CreateCoreStruct(EnginePackage, "URL",
+	{
+		{ ESyntheticPropertyType::Str, "Protocol" }, { ESyntheticPropertyType::Str, "Host" }, { ESyntheticPropertyType::Int, "Port" }, { ESyntheticPropertyType::Int, "Valid" },
+		{ ESyntheticPropertyType::Str, "Map" }, { ESyntheticPropertyType::Str, "RedirectURL" }, { ESyntheticPropertyType::Array, "Op" }, { ESyntheticPropertyType::Str, "Portal" }
+	});
+
+	uint8* InterfaceAssetUserDataClass = CreateClass(EnginePackage, "Interface_AssetUserData", InterfaceClass, UObject::SizeOf);
+
+	SyntheticStructBuilder ActorBuilder = BeginClass(EnginePackage, "Actor", ObjectClass, EClassCastFlags::Actor);
+	AddMember(ActorBuilder, ESyntheticPropertyType::Object, "Owner", EPropertyFlags::Net, ActorBuilder.Object);
+	uint8* ActorClass = FinishClass(ActorBuilder, 0x290);
+
+	SyntheticStructBuilder ActorComponentBuilder = BeginClass(EnginePackage, "ActorComponent", ObjectClass);
+	AddMember(ActorComponentBuilder, ESyntheticPropertyType::Array, "ComponentTags", EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible);
+	uint8* ActorComponentClass = FinishClass(ActorComponentBuilder, 0xA0);
+
+	FImplementedInterface* ActorComponentInterfaces = reinterpret_cast<FImplementedInterface*>(Allocate(sizeof(FImplementedInterface)));
+	ActorComponentInterfaces[0] = { UEClass(InterfaceAssetUserDataClass), 0x0, false };
+
+	Write<FSyntheticArray>(ActorComponentClass, UClass::ImplementedInterfaces, { ActorComponentInterfaces, 0x1, 0x1 });
+
+	SyntheticStructBuilder PawnBuilder = BeginClass(EnginePackage, "Pawn", ActorClass, EClassCastFlags::Pawn);
+	AddMember(PawnBuilder, ESyntheticPropertyType::Float, "BaseEyeHeight", EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible);
+	uint8* PawnClass = FinishClass(PawnBuilder, 0x328);
+
+	/* The first function of both is the first entry of UStruct::Children */
+	SyntheticStructBuilder ControllerBuilder = BeginClass(EnginePackage, "Controller", ActorClass);
+	AddFunction(ControllerBuilder, "UnPossess", PawnClass);
+	AddMember(ControllerBuilder, ESyntheticPropertyType::Object, "Pawn", EPropertyFlags::Net, PawnClass);
+	uint8* ControllerClass = FinishClass(ControllerBuilder, 0x2F0);
+
+	SyntheticStructBuilder PlayerControllerBuilder = BeginClass(EnginePackage, "PlayerController", ControllerClass, EClassCastFlags::PlayerController);
+	AddFunction(PlayerControllerBuilder, "WasInputKeyJustReleased", ActorClass, EFunctionFlags::Final | EFunctionFlags::Native | EFunctionFlags::Public | EFunctionFlags::BlueprintCallable | EFunctionFlags::BlueprintPure | EFunctionFlags::Const);
+	AddFunction(PlayerControllerBuilder, "WasInputKeyJustPressed", ActorClass, EFunctionFlags::Final | EFunctionFlags::Native | EFunctionFlags::Public | EFunctionFlags::BlueprintCallable | EFunctionFlags::BlueprintPure | EFunctionFlags::Const);
+	AddFunction(PlayerControllerBuilder, "ToggleSpeaking", ActorClass, EFunctionFlags::Exec | EFunctionFlags::Native | EFunctionFlags::Public);
+	AddFunction(PlayerControllerBuilder, "SwitchLevel", ActorClass, EFunctionFlags::Exec | EFunctionFlags::Native | EFunctionFlags::Public);
+	AddMember(PlayerControllerBuilder, ESyntheticPropertyType::Bool, "bAutoManageActiveCameraTarget", EPropertyFlags::Edit);
+	uint8* PlayerControllerClass = FinishClass(PlayerControllerBuilder, 0x7A0);
+
+	SyntheticStructBuilder PlayerStartBuilder = BeginClass(EnginePackage, "PlayerStart", ActorClass);
+	AddMember(PlayerStartBuilder, ESyntheticPropertyType::Name, "PlayerStartTag", EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible);
+	uint8* PlayerStartClass = FinishClass(PlayerStartBuilder, 0x2A0);
+
+	/* UField::Next is found through the first two functions of both libraries */
+	SyntheticStructBuilder KismetSystemLibraryBuilder = BeginClass(EnginePackage, "KismetSystemLibrary", ObjectClass);
+	AddFunction(KismetSystemLibraryBuilder, "GetEngineVersion", ObjectClass);
+	AddFunction(KismetSystemLibraryBuilder, "GetGameName", ObjectClass);
+	uint8* KismetSystemLibraryClass = FinishClass(KismetSystemLibraryBuilder, UObject::SizeOf);
+
+	SyntheticStructBuilder KismetStringLibraryBuilder = BeginClass(EnginePackage, "KismetStringLibrary", ObjectClass);
+	AddFunction(KismetStringLibraryBuilder, "Concat_StrStr", ObjectClass);
+	AddFunction(KismetStringLibraryBuilder, "Len", ObjectClass);
+	uint8* KismetStringLibraryClass = FinishClass(KismetStringLibraryBuilder, UObject::SizeOf);
+
+	SyntheticStructBuilder EngineBuilder = BeginClass(EnginePackage, "Engine", ObjectClass);
+	AddMember(EngineBuilder, ESyntheticPropertyType::Bool, "bIsOverridingSelectedColor", EPropertyFlags::Transient);
+	MakeBitfieldMember(AddMember(EngineBuilder, ESyntheticPropertyType::Bool, "bEnableOnScreenDebugMessagesDisplay", EPropertyFlags::Transient), 0b00000010);
+	uint8* EngineClass = FinishClass(EngineBuilder, 0x40);
+
+	uint8* GameEngineClass = CreateClass(EnginePackage, "GameEngine", EngineClass, 0x48);
+
+	/* UWorld::GetActorsOfClass() is only generated if 'PersistentLevel' and 'Levels' exist, ULevel and UWorld reference each other */
+	SyntheticStructBuilder WorldBuilder = BeginClass(EnginePackage, "World", ObjectClass);
+
+	/* ULevel implements IInterface_AssetUserData, its vtable-pointer comes before 'URL'. 'Actors' is searched for between 'URL' and 'OwningWorld' */
+	SyntheticStructBuilder LevelBuilder = BeginClass(EnginePackage, "Level", ObjectClass, EClassCastFlags::Level);
+	LevelBuilder.CurrentOffset = UObject::SizeOf + 0x8;
+	AddMember(LevelBuilder, ESyntheticPropertyType::Struct, "URL", EPropertyFlags::None, URLStruct);
+	AddMember(LevelBuilder, ESyntheticPropertyType::Array, "Actors", EPropertyFlags::None, ActorClass);
+	AddMember(LevelBuilder, ESyntheticPropertyType::Object, "OwningWorld", EPropertyFlags::Transient, WorldBuilder.Object);
+	uint8* LevelClass = FinishClass(LevelBuilder, ULevel::SizeOf);
+
+	AddMember(WorldBuilder, ESyntheticPropertyType::Object, "PersistentLevel", EPropertyFlags::None, LevelClass);
+	AddMember(WorldBuilder, ESyntheticPropertyType::Array, "Levels", EPropertyFlags::None, LevelClass);
+	uint8* WorldClass = FinishClass(WorldBuilder, UObject::SizeOf);
+
+	/* UDataTable::RowMap directly follows 'RowStruct' */
+	SyntheticStructBuilder DataTableBuilder = BeginClass(EnginePackage, "DataTable", ObjectClass);
+	AddMember(DataTableBuilder, ESyntheticPropertyType::Object, "RowStruct", EPropertyFlags::None, ScriptStructClass);
+	uint8* DataTableClass = FinishClass(DataTableBuilder, UDataTable::SizeOf);
+
+	AllClasses.insert(AllClasses.end(),
+	{
+		InterfaceAssetUserDataClass, ActorClass, ActorComponentClass, PawnClass, ControllerClass, PlayerControllerClass, PlayerStartClass,
+		KismetSystemLibraryClass, KismetStringLibraryClass, EngineClass, GameEngineClass, LevelClass, WorldClass, DataTableClass
+	});
+
+	struct SyntheticClassInfo
+	{
+		uint8* Class;
+		int32 Depth;
+	};
+
+	std::vector<SyntheticClassInfo> PreviousPackageClasses;
+	std::vector<uint8*> PreviousPackageStructs;
+	uint8* PreviousPackage = nullptr;
+
+	for (int32 PackageIdx = 0; PackageIdx < Config.NumPackages; PackageIdx++)
+	{
+		uint8* Package = CreateObject(UObject::SizeOf, PackageClass, std::format("/Script/SynthPackage{}", PackageIdx), nullptr);
+
+		std::vector<uint8*> Enums;
+		std::vector<uint8*> Structs;
+		std::vector<SyntheticClassInfo> Classes;
+
+		for (int32 i = 0; i < Config.NumEnumsPerPackage; i++)
+			Enums.push_back(CreateEnum(Package, std::format("ESynthEnum{}_{}", PackageIdx, i), 2 + static_cast<int32>(RandomIndex(12))));
+
+		/* Only structs that are already complete can be used as members, including structs of the previous package creates dependencies between packages */
+		auto PickStruct = [&]() -> uint8*
+		{
+			if (!PreviousPackageStructs.empty() && (Structs.empty() || RandomIndex(4) == 0))
+				return PreviousPackageStructs[RandomIndex(PreviousPackageStructs.size())];
+
+			return !Structs.empty() ? Structs[RandomIndex(Structs.size())] : nullptr;
+		};
+
+		auto AddRandomMembers = [&](SyntheticStructBuilder& Builder, int32 NumMembers) -> void
+		{
+			for (int32 i = 0; i < NumMembers; i++)
+			{
+				ESyntheticPropertyType Type = MemberTypeDistribution[RandomIndex(std::size(MemberTypeDistribution))];
+				uint8* Referenced = nullptr;
+
+				if (Type == ESyntheticPropertyType::Struct)
+				{
+					Referenced = PickStruct();
+				}
+				else if (Type == ESyntheticPropertyType::Object || (Type == ESyntheticPropertyType::Array && RandomIndex(2) == 0))
+				{
+					Referenced = AllClasses[RandomIndex(AllClasses.size())];
+				}
+				else if (Type == ESyntheticPropertyType::Enum || (Type == ESyntheticPropertyType::Byte && RandomIndex(2) == 0))
+				{
+					Referenced = !Enums.empty() ? Enums[RandomIndex(Enums.size())] : nullptr;
+				}
+
+				const bool bRequiresReference = Type == ESyntheticPropertyType::Struct || Type == ESyntheticPropertyType::Enum;
+
+				if (bRequiresReference && !Referenced)
+					Type = ESyntheticPropertyType::Int;
+
+				const std::string Name = std::format("{}{}", PropertyTypeInfos[static_cast<size_t>(Type)].MemberPrefix, i);
+
+				AddMember(Builder, Type, Name, EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible | EPropertyFlags::NativeAccessSpecifierPublic, Referenced);
+			}
+		};
+
+		for (int32 i = 0; i < Config.NumStructsPerPackage; i++)
+		{
+			uint8* Super = !Structs.empty() && RandomIndex(5) == 0 ? Structs[RandomIndex(Structs.size())] : nullptr;
+
+			SyntheticStructBuilder Builder = BeginStruct(CreateScriptStruct(Package, std::format("SynthStruct{}_{}", PackageIdx, i)), Super);
+
+			/* Guarantee a dependency on the previous package, required for the cycles below */
+			if (i == 0 && !PreviousPackageStructs.empty())
+				AddMember(Builder, ESyntheticPropertyType::Struct, "PreviousPackageData", EPropertyFlags::Edit, PreviousPackageStructs[RandomIndex(PreviousPackageStructs.size())]);
+
+			AddRandomMembers(Builder, Config.NumPropertiesPerStruct);
+			FinishStruct(Builder);
+
+			Structs.push_back(Builder.Object);
+		}
+
+		for (int32 i = 0; i < Config.NumClassesPerPackage; i++)
+		{
+			SyntheticClassInfo Super = { RandomIndex(3) == 0 ? ActorClass : ObjectClass, 0 };
+
+			if (!Classes.empty() && RandomIndex(3) != 0)
+			{
+				const SyntheticClassInfo& Candidate = Classes[RandomIndex(Classes.size())];
+
+				if (Candidate.Depth < Config.MaxInheritanceDepth)
+					Super = Candidate;
+			}
+			else if (!PreviousPackageClasses.empty() && RandomIndex(4) == 0)
+			{
+				const SyntheticClassInfo& Candidate = PreviousPackageClasses[RandomIndex(PreviousPackageClasses.size())];
+
+				if (Candidate.Depth < Config.MaxInheritanceDepth)
+					Super = Candidate;
+			}
+
+			uint8* Class = CreateObject(UClass::SizeOf, ClassClass, std::format("SynthClass{}_{}", PackageIdx, i), Package);
+			Write<EClassCastFlags>(Class, UClass::CastFlags, Read<EClassCastFlags>(Super.Class, UClass::CastFlags));
+
+			SyntheticStructBuilder Builder = BeginStruct(Class, Super.Class);
+			AddRandomMembers(Builder, Config.NumPropertiesPerStruct);
+
+			for (int32 j = 0; j < Config.NumFunctionsPerClass; j++)
+				AddFunction(Builder, std::format("Function{}", j), AllClasses[RandomIndex(AllClasses.size())]);
+
+			Builder.Alignment = std::max(Builder.Alignment, 0x8);
+			FinishStruct(Builder);
+
+			Classes.push_back({ Class, Super.Depth + 1 });
+			AllClasses.push_back(Class);
+		}
+
+		/* The previous package already includes this one, a struct of the previous package using a struct of this package closes the cycle */
+		const bool bIsCyclicPackage = Config.CyclicPackageInterval > 0 && PackageIdx > 0 && (PackageIdx % Config.CyclicPackageInterval) == 0;
+
+		if (bIsCyclicPackage && PreviousPackage && !PreviousPackageStructs.empty() && !Structs.empty())
+		{
+			SyntheticStructBuilder Builder = BeginStruct(CreateScriptStruct(PreviousPackage, std::format("SynthCycleStruct{}", PackageIdx)), nullptr);
+			AddMember(Builder, ESyntheticPropertyType::Struct, "NextPackageData", EPropertyFlags::Edit, Structs[RandomIndex(Structs.size())]);
+			FinishStruct(Builder);
+		}
+
+		PreviousPackage = Package;
+		PreviousPackageStructs = std::move(Structs);
+		PreviousPackageClasses = std::move(Classes);
+	}
+
+	for (uint8* Class : AllClasses)
+		CreateDefaultObject(Class);
+
+	/* Instances found by Off::InSDK::World::InitGWorld() through the global pointers in .data */
+	uint8* MapPackage = CreateObject(UObject::SizeOf, PackageClass, "/Game/Maps/SynthMap", nullptr);
+	uint8* World = CreateObject(Read<int32>(WorldClass, UStruct::Size), WorldClass, "SynthMap", MapPackage);
+	uint8* PersistentLevel = CreateObject(ULevel::SizeOf, LevelClass, "PersistentLevel", World);
+
+	Write<uint8*>(World, UObject::SizeOf, PersistentLevel); // UWorld::PersistentLevel is the first member
+	Write<uint8*>(PersistentLevel, ULevel::SizeOf - 0x8, World); // ULevel::OwningWorld is the last member
+
+	/* ULevel::Actors is found as the first valid TArray after 'URL' */
+	uint8** LevelActors = reinterpret_cast<uint8**>(Allocate(sizeof(uint8*)));
+	LevelActors[0] = CreateObject(Read<int32>(PlayerStartClass, UStruct::Size), PlayerStartClass, "PlayerStart_0", PersistentLevel, EObjectFlags::Transactional);
+
+	Write<FSyntheticArray>(PersistentLevel, ULevel::Actors, { LevelActors, 0x1, 0x1 });
+
+	uint8* TransientPackage = CreateObject(UObject::SizeOf, PackageClass, "/Engine/Transient", nullptr);
+	uint8* Engine = CreateObject(Read<int32>(GameEngineClass, UStruct::Size), GameEngineClass, "GameEngine_0", TransientPackage);
+
+	GSyntheticWorld = World;
+	GSyntheticEngine = Engine;
+
+	/* Publish all objects through a chunked GObjects array */
+	const int32 NumObjects = static_cast<int32>(Objects.size());
+	const int32 NumChunks = (NumObjects / NumElementsPerChunk) + 1;
+
+	uint8** Chunks = reinterpret_cast<uint8**>(Allocate(NumChunks * sizeof(uint8*)));
+
+	for (int32 i = 0; i < NumChunks; i++)
+		Chunks[i] = Allocate(NumElementsPerChunk * FUObjectItemSize);
+
+	for (int32 i = 0; i < NumObjects; i++)
+		Write<uint8*>(Chunks[i / NumElementsPerChunk], (i % NumElementsPerChunk) * FUObjectItemSize, Objects[i]);
+
+	GSyntheticObjects.Objects = Chunks;
+	GSyntheticObjects.PreAllocatedObjects = nullptr;
+	GSyntheticObjects.MaxElements = NumChunks * NumElementsPerChunk;
+	GSyntheticObjects.NumElements = NumObjects;
+	GSyntheticObjects.MaxChunks = NumChunks;
+	GSyntheticObjects.NumChunks = NumChunks;
+}
+
+void SyntheticUniverse::InitEngineCore()
+{
+	using namespace SyntheticLayout;
+
+	DumpStats::ScopedPhase EngineCorePhase("InitEngineCore");
+
+	/* Same as the manual overrides in Generator::InitEngineCore(), there's no engine code to find GObjects, FName::AppendString or ProcessEvent by */
+	DumpStats::MeasurePhase("ObjectArray::Init", [] { ObjectArray::Init(static_cast<int32>(GetOffset(&GSyntheticObjects)), NumElementsPerChunk); });
+	DumpStats::MeasurePhase("FName::Init", [] { FName::Init(static_cast<int32>(GetOffset(reinterpret_cast<const void*>(&SyntheticAppendString))), FName::EOffsetOverrideType::AppendString); });
+
+	Settings::Internal::bUseNamePool = true;
+
+	DumpStats::MeasurePhase("Off::Init", [] { Off::Init(); });
+	DumpStats::MeasurePhase("PropertySizes::Init", [] { PropertySizes::Init(); });
+	DumpStats::MeasurePhase("Off::InSDK::ProcessEvent::InitPE", [] { Off::InSDK::ProcessEvent::InitPE(ProcessEventIndex); });
+	DumpStats::MeasurePhase("Off::InSDK::World::InitGWorld", [] { Off::InSDK::World::InitGWorld(); });
+
+	/* Off::InSDK::Text::InitTextOffsets() calls native functions through ProcessEvent, the synthetic vtable only contains stubs */
+	Off::InSDK::Text::TextDatOffset = FText::TextData;
+	Off::InSDK::Text::InTextDataStringOffset = FText::InTextDataString;
+	Off::InSDK::Text::TextSize = FText::SizeOf;
+
+	/* Set by InitSettings() in Generator::InitEngineCore() */
+	Settings::Internal::bUseLargeWorldCoordinates = true;
+	Settings::Internal::bIsUE5OrHigher = true;
+}
+
+int32 SyntheticUniverse::GetNumObjects()
+{
+	return static_cast<int32>(Objects.size());
+}
+
+int32 SyntheticUniverse::GetNumNames()
+{
+	return static_cast<int32>(Names.size());
+}
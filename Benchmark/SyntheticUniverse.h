@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Unreal/Enums.h"
+
+
+struct SyntheticUniverseConfig
+{
+	int32 NumPackages = 200;
+
+	int32 NumEnumsPerPackage = 8;
+	int32 NumStructsPerPackage = 20;
+	int32 NumClassesPerPackage = 40;
+
+	int32 NumPropertiesPerStruct = 12;
+	int32 NumFunctionsPerClass = 4;
+
+	/* Longest chain of synthetic classes inheriting from one another, not counting UObject/AActor */
+	int32 MaxInheritanceDepth = 6;
+
+	/* Every n-th package and the package before it include each other. 0 disables cyclic packages */
+	int32 CyclicPackageInterval = 10;
+
+	uint32 Seed = 0x7;
+};
+
+/*
+* Fabricates a reflection-universe in the memory of this process, laid out like a UE5 game using FProperty.
+*
+* The GObjects array is stored in the .data section of this module, names are resolved by a replacement for FName::AppendString.
+* The engine objects the OffsetFinder looks up are part of the universe, all offsets are discovered by Off::Init().
+*/
+class SyntheticUniverse
+{
+public:
+	/* Creates all packages, types, default objects and a World/GameEngine instance, may only be called once */
+	static void Build(const SyntheticUniverseConfig& Config);
+
+	/* Replacement for Generator::InitEngineCore(), overrides GObjects, FName::AppendString and ProcessEvent and runs Off::Init() */
+	static void InitEngineCore();
+
+	static int32 GetNumObjects();
+	static int32 GetNumNames();
+};
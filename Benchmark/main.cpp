@@ -0,0 +1,189 @@
+
+#include <Windows.h>
+#include <Psapi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "SyntheticUniverse.h"
+
+#include "Generators/CppGenerator.h"
+#include "Generators/MappingGenerator.h"
+#include "Generators/IDAMappingGenerator.h"
+#include "Generators/DumpspaceGenerator.h"
+
+#include "Generators/Generator.h"
+
+#include "MemoryReader.h"
+
+
+struct BenchmarkResult
+{
+	std::string Name;
+	double Milliseconds;
+};
+
+template<typename CallbackType>
+static void Measure(std::vector<BenchmarkResult>& Results, const std::string& Name, CallbackType&& Callback)
+{
+	auto StartTime = std::chrono::high_resolution_clock::now();
+
+	Callback();
+
+	std::chrono::duration<double, std::milli> Duration = std::chrono::high_resolution_clock::now() - StartTime;
+
+	Results.push_back({ Name, Duration.count() });
+}
+
+static void PrintUsage()
+{
+	std::cout << "Usage: Dumper-7-Benchmark [options]\n\n";
+	std::cout << "  --packages <n>         Number of synthetic packages\n";
+	std::cout << "  --enums <n>            Enums per package\n";
+	std::cout << "  --structs <n>          Structs per package\n";
+	std::cout << "  --classes <n>          Classes per package\n";
+	std::cout << "  --properties <n>       Members per struct/class\n";
+	std::cout << "  --functions <n>        Functions per class\n";
+	std::cout << "  --depth <n>            Maximum inheritance depth of synthetic classes\n";
+	std::cout << "  --cycle-interval <n>   Every n-th package includes its predecessor cyclically, 0 disables cycles\n";
+	std::cout << "  --seed <n>             Seed used to build the universe\n";
+	std::cout << "  --remote-reader        Read GObjects and UObject/FField members through a RemoteMemoryReader attached to this process\n";
+	std::cout << std::endl;
+}
+
+static bool ParseArguments(int argc, char* argv[], SyntheticUniverseConfig& OutConfig, bool& bOutUseRemoteReader)
+{
+	struct IntArgument
+	{
+		const char* Name;
+		int32* Value;
+	};
+
+	const IntArgument IntArguments[] =
+	{
+		{ "--packages", &OutConfig.NumPackages },
+		{ "--enums", &OutConfig.NumEnumsPerPackage },
+		{ "--structs", &OutConfig.NumStructsPerPackage },
+		{ "--classes", &OutConfig.NumClassesPerPackage },
+		{ "--properties", &OutConfig.NumPropertiesPerStruct },
+		{ "--functions", &OutConfig.NumFunctionsPerClass },
+		{ "--depth", &OutConfig.MaxInheritanceDepth },
+		{ "--cycle-interval", &OutConfig.CyclicPackageInterval },
+	};
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* Argument = argv[i];
+
+		if (strcmp(Argument, "--remote-reader") == 0)
+		{
+			bOutUseRemoteReader = true;
+			continue;
+		}
+
+		if (strcmp(Argument, "--help") == 0 || (i + 1) >= argc)
+			return false;
+
+		if (strcmp(Argument, "--seed") == 0)
+		{
+			OutConfig.Seed = static_cast<uint32>(std::stoul(argv[++i]));
+			continue;
+		}
+
+		bool bFound = false;
+
+		for (const IntArgument& IntArg : IntArguments)
+		{
+			if (strcmp(Argument, IntArg.Name) != 0)
+				continue;
+
+			*IntArg.Value = std::max(std::stoi(argv[++i]), 0);
+			bFound = true;
+			break;
+		}
+
+		if (!bFound)
+			return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	SyntheticUniverseConfig Config;
+	bool bUseRemoteReader = false;
+
+	if (!ParseArguments(argc, argv, Config, bUseRemoteReader))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	Settings::Generator::GameName = "SyntheticUniverse";
+	Settings::Generator::GameVersion = "Benchmark";
+
+	std::vector<BenchmarkResult> Results;
+
+	Measure(Results, "SyntheticUniverse::Build", [&]() { SyntheticUniverse::Build(Config); });
+
+	std::cout << "Built synthetic universe with " << SyntheticUniverse::GetNumObjects() << " objects and " << SyntheticUniverse::GetNumNames() << " names.\n";
+
+	if (bUseRemoteReader)
+	{
+		auto Reader = std::make_unique<RemoteMemoryReader>(GetCurrentProcessId());
+
+		if (!Reader->IsValid())
+		{
+			std::cout << "\nDumper-7-Benchmark: Failed to open this process for reading!\n" << std::endl;
+			return 1;
+		}
+
+		Memory::SetReader(std::move(Reader));
+	}
+
+	Measure(Results, "InitEngineCore", []() { SyntheticUniverse::InitEngineCore(); });
+	Measure(Results, "InitInternal", []() { Generator::InitInternal(); });
+
+	/* The first generator also dumps GObjects */
+	Measure(Results, "CppGenerator", []() { Generator::Generate<CppGenerator>(); });
+	Measure(Results, "MappingGenerator", []() { Generator::Generate<MappingGenerator>(); });
+	Measure(Results, "IDAMappingGenerator", []() { Generator::Generate<IDAMappingGenerator>(); });
+	Measure(Results, "DumpspaceGenerator", []() { Generator::Generate<DumpspaceGenerator>(); });
+
+	if constexpr (Settings::Debug::bWriteDumpStats)
+		Generator::WriteDumpStats();
+
+	double TotalMilliseconds = 0.0;
+
+	std::cout << "\n\nResults:\n";
+
+	for (const BenchmarkResult& Result : Results)
+	{
+		std::cout << std::format("  {:<26}{:>12.2f}ms\n", Result.Name, Result.Milliseconds);
+		TotalMilliseconds += Result.Milliseconds;
+	}
+
+	std::cout << std::format("  {:<26}{:>12.2f}ms\n", "Total", TotalMilliseconds);
+
+	PROCESS_MEMORY_COUNTERS MemoryCounters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &MemoryCounters, sizeof(MemoryCounters)))
+		std::cout << std::format("\n  {:<26}{:>12.2f}MiB\n", "PeakWorkingSet", MemoryCounters.PeakWorkingSetSize / (1024.0 * 1024.0));
+
+	if (MemoryReader* Reader = Memory::GetReader())
+	{
+		const MemoryReaderStatistics Statistics = Reader->GetStatistics();
+
+		std::cout << std::format("  {:<26}{:>12.2f}%\n", "PageHitRate", Statistics.GetPageHitRate() * 100.0);
+		std::cout << std::format("  {:<26}{:>12}\n", "RemoteCalls", Statistics.NumRemoteCalls);
+	}
+
+	std::cout << std::endl;
+
+	return 0;
+}
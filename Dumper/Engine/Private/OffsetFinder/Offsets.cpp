@@ -1,4 +1,5 @@
 #include <format>
+#include <optional>
 
 #include "Utils.h"
 
@@ -73,26 +74,61 @@ void Off::InSDK::ProcessEvent::InitPE(int32 Index, const char* const ModuleName)
 void Off::InSDK::World::InitGWorld()
 {
 	UEClass UWorld = ObjectArray::FindClassFast("World");
+	UEClass UEngine = ObjectArray::FindClassFast("Engine");
+
+	/* Indexing .data once is a lot faster than scanning the whole section for every UWorld, and UEngine, instance */
+	const GlobalPointerIndex GlobalPointers(".data");
+
+	/* Built on the first miss, GWorld or GEngine might not be stored within .data */
+	std::optional<GlobalPointerIndex> AllGlobalPointers;
 
 	for (UEObject Obj : ObjectArray())
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject) || !Obj.IsA(UWorld))
+		if (Off::InSDK::World::GWorld != 0x0 && Off::InSDK::World::GEngine != 0x0)
+			break;
+
+		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+			continue;
+
+		const bool bIsWorld = Off::InSDK::World::GWorld == 0x0 && Obj.IsA(UWorld);
+		const bool bIsEngine = Off::InSDK::World::GEngine == 0x0 && UEngine && Obj.IsA(UEngine);
+
+		if (!bIsWorld && !bIsEngine)
 			continue;
 
-		/* Try to find a pointer to the word, aka UWorld** GWorld */
-		void* Result = FindAlignedValueInProcess(Obj.GetAddress());
+		/* Try to find a pointer to the object, aka UWorld** GWorld or UEngine** GEngine */
+		void* Result = GlobalPointers.FindAddressOf(Obj.GetAddress());
 
-		/* Pointer to UWorld* couldn't be found */
-		if (Result)
+		/* Same fallback as FindAlignedValueInProcess, search the whole image */
+		if (!Result)
+		{
+			if (!AllGlobalPointers)
+				AllGlobalPointers.emplace(".data", true);
+
+			Result = AllGlobalPointers->FindAddressOf(Obj.GetAddress());
+		}
+
+		/* Pointer to UWorld* or UEngine* couldn't be found */
+		if (!Result)
+			continue;
+
+		if (bIsWorld)
 		{
 			Off::InSDK::World::GWorld = GetOffset(Result);
 			std::cout << std::format("GWorld-Offset: 0x{:X}\n\n", Off::InSDK::World::GWorld);
-			break;
+		}
+		else
+		{
+			Off::InSDK::World::GEngine = GetOffset(Result);
+			std::cout << std::format("GEngine-Offset: 0x{:X}\n\n", Off::InSDK::World::GEngine);
 		}
 	}
 
 	if (Off::InSDK::World::GWorld == 0x0)
 		std::cout << std::format("\nGWorld WAS NOT FOUND!!!!!!!!!\n\n");
+
+	if (Off::InSDK::World::GEngine == 0x0)
+		std::cout << std::format("\nGEngine was not found.\n\n");
 }
 
 
@@ -229,93 +265,200 @@ void Off::Init()
 
 	::NameArray::PostInit();
 
-	Off::UStruct::Children = OffsetFinder::FindChildOffset();
-	std::cout << std::format("Off::UStruct::Children: 0x{:X}\n", Off::UStruct::Children);
+	/*
+	* All offsets below only rely on the basic UObject layout and the FName settings. Every finder is a task, which is run on a
+	* worker thread as soon as the offsets it relies on are known. Logs are collected per task and printed in declaration order.
+	*/
+	std::vector<ParallelHelper::GraphTask> Tasks;
+	std::vector<std::string> TaskLogs;
 
-	Off::UField::Next = OffsetFinder::FindUFieldNextOffset();
-	std::cout << std::format("Off::UField::Next: 0x{:X}\n", Off::UField::Next);
+	auto AddTask = [&](std::vector<int32_t>&& Dependencies, std::function<void(std::string& Log)>&& Task) -> int32_t
+	{
+		const int32_t TaskIdx = static_cast<int32_t>(Tasks.size());
 
-	Off::UStruct::SuperStruct = OffsetFinder::FindSuperOffset();
-	std::cout << std::format("Off::UStruct::SuperStruct: 0x{:X}\n", Off::UStruct::SuperStruct);
+		TaskLogs.emplace_back();
+		Tasks.push_back({ [&TaskLogs, TaskIdx, Task = std::move(Task)]() { Task(TaskLogs[TaskIdx]); }, std::move(Dependencies) });
 
-	Off::UStruct::Size = OffsetFinder::FindStructSizeOffset();
-	std::cout << std::format("Off::UStruct::Size: 0x{:X}\n", Off::UStruct::Size);
+		return TaskIdx;
+	};
 
-	Off::UStruct::MinAlignemnt = OffsetFinder::FindMinAlignmentOffset();
-	std::cout << std::format("Off::UStruct::MinAlignemnts: 0x{:X}\n", Off::UStruct::MinAlignemnt);
+	/* Sets 'Settings::Internal::bUseFProperty' */
+	const int32_t ChildrenTask = AddTask({}, [](std::string& Log)
+	{
+		Off::UStruct::Children = OffsetFinder::FindChildOffset();
+		Log += std::format("Off::UStruct::Children: 0x{:X}\n", Off::UStruct::Children);
+	});
 
-	Off::UClass::CastFlags = OffsetFinder::FindCastFlagsOffset();
-	std::cout << std::format("Off::UClass::CastFlags: 0x{:X}\n", Off::UClass::CastFlags);
+	const int32_t UFieldNextTask = AddTask({ ChildrenTask }, [](std::string& Log)
+	{
+		Off::UField::Next = OffsetFinder::FindUFieldNextOffset();
+		Log += std::format("Off::UField::Next: 0x{:X}\n", Off::UField::Next);
+	});
 
-	// Castflags become available for use
+	AddTask({}, [](std::string& Log)
+	{
+		Off::UStruct::SuperStruct = OffsetFinder::FindSuperOffset();
+		Log += std::format("Off::UStruct::SuperStruct: 0x{:X}\n", Off::UStruct::SuperStruct);
+	});
+
+	const int32_t StructSizeTask = AddTask({}, [](std::string& Log)
+	{
+		Off::UStruct::Size = OffsetFinder::FindStructSizeOffset();
+		Log += std::format("Off::UStruct::Size: 0x{:X}\n", Off::UStruct::Size);
+	});
 
-	if (Settings::Internal::bUseFProperty)
+	AddTask({}, [](std::string& Log)
 	{
-		std::cout << std::format("\nGame uses FProperty system\n\n");
+		Off::UStruct::MinAlignemnt = OffsetFinder::FindMinAlignmentOffset();
+		Log += std::format("Off::UStruct::MinAlignemnts: 0x{:X}\n", Off::UStruct::MinAlignemnt);
+	});
+
+	// Castflags become available for use, required by every lookup of objects by type (eg. FindClassFast)
+	const int32_t CastFlagsTask = AddTask({}, [](std::string& Log)
+	{
+		Off::UClass::CastFlags = OffsetFinder::FindCastFlagsOffset();
+		Log += std::format("Off::UClass::CastFlags: 0x{:X}\n", Off::UClass::CastFlags);
+	});
+
+	const int32_t ChildPropertiesTask = AddTask({ ChildrenTask, CastFlagsTask }, [](std::string& Log)
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
+
+		Log += std::format("\nGame uses FProperty system\n\n");
 
 		Off::UStruct::ChildProperties = OffsetFinder::FindChildPropertiesOffset();
-		std::cout << std::format("Off::UStruct::ChildProperties: 0x{:X}\n", Off::UStruct::ChildProperties);
+		Log += std::format("Off::UStruct::ChildProperties: 0x{:X}\n", Off::UStruct::ChildProperties);
 
 		OffsetFinder::FixupHardcodedOffsets(); // must be called after FindChildPropertiesOffset 
+	});
+
+	const int32_t FFieldNextTask = AddTask({ ChildPropertiesTask }, [](std::string& Log)
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
 
 		Off::FField::Next = OffsetFinder::FindFFieldNextOffset();
-		std::cout << std::format("Off::FField::Next: 0x{:X}\n", Off::FField::Next);
-		
+		Log += std::format("Off::FField::Next: 0x{:X}\n", Off::FField::Next);
+	});
+
+	/* Modifies 'Off::FField::Name' while searching, no task reading names of FFields may run in parallel */
+	const int32_t FFieldNameTask = AddTask({ ChildPropertiesTask }, [](std::string& Log)
+	{
+		if (!Settings::Internal::bUseFProperty)
+			return;
+
 		Off::FField::Name = OffsetFinder::FindFFieldNameOffset();
-		std::cout << std::format("Off::FField::Name: 0x{:X}\n", Off::FField::Name);
+		Log += std::format("Off::FField::Name: 0x{:X}\n", Off::FField::Name);
 
 		/*
 		* FNameSize might be wrong at this point of execution.
 		* FField::Flags is not critical so a fix is only applied later in OffsetFinder::PostInitFNameSettings().
 		*/
 		Off::FField::Flags = Off::FField::Name + Off::InSDK::Name::FNameSize;
-		std::cout << std::format("Off::FField::Flags: 0x{:X}\n", Off::FField::Flags);
-	}
+		Log += std::format("Off::FField::Flags: 0x{:X}\n", Off::FField::Flags);
+	});
+
+	const int32_t DefaultObjectTask = AddTask({ CastFlagsTask }, [](std::string& Log)
+	{
+		Off::UClass::ClassDefaultObject = OffsetFinder::FindDefaultObjectOffset();
+		Log += std::format("Off::UClass::ClassDefaultObject: 0x{:X}\n", Off::UClass::ClassDefaultObject);
+	});
+
+	AddTask({ DefaultObjectTask }, [](std::string& Log)
+	{
+		Off::UClass::ImplementedInterfaces = OffsetFinder::FindImplementedInterfacesOffset();
+		Log += std::format("Off::UClass::ImplementedInterfaces: 0x{:X}\n", Off::UClass::ImplementedInterfaces);
+	});
+
+	AddTask({ CastFlagsTask }, [](std::string& Log)
+	{
+		Off::UEnum::Names = OffsetFinder::FindEnumNamesOffset();
+		Log += std::format("Off::UEnum::Names: 0x{:X}\n\n", Off::UEnum::Names);
+	});
 
-	Off::UClass::ClassDefaultObject = OffsetFinder::FindDefaultObjectOffset();
-	std::cout << std::format("Off::UClass::ClassDefaultObject: 0x{:X}\n", Off::UClass::ClassDefaultObject);
+	AddTask({ CastFlagsTask }, [](std::string& Log)
+	{
+		Off::UFunction::FunctionFlags = OffsetFinder::FindFunctionFlagsOffset();
+		Log += std::format("Off::UFunction::FunctionFlags: 0x{:X}\n", Off::UFunction::FunctionFlags);
+	});
 
-	Off::UClass::ImplementedInterfaces = OffsetFinder::FindImplementedInterfacesOffset();
-	std::cout << std::format("Off::UClass::ImplementedInterfaces: 0x{:X}\n", Off::UClass::ImplementedInterfaces);
+	AddTask({ CastFlagsTask }, [](std::string& Log)
+	{
+		Off::UFunction::ExecFunction = OffsetFinder::FindFunctionNativeFuncOffset();
+		Log += std::format("Off::UFunction::ExecFunction: 0x{:X}\n\n", Off::UFunction::ExecFunction);
+	});
 
-	Off::UEnum::Names = OffsetFinder::FindEnumNamesOffset();
-	std::cout << std::format("Off::UEnum::Names: 0x{:X}\n", Off::UEnum::Names) << std::endl;
+	/* Everything required to iterate the members of a struct, by name and type */
+	std::vector<int32_t> FindMemberDependencies = { CastFlagsTask, UFieldNextTask, FFieldNextTask, FFieldNameTask };
 
-	Off::UFunction::FunctionFlags = OffsetFinder::FindFunctionFlagsOffset();
-	std::cout << std::format("Off::UFunction::FunctionFlags: 0x{:X}\n", Off::UFunction::FunctionFlags);
+	const int32_t ElementSizeTask = AddTask(std::vector<int32_t>(FindMemberDependencies), [](std::string& Log)
+	{
+		Off::Property::ElementSize = OffsetFinder::FindElementSizeOffset();
+		Log += std::format("Off::Property::ElementSize: 0x{:X}\n", Off::Property::ElementSize);
+	});
 
-	Off::UFunction::ExecFunction = OffsetFinder::FindFunctionNativeFuncOffset();
-	std::cout << std::format("Off::UFunction::ExecFunction: 0x{:X}\n", Off::UFunction::ExecFunction) << std::endl;
+	AddTask({ ElementSizeTask }, [](std::string& Log)
+	{
+		Off::Property::ArrayDim = OffsetFinder::FindArrayDimOffset();
+		Log += std::format("Off::Property::ArrayDim: 0x{:X}\n", Off::Property::ArrayDim);
+	});
 
-	Off::Property::ElementSize = OffsetFinder::FindElementSizeOffset();
-	std::cout << std::format("Off::Property::ElementSize: 0x{:X}\n", Off::Property::ElementSize);
+	const int32_t OffsetInternalTask = AddTask(std::vector<int32_t>(FindMemberDependencies), [](std::string& Log)
+	{
+		Off::Property::Offset_Internal = OffsetFinder::FindOffsetInternalOffset();
+		Log += std::format("Off::Property::Offset_Internal: 0x{:X}\n", Off::Property::Offset_Internal);
+	});
 
-	Off::Property::ArrayDim = OffsetFinder::FindArrayDimOffset();
-	std::cout << std::format("Off::Property::ArrayDim: 0x{:X}\n", Off::Property::ArrayDim);
+	AddTask(std::vector<int32_t>(FindMemberDependencies), [](std::string& Log)
+	{
+		Off::Property::PropertyFlags = OffsetFinder::FindPropertyFlagsOffset();
+		Log += std::format("Off::Property::PropertyFlags: 0x{:X}\n", Off::Property::PropertyFlags);
+	});
 
-	Off::Property::Offset_Internal = OffsetFinder::FindOffsetInternalOffset();
-	std::cout << std::format("Off::Property::Offset_Internal: 0x{:X}\n", Off::Property::Offset_Internal);
+	const int32_t PropertySizeTask = AddTask({ OffsetInternalTask }, [](std::string& Log)
+	{
+		Off::InSDK::Properties::PropertySize = OffsetFinder::FindBoolPropertyBaseOffset();
+		Log += std::format("UPropertySize: 0x{:X}\n\n", Off::InSDK::Properties::PropertySize);
+	});
 
-	Off::Property::PropertyFlags = OffsetFinder::FindPropertyFlagsOffset();
-	std::cout << std::format("Off::Property::PropertyFlags: 0x{:X}\n", Off::Property::PropertyFlags);
+	AddTask({ PropertySizeTask }, [](std::string& Log)
+	{
+		Off::ArrayProperty::Inner = OffsetFinder::FindInnerTypeOffset(Off::InSDK::Properties::PropertySize);
+		Log += std::format("Off::ArrayProperty::Inner: 0x{:X}\n", Off::ArrayProperty::Inner);
+	});
 
-	Off::InSDK::Properties::PropertySize = OffsetFinder::FindBoolPropertyBaseOffset();
-	std::cout << std::format("UPropertySize: 0x{:X}\n", Off::InSDK::Properties::PropertySize) << std::endl;
+	AddTask({ PropertySizeTask }, [](std::string& Log)
+	{
+		Off::SetProperty::ElementProp = OffsetFinder::FindSetPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
+		Log += std::format("Off::SetProperty::ElementProp: 0x{:X}\n", Off::SetProperty::ElementProp);
+	});
 
-	Off::ArrayProperty::Inner = OffsetFinder::FindInnerTypeOffset(Off::InSDK::Properties::PropertySize);
-	std::cout << std::format("Off::ArrayProperty::Inner: 0x{:X}\n", Off::ArrayProperty::Inner);
+	AddTask({ PropertySizeTask }, [](std::string& Log)
+	{
+		Off::MapProperty::Base = OffsetFinder::FindMapPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
+		Log += std::format("Off::MapProperty::Base: 0x{:X}\n\n", Off::MapProperty::Base);
+	});
 
-	Off::SetProperty::ElementProp = OffsetFinder::FindSetPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
-	std::cout << std::format("Off::SetProperty::ElementProp: 0x{:X}\n", Off::SetProperty::ElementProp);
+	AddTask({ OffsetInternalTask, StructSizeTask }, [](std::string& Log)
+	{
+		Off::InSDK::ULevel::Actors = OffsetFinder::FindLevelActorsOffset();
+		Log += std::format("Off::InSDK::ULevel::Actors: 0x{:X}\n\n", Off::InSDK::ULevel::Actors);
+	});
 
-	Off::MapProperty::Base = OffsetFinder::FindMapPropertyBaseOffset(Off::InSDK::Properties::PropertySize);
-	std::cout << std::format("Off::MapProperty::Base: 0x{:X}\n", Off::MapProperty::Base) << std::endl;
+	AddTask({ OffsetInternalTask, ElementSizeTask }, [](std::string& Log)
+	{
+		Off::InSDK::UDataTable::RowMap = OffsetFinder::FindDatatableRowMapOffset();
+		Log += std::format("Off::InSDK::UDataTable::RowMap: 0x{:X}\n\n", Off::InSDK::UDataTable::RowMap);
+	});
 
-	Off::InSDK::ULevel::Actors = OffsetFinder::FindLevelActorsOffset();
-	std::cout << std::format("Off::InSDK::ULevel::Actors: 0x{:X}\n", Off::InSDK::ULevel::Actors) << std::endl;
+	/*
+	* The OffsetFinder dereferences game-memory directly, it only works injected. Offsets found through the UE* wrappers are
+	* read through Memory::Read, a RemoteMemoryReader is thread-safe, so no task-graph has to be limited to a single thread.
+	*/
+	ParallelHelper::RunTaskGraph(Tasks, [&](int32_t TaskIdx) { std::cout << TaskLogs[TaskIdx]; });
 
-	Off::InSDK::UDataTable::RowMap = OffsetFinder::FindDatatableRowMapOffset();
-	std::cout << std::format("Off::InSDK::UDataTable::RowMap: 0x{:X}\n", Off::InSDK::UDataTable::RowMap) << std::endl;
+	std::cout << std::flush;
 
 	OffsetFinder::PostInitFNameSettings();
 
@@ -7,6 +7,8 @@
 #include "Unreal/ObjectArray.h"
 #include "OffsetFinder/Offsets.h"
 #include "Utils.h"
+#include "MemoryReader.h"
+#include "Stats/DumpStats.h"
 
 
 namespace fs = std::filesystem;
@@ -282,14 +284,14 @@ void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
 				if (Index < 0 || Index > Num())
 					return nullptr;
 
-				uint8_t* ChunkPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(ObjectsArray));
+				uint8_t* ChunkPtr = DecryptPtr(Memory::Read<uint8_t*>(ObjectsArray));
 
-				return *reinterpret_cast<void**>(ChunkPtr + FUObjectItemOffset + (Index * FUObjectItemSize));
+				return Memory::Read<void*>(ChunkPtr + FUObjectItemOffset + (Index * FUObjectItemSize));
 			};
 
-			uint8_t* ChunksPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
+			uint8_t* ChunksPtr = DecryptPtr(Memory::Read<uint8_t*>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
-			ObjectArray::InitializeFUObjectItem(*reinterpret_cast<uint8_t**>(ChunksPtr));
+			ObjectArray::InitializeFUObjectItem(Memory::Read<uint8_t*>(ChunksPtr));
 
 			return;
 		}
@@ -312,17 +314,17 @@ void ObjectArray::Init(bool bScanAllMemory, const char* const ModuleName)
 				const int32 ChunkIndex = Index / PerChunk;
 				const int32 InChunkIdx = Index % PerChunk;
 
-				uint8_t* ChunkPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(ObjectsArray));
+				uint8_t* ChunkPtr = DecryptPtr(Memory::Read<uint8_t*>(ObjectsArray));
 
-				uint8_t* Chunk = reinterpret_cast<uint8_t**>(ChunkPtr)[ChunkIndex];
+				uint8_t* Chunk = Memory::Read<uint8_t*>(reinterpret_cast<uint8_t**>(ChunkPtr) + ChunkIndex);
 				uint8_t* ItemPtr = Chunk + (InChunkIdx * FUObjectItemSize);
 
-				return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
+				return Memory::Read<void*>(ItemPtr + FUObjectItemOffset);
 			};
 			
-			uint8_t* ChunksPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
+			uint8_t* ChunksPtr = DecryptPtr(Memory::Read<uint8_t*>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
-			ObjectArray::InitializeFUObjectItem(*reinterpret_cast<uint8_t**>(ChunksPtr));
+			ObjectArray::InitializeFUObjectItem(Memory::Read<uint8_t*>(ChunksPtr));
 
 			ObjectArray::InitializeChunkSize(GObjects + Off::FUObjectArray::GetObjectsOffset());
 
@@ -359,14 +361,14 @@ void ObjectArray::Init(int32 GObjectsOffset, const FFixedUObjectArrayLayout& Obj
 		if (Index < 0 || Index > Num())
 			return nullptr;
 
-		uint8_t* ItemPtr = *reinterpret_cast<uint8_t**>(ObjectsArray) + (Index * FUObjectItemSize);
+		uint8_t* ItemPtr = Memory::Read<uint8_t*>(ObjectsArray) + (Index * FUObjectItemSize);
 
-		return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
+		return Memory::Read<void*>(ItemPtr + FUObjectItemOffset);
 	};
 
-	uint8_t* ChunksPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
+	uint8_t* ChunksPtr = DecryptPtr(Memory::Read<uint8_t*>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
-	ObjectArray::InitializeFUObjectItem(*reinterpret_cast<uint8_t**>(ChunksPtr));
+	ObjectArray::InitializeFUObjectItem(Memory::Read<uint8_t*>(ChunksPtr));
 }
 
 void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChunkedFixedUObjectArrayLayout& ObjectArrayLayout, const char* const ModuleName)
@@ -388,15 +390,15 @@ void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, const FChun
 		const int32 ChunkIndex = Index / PerChunk;
 		const int32 InChunkIdx = Index % PerChunk;
 
-		uint8_t* Chunk = (*reinterpret_cast<uint8_t***>(ObjectsArray))[ChunkIndex];
+		uint8_t* Chunk = Memory::Read<uint8_t*>(Memory::Read<uint8_t**>(ObjectsArray) + ChunkIndex);
 		uint8_t* ItemPtr = reinterpret_cast<uint8_t*>(Chunk) + (InChunkIdx * FUObjectItemSize);
 
-		return *reinterpret_cast<void**>(ItemPtr + FUObjectItemOffset);
+		return Memory::Read<void*>(ItemPtr + FUObjectItemOffset);
 	};
 
-	uint8_t* ChunksPtr = DecryptPtr(*reinterpret_cast<uint8_t**>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
+	uint8_t* ChunksPtr = DecryptPtr(Memory::Read<uint8_t*>(GObjects + Off::FUObjectArray::GetObjectsOffset()));
 
-	ObjectArray::InitializeFUObjectItem(*reinterpret_cast<uint8_t**>(ChunksPtr));
+	ObjectArray::InitializeFUObjectItem(Memory::Read<uint8_t*>(ChunksPtr));
 }
 
 void ObjectArray::DumpObjects(const fs::path& Path, bool bWithPathname)
@@ -456,7 +458,7 @@ void ObjectArray::DumpObjectsWithProperties(const fs::path& Path, bool bWithPath
 
 int32 ObjectArray::Num()
 {
-	return *reinterpret_cast<int32*>(GObjects + Off::FUObjectArray::GetNumElementsOffset());
+	return Memory::Read<int32>(GObjects + Off::FUObjectArray::GetNumElementsOffset());
 }
 
 template<typename UEType>
@@ -553,6 +555,8 @@ UEObject ObjectArray::ObjectsIterator::operator*()
 
 ObjectArray::ObjectsIterator& ObjectArray::ObjectsIterator::operator++()
 {
+	DumpStats::Increment(DumpStats::ECounter::ObjectsVisited);
+
 	CurrentObject = ObjectArray::GetByIndex(++CurrentIndex);
 
 	while (!CurrentObject && CurrentIndex < (ObjectArray::Num() - 1))
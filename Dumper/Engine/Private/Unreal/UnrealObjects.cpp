@@ -4,6 +4,7 @@
 #include "Unreal/UnrealObjects.h"
 #include "Unreal/ObjectArray.h"
 #include "OffsetFinder/Offsets.h"
+#include "MemoryReader.h"
 
 
 void* UEFFieldClass::GetAddress()
@@ -18,22 +19,22 @@ UEFFieldClass::operator bool() const
 
 EFieldClassID UEFFieldClass::GetId() const
 {
-	return *reinterpret_cast<EFieldClassID*>(Class + Off::FFieldClass::Id);
+	return Memory::Read<EFieldClassID>(Class + Off::FFieldClass::Id);
 }
 
 EClassCastFlags UEFFieldClass::GetCastFlags() const
 {
-	return *reinterpret_cast<EClassCastFlags*>(Class + Off::FFieldClass::CastFlags);
+	return Memory::Read<EClassCastFlags>(Class + Off::FFieldClass::CastFlags);
 }
 
 EClassFlags UEFFieldClass::GetClassFlags() const
 {
-	return *reinterpret_cast<EClassFlags*>(Class + Off::FFieldClass::ClassFlags);
+	return Memory::Read<EClassFlags>(Class + Off::FFieldClass::ClassFlags);
 }
 
 UEFFieldClass UEFFieldClass::GetSuper() const
 {
-	return UEFFieldClass(*reinterpret_cast<void**>(Class + Off::FFieldClass::SuperClass));
+	return UEFFieldClass(Memory::Read<void*>(Class + Off::FFieldClass::SuperClass));
 }
 
 FName UEFFieldClass::GetFName() const
@@ -69,7 +70,7 @@ void* UEFField::GetAddress()
 
 EObjectFlags UEFField::GetFlags() const
 {
-	return *reinterpret_cast<EObjectFlags*>(Field + Off::FField::Flags);
+	return Memory::Read<EObjectFlags>(Field + Off::FField::Flags);
 }
 
 class UEObject UEFField::GetOwnerAsUObject() const
@@ -77,9 +78,9 @@ class UEObject UEFField::GetOwnerAsUObject() const
 	if (IsOwnerUObject())
 	{
 		if (Settings::Internal::bUseMaskForFieldOwner)
-			return (void*)(*reinterpret_cast<uintptr_t*>(Field + Off::FField::Owner) & ~0x1ull);
+			return (void*)(Memory::Read<uintptr_t>(Field + Off::FField::Owner) & ~0x1ull);
 
-		return *reinterpret_cast<void**>(Field + Off::FField::Owner);
+		return Memory::Read<void*>(Field + Off::FField::Owner);
 	}
 
 	return nullptr;
@@ -88,7 +89,7 @@ class UEObject UEFField::GetOwnerAsUObject() const
 class UEFField UEFField::GetOwnerAsFField() const
 {
 	if (!IsOwnerUObject())
-		return *reinterpret_cast<void**>(Field + Off::FField::Owner);
+		return Memory::Read<void*>(Field + Off::FField::Owner);
 
 	return nullptr;
 }
@@ -107,7 +108,7 @@ class UEObject UEFField::GetOwnerUObject() const
 
 UEFFieldClass UEFField::GetClass() const
 {
-	return UEFFieldClass(*reinterpret_cast<void**>(Field + Off::FField::Class));
+	return UEFFieldClass(Memory::Read<void*>(Field + Off::FField::Class));
 }
 
 FName UEFField::GetFName() const
@@ -117,7 +118,7 @@ FName UEFField::GetFName() const
 
 UEFField UEFField::GetNext() const
 {
-	return UEFField(*reinterpret_cast<void**>(Field + Off::FField::Next));
+	return UEFField(Memory::Read<void*>(Field + Off::FField::Next));
 }
 
 template<typename UEType>
@@ -130,10 +131,10 @@ bool UEFField::IsOwnerUObject() const
 {
 	if (Settings::Internal::bUseMaskForFieldOwner)
 	{
-		return *reinterpret_cast<uintptr_t*>(Field + Off::FField::Owner) & 0x1;
+		return Memory::Read<uintptr_t>(Field + Off::FField::Owner) & 0x1;
 	}
 
-	return *reinterpret_cast<bool*>(Field + Off::FField::Owner + 0x8);
+	return Memory::Read<bool>(Field + Off::FField::Owner + 0x8);
 }
 
 bool UEFField::IsA(EClassCastFlags Flags) const
@@ -199,22 +200,22 @@ void* UEObject::GetAddress()
 
 void* UEObject::GetVft() const
 {
-	return *reinterpret_cast<void**>(Object);
+	return Memory::Read<void*>(Object);
 }
 
 EObjectFlags UEObject::GetFlags() const
 {
-	return *reinterpret_cast<EObjectFlags*>(Object + Off::UObject::Flags);
+	return Memory::Read<EObjectFlags>(Object + Off::UObject::Flags);
 }
 
 int32 UEObject::GetIndex() const
 {
-	return *reinterpret_cast<int32*>(Object + Off::UObject::Index);
+	return Memory::Read<int32>(Object + Off::UObject::Index);
 }
 
 UEClass UEObject::GetClass() const
 {
-	return UEClass(*reinterpret_cast<void**>(Object + Off::UObject::Class));
+	return UEClass(Memory::Read<void*>(Object + Off::UObject::Class));
 }
 
 FName UEObject::GetFName() const
@@ -224,7 +225,7 @@ FName UEObject::GetFName() const
 
 UEObject UEObject::GetOuter() const
 {
-	return UEObject(*reinterpret_cast<void**>(Object + Off::UObject::Outer));
+	return UEObject(Memory::Read<void*>(Object + Off::UObject::Outer));
 }
 
 int32 UEObject::GetPackageIndex() const
@@ -417,7 +418,7 @@ void UEObject::ProcessEvent(UEFunction Func, void* Params)
 
 UEField UEField::GetNext() const
 {
-	return UEField(*reinterpret_cast<void**>(Object + Off::UField::Next));
+	return UEField(Memory::Read<void*>(Object + Off::UField::Next));
 }
 
 bool UEField::IsNextValid() const
@@ -518,27 +519,27 @@ std::string UEEnum::GetEnumTypeAsStr() const
 
 UEStruct UEStruct::GetSuper() const
 {
-	return UEStruct(*reinterpret_cast<void**>(Object + Off::UStruct::SuperStruct));
+	return UEStruct(Memory::Read<void*>(Object + Off::UStruct::SuperStruct));
 }
 
 UEField UEStruct::GetChild() const
 {
-	return UEField(*reinterpret_cast<void**>(Object + Off::UStruct::Children));
+	return UEField(Memory::Read<void*>(Object + Off::UStruct::Children));
 }
 
 UEFField UEStruct::GetChildProperties() const
 {
-	return UEFField(*reinterpret_cast<void**>(Object + Off::UStruct::ChildProperties));
+	return UEFField(Memory::Read<void*>(Object + Off::UStruct::ChildProperties));
 }
 
 int32 UEStruct::GetMinAlignment() const
 {
-	return *reinterpret_cast<int32*>(Object + Off::UStruct::MinAlignemnt);
+	return Memory::Read<int32>(Object + Off::UStruct::MinAlignemnt);
 }
 
 int32 UEStruct::GetStructSize() const
 {
-	return *reinterpret_cast<int32*>(Object + Off::UStruct::Size);
+	return Memory::Read<int32>(Object + Off::UStruct::Size);
 }
 
 bool UEStruct::HasType(UEStruct Type) const
@@ -646,7 +647,7 @@ bool UEStruct::HasMembers() const
 
 EClassCastFlags UEClass::GetCastFlags() const
 {
-	return *reinterpret_cast<EClassCastFlags*>(Object + Off::UClass::CastFlags);
+	return Memory::Read<EClassCastFlags>(Object + Off::UClass::CastFlags);
 }
 
 std::string UEClass::StringifyCastFlags() const
@@ -661,7 +662,7 @@ bool UEClass::IsType(EClassCastFlags TypeFlag) const
 
 UEObject UEClass::GetDefaultObject() const
 {
-	return UEObject(*reinterpret_cast<void**>(Object + Off::UClass::ClassDefaultObject));
+	return UEObject(Memory::Read<void*>(Object + Off::UClass::ClassDefaultObject));
 }
 
 TArray<FImplementedInterface> UEClass::GetImplementedInterfaces() const
@@ -691,7 +692,7 @@ UEFunction UEClass::GetFunction(const std::string& ClassName, const std::string&
 
 EFunctionFlags UEFunction::GetFunctionFlags() const
 {
-	return *reinterpret_cast<EFunctionFlags*>(Object + Off::UFunction::FunctionFlags);
+	return Memory::Read<EFunctionFlags>(Object + Off::UFunction::FunctionFlags);
 }
 
 bool UEFunction::HasFlags(EFunctionFlags FuncFlags) const
@@ -701,7 +702,7 @@ bool UEFunction::HasFlags(EFunctionFlags FuncFlags) const
 
 void* UEFunction::GetExecFunction() const
 {
-	return *reinterpret_cast<void**>(Object + Off::UFunction::ExecFunction);
+	return Memory::Read<void*>(Object + Off::UFunction::ExecFunction);
 }
 
 UEProperty UEFunction::GetReturnProperty() const
@@ -774,22 +775,22 @@ FName UEProperty::GetFName() const
 
 int32 UEProperty::GetArrayDim() const
 {
-	return *reinterpret_cast<int32*>(Base + Off::Property::ArrayDim);
+	return Memory::Read<int32>(Base + Off::Property::ArrayDim);
 }
 
 int32 UEProperty::GetSize() const
 {
-	return *reinterpret_cast<int32*>(Base + Off::Property::ElementSize);
+	return Memory::Read<int32>(Base + Off::Property::ElementSize);
 }
 
 int32 UEProperty::GetOffset() const
 {
-	return *reinterpret_cast<int32*>(Base + Off::Property::Offset_Internal);
+	return Memory::Read<int32>(Base + Off::Property::Offset_Internal);
 }
 
 EPropertyFlags UEProperty::GetPropertyFlags() const
 {
-	return *reinterpret_cast<EPropertyFlags*>(Base + Off::Property::PropertyFlags);
+	return Memory::Read<EPropertyFlags>(Base + Off::Property::PropertyFlags);
 }
 
 bool UEProperty::HasPropertyFlags(EPropertyFlags PropertyFlag) const
@@ -1127,7 +1128,7 @@ std::string UEProperty::StringifyFlags() const
 
 UEEnum UEByteProperty::GetEnum() const
 {
-	return UEEnum(*reinterpret_cast<void**>(Base + Off::ByteProperty::Enum));
+	return UEEnum(Memory::Read<void*>(Base + Off::ByteProperty::Enum));
 }
 
 std::string UEByteProperty::GetCppType() const
@@ -1142,7 +1143,7 @@ std::string UEByteProperty::GetCppType() const
 
 uint8 UEBoolProperty::GetFieldMask() const
 {
-	return reinterpret_cast<Off::BoolProperty::UBoolPropertyBase*>(Base + Off::BoolProperty::Base)->FieldMask;
+	return Memory::Read<Off::BoolProperty::UBoolPropertyBase>(Base + Off::BoolProperty::Base).FieldMask;
 }
 
 uint8 UEBoolProperty::GetBitIndex() const
@@ -1166,7 +1167,7 @@ uint8 UEBoolProperty::GetBitIndex() const
 
 bool UEBoolProperty::IsNativeBool() const
 {
-	return reinterpret_cast<Off::BoolProperty::UBoolPropertyBase*>(Base + Off::BoolProperty::Base)->FieldMask == 0xFF;
+	return Memory::Read<Off::BoolProperty::UBoolPropertyBase>(Base + Off::BoolProperty::Base).FieldMask == 0xFF;
 }
 
 std::string UEBoolProperty::GetCppType() const
@@ -1176,7 +1177,7 @@ std::string UEBoolProperty::GetCppType() const
 
 UEClass UEObjectProperty::GetPropertyClass() const
 {
-	return UEClass(*reinterpret_cast<void**>(Base + Off::ObjectProperty::PropertyClass));
+	return UEClass(Memory::Read<void*>(Base + Off::ObjectProperty::PropertyClass));
 }
 
 std::string UEObjectProperty::GetCppType() const
@@ -1186,7 +1187,7 @@ std::string UEObjectProperty::GetCppType() const
 
 UEClass UEClassProperty::GetMetaClass() const
 {
-	return UEClass(*reinterpret_cast<void**>(Base + Off::ClassProperty::MetaClass));
+	return UEClass(Memory::Read<void*>(Base + Off::ClassProperty::MetaClass));
 }
 
 std::string UEClassProperty::GetCppType() const
@@ -1221,7 +1222,7 @@ std::string UEInterfaceProperty::GetCppType() const
 
 UEStruct UEStructProperty::GetUnderlayingStruct() const
 {
-	return UEStruct(*reinterpret_cast<void**>(Base + Off::StructProperty::Struct));
+	return UEStruct(Memory::Read<void*>(Base + Off::StructProperty::Struct));
 }
 
 std::string UEStructProperty::GetCppType() const
@@ -1231,7 +1232,7 @@ std::string UEStructProperty::GetCppType() const
 
 UEProperty UEArrayProperty::GetInnerProperty() const
 {
-	return UEProperty(*reinterpret_cast<void**>(Base + Off::ArrayProperty::Inner));
+	return UEProperty(Memory::Read<void*>(Base + Off::ArrayProperty::Inner));
 }
 
 std::string UEArrayProperty::GetCppType() const
@@ -1241,7 +1242,7 @@ std::string UEArrayProperty::GetCppType() const
 
 UEFunction UEDelegateProperty::GetSignatureFunction() const
 {
-	return UEFunction(*reinterpret_cast<void**>(Base + Off::DelegateProperty::SignatureFunction));
+	return UEFunction(Memory::Read<void*>(Base + Off::DelegateProperty::SignatureFunction));
 }
 
 std::string UEDelegateProperty::GetCppType() const
@@ -1252,7 +1253,7 @@ std::string UEDelegateProperty::GetCppType() const
 UEFunction UEMulticastInlineDelegateProperty::GetSignatureFunction() const
 {
 	// Uses "Off::DelegateProperty::SignatureFunction" on purpose
-	return UEFunction(*reinterpret_cast<void**>(Base + Off::DelegateProperty::SignatureFunction));
+	return UEFunction(Memory::Read<void*>(Base + Off::DelegateProperty::SignatureFunction));
 }
 
 std::string UEMulticastInlineDelegateProperty::GetCppType() const
@@ -1262,12 +1263,12 @@ std::string UEMulticastInlineDelegateProperty::GetCppType() const
 
 UEProperty UEMapProperty::GetKeyProperty() const
 {
-	return UEProperty(reinterpret_cast<Off::MapProperty::UMapPropertyBase*>(Base + Off::MapProperty::Base)->KeyProperty);
+	return UEProperty(Memory::Read<Off::MapProperty::UMapPropertyBase>(Base + Off::MapProperty::Base).KeyProperty);
 }
 
 UEProperty UEMapProperty::GetValueProperty() const
 {
-	return UEProperty(reinterpret_cast<Off::MapProperty::UMapPropertyBase*>(Base + Off::MapProperty::Base)->ValueProperty);
+	return UEProperty(Memory::Read<Off::MapProperty::UMapPropertyBase>(Base + Off::MapProperty::Base).ValueProperty);
 }
 
 std::string UEMapProperty::GetCppType() const
@@ -1277,7 +1278,7 @@ std::string UEMapProperty::GetCppType() const
 
 UEProperty UESetProperty::GetElementProperty() const
 {
-	return UEProperty(*reinterpret_cast<void**>(Base + Off::SetProperty::ElementProp));
+	return UEProperty(Memory::Read<void*>(Base + Off::SetProperty::ElementProp));
 }
 
 std::string UESetProperty::GetCppType() const
@@ -1287,12 +1288,12 @@ std::string UESetProperty::GetCppType() const
 
 UEProperty UEEnumProperty::GetUnderlayingProperty() const
 {
-	return UEProperty(reinterpret_cast<Off::EnumProperty::UEnumPropertyBase*>(Base + Off::EnumProperty::Base)->UnderlayingProperty);
+	return UEProperty(Memory::Read<Off::EnumProperty::UEnumPropertyBase>(Base + Off::EnumProperty::Base).UnderlayingProperty);
 }
 
 UEEnum UEEnumProperty::GetEnum() const
 {
-	return UEEnum(reinterpret_cast<Off::EnumProperty::UEnumPropertyBase*>(Base + Off::EnumProperty::Base)->Enum);
+	return UEEnum(Memory::Read<Off::EnumProperty::UEnumPropertyBase>(Base + Off::EnumProperty::Base).Enum);
 }
 
 std::string UEEnumProperty::GetCppType() const
@@ -1305,7 +1306,7 @@ std::string UEEnumProperty::GetCppType() const
 
 UEFFieldClass UEFieldPathProperty::GetFielClass() const
 {
-	return UEFFieldClass(*reinterpret_cast<void**>(Base + Off::FieldPathProperty::FieldClass));
+	return UEFFieldClass(Memory::Read<void*>(Base + Off::FieldPathProperty::FieldClass));
 }
 
 std::string UEFieldPathProperty::GetCppType() const
@@ -1315,7 +1316,7 @@ std::string UEFieldPathProperty::GetCppType() const
 
 UEProperty UEOptionalProperty::GetValueProperty() const
 {
-	return UEProperty(*reinterpret_cast<void**>(Base + Off::OptionalProperty::ValueProperty));
+	return UEProperty(Memory::Read<void*>(Base + Off::OptionalProperty::ValueProperty));
 }
 
 std::string UEOptionalProperty::GetCppType() const
@@ -1,12 +1,42 @@
 
 #include <format>
+#include <emmintrin.h>
 
 #include "Unreal/UnrealTypes.h"
 #include "Unreal/NameArray.h"
 
 #include "Encoding/UnicodeNames.h"
+#include "Stats/DumpStats.h"
 
 
+/* Checks if a string contains only ASCII characters. Uses SSE2 to check 8 UTF-16 characters at once. */
+static bool IsAsciiOnly(const wchar_t* Str, size_t Length)
+{
+	size_t i = 0;
+
+	if constexpr (sizeof(wchar_t) == sizeof(uint16))
+	{
+		const __m128i NonAsciiBits = _mm_set1_epi16(static_cast<int16>(0xFF80));
+		__m128i CombinedChars = _mm_setzero_si128();
+
+		for (; (i + 8) <= Length; i += 8)
+			CombinedChars = _mm_or_si128(CombinedChars, _mm_loadu_si128(reinterpret_cast<const __m128i*>(Str + i)));
+
+		const __m128i NonAsciiChars = _mm_and_si128(CombinedChars, NonAsciiBits);
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(NonAsciiChars, _mm_setzero_si128())) != 0xFFFF)
+			return false;
+	}
+
+	for (; i < Length; i++)
+	{
+		if (static_cast<uint32>(Str[i]) >= 0x80)
+			return false;
+	}
+
+	return true;
+}
+
 std::string MakeNameValid(std::wstring&& Name)
 {
 	static constexpr const wchar_t* Numbers[10] =
@@ -34,6 +64,17 @@ std::string MakeNameValid(std::wstring&& Name)
 	{
 		Name.replace(0, 1, Numbers[Name[0] - '0']);
 	}
+
+	/* Fast path for the vast majority of names, ASCII characters are checked with a table and written to the output directly */
+	if (IsAsciiOnly(Name.data(), Name.size())) [[likely]]
+	{
+		std::string AsciiName(Name.size(), '\0');
+
+		for (size_t i = 0; i < Name.size(); i++)
+			AsciiName[i] = AsciiXIDContinueTable[Name[i]] ? static_cast<char>(Name[i]) : '_';
+
+		return AsciiName;
+	}
 	
 	std::u32string Strrr;
 	Strrr += UtfN::utf_cp32_t{ 200 };
@@ -210,6 +251,8 @@ std::wstring FName::ToRawWString() const
 	if (!Address)
 		return L"None";
 
+	DumpStats::Increment(DumpStats::ECounter::FNameToStringCalls);
+
 	return ToStr(Address);
 }
 
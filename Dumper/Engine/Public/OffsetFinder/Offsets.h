@@ -48,7 +48,9 @@ namespace Off
 		namespace World
 		{
 			inline int32 GWorld = 0x0;
+			inline int32 GEngine = 0x0;
 
+			/* Finds GWorld and GEngine, both are looked up in a single index of the pointers stored in .data */
 			void InitGWorld();
 		}
 
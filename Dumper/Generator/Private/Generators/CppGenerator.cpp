@@ -1,6 +1,7 @@
 
 #include <vector>
 #include <array>
+#include <set>
 
 #include "Unreal/ObjectArray.h"
 #include "Generators/CppGenerator.h"
@@ -26,6 +27,20 @@ constexpr std::string GetTypeFromSize(uint8 Size)
 	}
 }
 
+static std::string PrefixQuotsWithBackslash(std::string&& Str)
+{
+	for (int i = 0; i < Str.size(); i++)
+	{
+		if (Str[i] == '"')
+		{
+			Str.insert(i, "\\");
+			i++;
+		}
+	}
+
+	return Str;
+}
+
 std::string CppGenerator::MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment)
 {
 	//<tab><--45 chars--><-------50 chars----->
@@ -292,7 +307,7 @@ CppGenerator::FunctionInfo CppGenerator::GenerateFunctionInfo(const FunctionWrap
 	return RetFuncInfo;
 }
 
-std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile)
+std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile, const std::string& FunctionTableName, int32 FunctionTableIndex)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
@@ -405,23 +420,25 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 
 	const bool bIsNativeFunc = Func.HasFunctionFlag(EFunctionFlags::Native);
 
-	static auto PrefixQuotsWithBackslash = [](std::string&& Str) -> std::string
-	{
-		for (int i = 0; i < Str.size(); i++)
-		{
-			if (Str[i] == '"')
-			{
-				Str.insert(i, "\\");
-				i++;
-			}
-		}
+	/* RPCs and events need ProcessEvent to be routed to the correct implementation, calling their exec-thunk directly would bypass that */
+	const bool bCallNativeThunk = CppSettings::bUseNativeThunkCalls && bIsNativeFunc && !Func.HasFunctionFlag(EFunctionFlags::Net)
+		&& !Func.HasFunctionFlag(EFunctionFlags::Event) && !Func.HasFunctionFlag(EFunctionFlags::BlueprintEvent);
 
-		return Str;
-	};
+	const char* CallContextString = Func.IsStatic() ? "GetDefaultObj()" : Func.IsInInterface() ? "AsUObject()" : "this";
+
+	std::string FunctionCallString = bCallNativeThunk
+		? std::format("BasicFilesImpleUtils::CallNativeFunction({}, Func, {}, {});", CallContextString, bHasParams ? "&Parms" : "nullptr", !FuncInfo.bIsReturningVoid ? "&Parms.ReturnValue" : "nullptr")
+		: std::format("{}ProcessEvent(Func, {});", Func.IsStatic() ? "GetDefaultObj()->" : Func.IsInInterface() ? "AsUObject()->" : "UObject::", bHasParams ? "&Parms" : "nullptr");
 
 	std::string FixedOuterName = PrefixQuotsWithBackslash(UnrealFunc.GetOuter().GetName());
 	std::string FixedFunctionName = PrefixQuotsWithBackslash(UnrealFunc.GetName());
 
+	/* Look the function up in the table shared by all functions of this class, falling back to a lookup by name if the table couldn't be resolved */
+	std::string FunctionTableLookupString = !FunctionTableName.empty() ? std::format(R"(
+	if (Func == nullptr)
+		Func = {}.Get(0x{:X});
+)", FunctionTableName, FunctionTableIndex) : "";
+
 	// Function implementation generation
 	std::string FunctionImplementation = std::format(R"(
 // {}
@@ -430,11 +447,11 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 {} {}::{}{}
 {{
 	static class UFunction* Func = nullptr;
-
+{}
 	if (Func == nullptr)
 		Func = {}->GetFunction("{}", "{}");
 {}{}{}
-	{}ProcessEvent(Func, {});{}{}{}{}
+	{}{}{}{}{}
 }}
 
 )", UnrealFunc.GetFullName()
@@ -444,15 +461,15 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 , StructName
 , FuncInfo.FuncNameWithParams
 , bIsConstFunc ? " const" : ""
+, FunctionTableLookupString
 , Func.IsStatic() ? "StaticClass()" : Func.IsInInterface() ? "AsUObject()->Class" : "Class"
 , FixedOuterName
 , FixedFunctionName
 , bHasParams ? ParamVarCreationString : ""
 , bHasParamsToInit ? ParamAssignments : ""
-, bIsNativeFunc ? StoreFunctionFlagsString : ""
-, Func.IsStatic() ? "GetDefaultObj()->" : Func.IsInInterface() ? "AsUObject()->" : "UObject::"
-, bHasParams ? "&Parms" : "nullptr"
-, bIsNativeFunc ? RestoreFunctionFlagsString : ""
+, bIsNativeFunc && !bCallNativeThunk ? StoreFunctionFlagsString : ""
+, FunctionCallString
+, bIsNativeFunc && !bCallNativeThunk ? RestoreFunctionFlagsString : ""
 , bHasOutRefParamsToInit ? OutRefAssignments : ""
 , bHasOutPtrParamsToInit ? OutPtrAssignments : ""
 , !FuncInfo.bIsReturningVoid ? ReturnValueString : "");
@@ -532,6 +549,45 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 
 	const bool bIsInterface = Struct.IsInterface();
 
+	/* Only classes with a 'StaticClass' function can resolve their functions through a shared table */
+	const bool bHasStaticClass = Struct.IsUnrealStruct() && Struct.IsClass() && Struct.GetSuper().IsValid();
+
+	/* Sorted names of all functions in the table of this class, used for a binary search when resolving the table */
+	std::vector<std::string> FunctionTableNames;
+
+	if (bHasStaticClass)
+	{
+		for (const FunctionWrapper& Func : Members.IterateFunctions())
+		{
+			if (!Func.IsPredefined() && !(Func.GetFunctionFlags() & EFunctionFlags::Delegate))
+				FunctionTableNames.push_back(Func.GetUnrealFunction().GetName());
+		}
+
+		std::sort(FunctionTableNames.begin(), FunctionTableNames.end());
+	}
+
+	/* 'StructName' might be "Package::UClassName", the tables are prefixed with the package-name to keep them unique in unity-builds */
+	const std::string FunctionTablePrefix = !FunctionTableNames.empty() ? PackageManager::GetName(Struct.GetUnrealStruct().GetPackageIndex()) + "_" + Struct.GetUniqueName().first : "";
+	const std::string FunctionTableName = !FunctionTableNames.empty() ? FunctionTablePrefix + "_FunctionTable" : "";
+
+	if (!FunctionTableNames.empty())
+	{
+		std::string NamesString;
+
+		for (const std::string& FuncName : FunctionTableNames)
+			NamesString += std::format("\t\"{}\",\n", PrefixQuotsWithBackslash(std::string(FuncName)));
+
+		FunctionFile << std::format(R"(
+// Functions of '{0}' called by the SDK, resolved in a single pass over 'Children' on first use
+static const char* const {4}_FunctionNames[0x{2:X}] =
+{{
+{3}}};
+
+static TFunctionTable<0x{2:X}> {1}(&{0}::StaticClass, {4}_FunctionNames);
+
+)", StructName, FunctionTableName, FunctionTableNames.size(), NamesString, FunctionTablePrefix);
+	}
+
 	for (const FunctionWrapper& Func : Members.IterateFunctions())
 	{
 		/* The function is no callable function, but instead just the signature of a TDelegate or TMulticastInlineDelegate */
@@ -554,11 +610,20 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 		bIsFirstIteration = false;
 		bDidSwitch = false;
 
-		InHeaderFunctionText += GenerateSingleFunction(Func, StructName, FunctionFile, ParamFile);
+		if (FunctionTableName.empty() || Func.IsPredefined())
+		{
+			InHeaderFunctionText += GenerateSingleFunction(Func, StructName, FunctionFile, ParamFile);
+			continue;
+		}
+
+		const auto TableIt = std::lower_bound(FunctionTableNames.begin(), FunctionTableNames.end(), Func.GetUnrealFunction().GetName());
+		const int32 FunctionTableIndex = static_cast<int32>(TableIt - FunctionTableNames.begin());
+
+		InHeaderFunctionText += GenerateSingleFunction(Func, StructName, FunctionFile, ParamFile, FunctionTableName, FunctionTableIndex);
 	}
 
 	/* Skip predefined classes, all structs and classes which don't inherit from UObject (very rare). */
-	if (!Struct.IsUnrealStruct() || !Struct.IsClass() || !Struct.GetSuper().IsValid())
+	if (!bHasStaticClass)
 		return InHeaderFunctionText;
 
 	/* Special spacing for UClass specific functions 'StaticClass' and 'GetDefaultObj' */
@@ -713,6 +778,13 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 	if (bHasReusedTrailingPadding)
 		StructFile << "#pragma pack(pop)\n";
 
+	/* Assertions of package structs are written to "PackageName_assertions.cpp" instead, see GeneratePackageAssertions() */
+	if constexpr (Settings::Debug::bMoveInlineAssertionsToPackageFiles)
+	{
+		if (PackageIndex != -1)
+			return;
+	}
+
 	if constexpr (Settings::Debug::bGenerateInlineAssertionsForStructSize)
 	{
 		if (Struct.HasCustomTemplateText())
@@ -884,13 +956,35 @@ std::string CppGenerator::GetMemberTypeString(UEProperty Member, int32 PackageIn
 
 std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex)
 {
-	auto [Class, FieldClass] = Member.GetClass();
+	return GetTypeString(TypeManager::GetInfo(Member), PackageIndex);
+}
+
+std::string CppGenerator::GetTypeString(TypeInfoHandle Type, int32 PackageIndex)
+{
+	/* Types containing structs which are cyclic with the current package require a fixup-type and can't be cached */
+	if (PackageIndex != -1 && Type.MayBeCyclic()) [[unlikely]]
+		return GenerateTypeString(Type, PackageIndex);
+
+	if (CachedTypeStrings.size() < TypeManager::GetNumTypes())
+		CachedTypeStrings.resize(TypeManager::GetNumTypes());
+
+	if (!CachedTypeStrings[Type.GetIndex()].empty()) [[likely]]
+		return CachedTypeStrings[Type.GetIndex()];
+
+	/* Don't hold a reference into the cache, generating the string of inner types can add new entries to it */
+	std::string TypeString = GenerateTypeString(Type, -1);
+	CachedTypeStrings[Type.GetIndex()] = TypeString;
 
-	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+	return TypeString;
+}
+
+std::string CppGenerator::GenerateTypeString(TypeInfoHandle Type, int32 PackageIndex)
+{
+	const EClassCastFlags Flags = Type.GetCastFlags();
 
 	if (Flags & EClassCastFlags::ByteProperty)
 	{
-		if (UEEnum Enum = Member.Cast<UEByteProperty>().GetEnum())
+		if (UEEnum Enum = Type.GetReferencedObject<UEEnum>())
 			return GetEnumPrefixedName(Enum);
 
 		return "uint8";
@@ -933,8 +1027,8 @@ std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int
 	}
 	else if (Flags & EClassCastFlags::ClassProperty)
 	{
-		if (Member.HasPropertyFlags(EPropertyFlags::UObjectWrapper))
-			return std::format("TSubclassOf<class {}>", GetStructPrefixedName(Member.Cast<UEClassProperty>().GetMetaClass()));
+		if (Type.HasTypeModifier())
+			return std::format("TSubclassOf<class {}>", GetStructPrefixedName(Type.GetReferencedObject<UEClass>()));
 
 		return "class UClass*";
 	}
@@ -952,11 +1046,11 @@ std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int
 	}
 	else if (Flags & EClassCastFlags::BoolProperty)
 	{
-		return Member.Cast<UEBoolProperty>().IsNativeBool() ? "bool" : "uint8";
+		return Type.HasTypeModifier() ? "bool" : "uint8";
 	}
 	else if (Flags & EClassCastFlags::StructProperty)
 	{
-		const StructWrapper& UnderlayingStruct = Member.Cast<UEStructProperty>().GetUnderlayingStruct();
+		const StructWrapper& UnderlayingStruct = Type.GetReferencedObject<UEStruct>();
 
 		if (UnderlayingStruct.IsCyclicWithPackage(PackageIndex)) [[unlikely]]
 			return std::format("{}", GetCycleFixupType(UnderlayingStruct, false));
@@ -965,99 +1059,95 @@ std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int
 	}
 	else if (Flags & EClassCastFlags::ArrayProperty)
 	{
-		return std::format("TArray<{}>", GetMemberTypeStringWithoutConst(Member.Cast<UEArrayProperty>().GetInnerProperty(), PackageIndex));
+		return std::format("TArray<{}>", GetTypeString(Type.GetInnerType(), PackageIndex));
 	}
 	else if (Flags & EClassCastFlags::WeakObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UEWeakObjectProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 			return std::format("TWeakObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TWeakObjectPtr<class UObject>";
 	}
 	else if (Flags & EClassCastFlags::LazyObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UELazyObjectProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 			return std::format("TLazyObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TLazyObjectPtr<class UObject>";
 	}
 	else if (Flags & EClassCastFlags::SoftClassProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UESoftClassProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 			return std::format("TSoftClassPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TSoftClassPtr<class UObject>";
 	}
 	else if (Flags & EClassCastFlags::SoftObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UESoftObjectProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 			return std::format("TSoftObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TSoftObjectPtr<class UObject>";
 	}
 	else if (Flags & EClassCastFlags::ObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 			return std::format("class {}*", GetStructPrefixedName(PropertyClass));
 
 		return "class UObject*";
 	}
 	else if (Flags & EClassCastFlags::MapProperty)
 	{
-		UEMapProperty MemberAsMapProperty = Member.Cast<UEMapProperty>();
-
-		return std::format("TMap<{}, {}>", GetMemberTypeStringWithoutConst(MemberAsMapProperty.GetKeyProperty(), PackageIndex), GetMemberTypeStringWithoutConst(MemberAsMapProperty.GetValueProperty(), PackageIndex));
+		return std::format("TMap<{}, {}>", GetTypeString(Type.GetInnerType(0), PackageIndex), GetTypeString(Type.GetInnerType(1), PackageIndex));
 	}
 	else if (Flags & EClassCastFlags::SetProperty)
 	{
-		return std::format("TSet<{}>", GetMemberTypeStringWithoutConst(Member.Cast<UESetProperty>().GetElementProperty(), PackageIndex));
+		return std::format("TSet<{}>", GetTypeString(Type.GetInnerType(), PackageIndex));
 	}
 	else if (Flags & EClassCastFlags::EnumProperty)
 	{
-		if (UEEnum Enum = Member.Cast<UEEnumProperty>().GetEnum())
+		if (UEEnum Enum = Type.GetReferencedObject<UEEnum>())
 			return GetEnumPrefixedName(Enum);
 
-		return GetMemberTypeStringWithoutConst(Member.Cast<UEEnumProperty>().GetUnderlayingProperty(), PackageIndex);
+		return GetTypeString(Type.GetInnerType(), PackageIndex);
 	}
 	else if (Flags & EClassCastFlags::InterfaceProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UEInterfaceProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 			return std::format("TScriptInterface<class {}>", GetStructPrefixedName(PropertyClass));
 
 		return "TScriptInterface<class IInterface>";
 	}
 	else if (Flags & EClassCastFlags::DelegateProperty)
 	{
-		if (UEFunction SignatureFunc = Member.Cast<UEDelegateProperty>().GetSignatureFunction()) [[likely]]
+		if (UEFunction SignatureFunc = Type.GetReferencedObject<UEFunction>()) [[likely]]
 			return std::format("TDelegate<{}>", GetFunctionSignature(SignatureFunc));
 
 		return "TDelegate<void()>";
 	}
 	else if (Flags & EClassCastFlags::MulticastInlineDelegateProperty)
 	{
-		if (UEFunction SignatureFunc = Member.Cast<UEMulticastInlineDelegateProperty>().GetSignatureFunction()) [[likely]]
+		if (UEFunction SignatureFunc = Type.GetReferencedObject<UEFunction>()) [[likely]]
 			return std::format("TMulticastInlineDelegate<{}>", GetFunctionSignature(SignatureFunc));
 
 		return "TMulticastInlineDelegate<void()>";
 	}
 	else if (Flags & EClassCastFlags::FieldPathProperty)
 	{
-		return std::format("TFieldPath<class {}>", Member.Cast<UEFieldPathProperty>().GetFielClass().GetCppName());
+		return std::format("TFieldPath<class {}>", UEFFieldClass(const_cast<void*>(Type.GetReferencedFieldClassAddress())).GetCppName());
 	}
 	else if (Flags & EClassCastFlags::OptionalProperty)
 	{
-		UEProperty ValueProperty = Member.Cast<UEOptionalProperty>().GetValueProperty();
-
 		/* Check if there is an additional 'bool' flag in the TOptional to check if the value is set */
-		if (Member.GetSize() > ValueProperty.GetSize()) [[likely]]
-			return std::format("TOptional<{}>", GetMemberTypeStringWithoutConst(ValueProperty, PackageIndex));
+		if (Type.HasTypeModifier()) [[likely]]
+			return std::format("TOptional<{}>", GetTypeString(Type.GetInnerType(), PackageIndex));
 
-		return std::format("TOptional<{}, true>", GetMemberTypeStringWithoutConst(ValueProperty, PackageIndex));
+		return std::format("TOptional<{}, true>", GetTypeString(Type.GetInnerType(), PackageIndex));
 	}
 	else
 	{
 		/* When changing this also change 'GetUnknownProperties()' */
-		return (Class ? Class.GetCppName() : FieldClass.GetCppName()) + "_";
+		return Type.GetPropertyClassCppName() + "_";
 	}
 }
 
@@ -1258,34 +1348,8 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 	{
 		DependencyManager::OnVisitCallbackType GenerateStructAssertionsCallback = [&AssertionStream](int32 Index) -> void
 		{
-			StructWrapper Struct = ObjectArray::GetByIndex<UEStruct>(Index);
-
-			std::string UniquePrefixedName = GetStructPrefixedName(Struct);
-
-			AssertionStream << std::format("// {} {}\n", (Struct.IsClass() ? "class" : "struct"), UniquePrefixedName);
-
-			// Alignment assertions
-			AssertionStream << std::format("static_assert(alignof({}) == 0x{:06X});\n", UniquePrefixedName, Struct.GetAlignment());
-
-			const int32 StructSize = Struct.GetSize();
-
-			// Size assertions
-			AssertionStream << std::format("static_assert(sizeof({}) == 0x{:06X});\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1));
-
-			AssertionStream << "\n";
-
-			// Member offset assertions
-			MemberManager Members = Struct.GetMembers();
-
-			for (const PropertyWrapper& Member : Members.IterateMembers())
-			{
-				if (Member.IsStatic() || Member.IsZeroSizedMember() || Member.IsBitField())
-					continue;
-
-				AssertionStream << std::format("static_assert(offsetof({}, {}) == 0x{:06X});\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
-			}
-
-			AssertionStream << "\n\n";
+			if (IsReachable(Index))
+				GenerateStructAssertions(ObjectArray::GetByIndex<UEStruct>(Index), AssertionStream);
 		};
 
 		if (Package.HasStructs())
@@ -1306,1201 +1370,2300 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 	WriteFileEnd(AssertionStream, EFileType::DebugAssertions);
 }
 
-void CppGenerator::GenerateSDKHeader(StreamType& SdkHpp)
+void CppGenerator::GenerateStructAssertions(const StructWrapper& Struct, StreamType& AssertionStream, bool bAssertSize, bool bAssertMembers)
 {
-	WriteFileHead(SdkHpp, nullptr, EFileType::SdkHpp, "Includes the entire SDK. Include files directly for faster compilation!");
+	std::string UniquePrefixedName = GetStructPrefixedName(Struct);
 
+	AssertionStream << std::format("// {} {}\n", (Struct.IsClass() ? "class" : "struct"), UniquePrefixedName);
 
-	auto ForEachElementCallback = [&SdkHpp](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+	if (bAssertSize)
 	{
-		PackageInfoHandle CurrentPackage = PackageManager::GetInfo(NewParams.RequiredPackage);
+		// Alignment assertions
+		AssertionStream << std::format("static_assert(alignof({}) == 0x{:06X});\n", UniquePrefixedName, Struct.GetAlignment());
 
-		const bool bHasClassesFile = CurrentPackage.HasClasses();
-		const bool bHasStructsFile = (CurrentPackage.HasStructs() || CurrentPackage.HasEnums());
+		const int32 StructSize = Struct.GetSize();
 
-		if (bIsStruct && bHasStructsFile)
-			SdkHpp << std::format("#include \"SDK/{}_structs.hpp\"\n", CurrentPackage.GetName());
+		// Size assertions
+		AssertionStream << std::format("static_assert(sizeof({}) == 0x{:06X});\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1));
 
-		if (!bIsStruct && bHasClassesFile)
-			SdkHpp << std::format("#include \"SDK/{}_classes.hpp\"\n", CurrentPackage.GetName());
-	};
+		AssertionStream << "\n";
+	}
 
-	PackageManager::IterateDependencies(ForEachElementCallback);
+	if (bAssertMembers)
+	{
+		// Member offset assertions
+		MemberManager Members = Struct.GetMembers();
+
+		for (const PropertyWrapper& Member : Members.IterateMembers())
+		{
+			if (Member.IsStatic() || Member.IsZeroSizedMember() || Member.IsBitField())
+				continue;
 
+			AssertionStream << std::format("static_assert(offsetof({}, {}) == 0x{:06X});\n", UniquePrefixedName, Member.GetName(), Member.GetOffset());
+		}
+	}
 
-	WriteFileEnd(SdkHpp, EFileType::SdkHpp);
+	AssertionStream << "\n\n";
 }
 
-void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment, const std::string& CustomIncludes)
+void CppGenerator::GeneratePackageAssertions(PackageInfoHandle Package, const PackageContent& Content)
 {
-	namespace CppSettings = Settings::CppGenerator;
-
-	/* Write the utf8 BOM to indicate that this is a utf8 encoded file. */
-	File << "\xEF\xBB\xBF";
+	constexpr bool bAssertSize = Settings::Debug::bGenerateInlineAssertionsForStructSize;
+	constexpr bool bAssertMembers = Settings::Debug::bGenerateInlineAssertionsForStructMembers;
 
-	File << R"(#pragma once
+	if (!bAssertSize && !bAssertMembers)
+		return;
 
-/*
-* SDK generated by Dumper-7
-*
-* https://github.com/Encryqed/Dumper-7
-*/
-)";
+	if (!Content.bHasStructs && !Content.bHasClasses)
+		return;
 
-	if (Type == EFileType::SdkHpp)
-		File << std::format("\n// {}\n// {}\n", Settings::Generator::GameName, Settings::Generator::GameVersion);
-	
+	const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
+	const std::string AssertionsFileName = FileName + "_assertions.cpp";
 
-	File << std::format("\n// {}\n\n", Package.IsValidHandle() ? std::format("Package: {}", Package.GetName()) : CustomFileComment);
+	StreamType AssertionsFile(Subfolder / reinterpret_cast<const std::u8string&>(AssertionsFileName));
 
+	if (!AssertionsFile.is_open())
+		std::cout << "Error opening file \"" << AssertionsFileName << "\"" << std::endl;
 
-	if (!CustomIncludes.empty())
-		File << CustomIncludes + "\n";
+	std::string Includes;
 
-	if (Type != EFileType::BasicHpp && Type != EFileType::NameCollisionsInl && Type != EFileType::PropertyFixup && Type != EFileType::SdkHpp && Type != EFileType::DebugAssertions && Type != EFileType::UnrealContainers && Type != EFileType::UnicodeLib)
-		File << "#include \"Basic.hpp\"\n";
+	if (Content.bHasStructs || Content.bHasEnums)
+		Includes += std::format("#include \"{}_structs.hpp\"\n", FileName);
 
-	if (Type == EFileType::SdkHpp)
-		File << "#include \"SDK/Basic.hpp\"\n";
+	if (Content.bHasClasses)
+		Includes += std::format("#include \"{}_classes.hpp\"\n", FileName);
 
-	if (Type == EFileType::DebugAssertions)
-		File << "#include \"SDK.hpp\"\n";
+	WriteFileHead(AssertionsFile, nullptr, EFileType::Assertions, std::format("Assertions to verify struct-sizes and member-offsets of package {}", Package.GetName()), Includes);
 
-	if (Type == EFileType::BasicHpp)
+	DependencyManager::OnVisitCallbackType GenerateStructAssertionsCallback = [&AssertionsFile](int32 Index) -> void
 	{
-		File << "#include \"../PropertyFixup.hpp\"\n";
-		File << "#include \"../UnrealContainers.hpp\"\n";
-	}
+		if (IsReachable(Index))
+			GenerateStructAssertions(ObjectArray::GetByIndex<UEStruct>(Index), AssertionsFile, bAssertSize, bAssertMembers);
+	};
 
-	if (Type == EFileType::BasicCpp)
+	if (Content.bHasStructs)
+		Package.GetSortedStructs().VisitAllNodesWithCallback(GenerateStructAssertionsCallback);
+
+	if (Content.bHasClasses)
+		Package.GetSortedClasses().VisitAllNodesWithCallback(GenerateStructAssertionsCallback);
+
+	WriteFileEnd(AssertionsFile, EFileType::Assertions);
+}
+
+/* FNV-1a with a seed, must produce the same results as 'Reflection::HashPropertyName' in the generated Reflection.hpp */
+static uint32 HashPropertyName(std::string_view Name, uint32 Seed)
+{
+	uint32 Hash = 0x811C9DC5 ^ (Seed * 0x9E3779B9);
+
+	for (const char C : Name)
 	{
-		File << "\n#include \"CoreUObject_classes.hpp\"";
-		File << "\n#include \"CoreUObject_structs.hpp\"\n";
+		Hash ^= static_cast<uint8>(C);
+		Hash *= 0x01000193;
 	}
 
-	if (Type == EFileType::Functions && (Package.HasClasses() || Package.HasParameterStructs()))
-	{
-		std::string PackageName = Package.GetName();
+	return Hash ^ (Hash >> 15);
+}
 
-		File << "\n";
+/*
+* Finds a seed for which all names hash to distinct slots, the number of slots is a power of two of at least twice the number of names.
+* 
+* Returns { 0, 0 } if no seed was found within 'MaxSlots', the table then falls back to a linear search.
+*/
+static std::pair<uint32, int32> FindPerfectHashSeed(const std::vector<std::string>& Names)
+{
+	constexpr uint32 MaxSeedsPerTableSize = 0x200;
+	constexpr int32 MaxSlots = 0x8000;
 
-		if (Package.HasClasses())
-			File << std::format("#include \"{}_classes.hpp\"\n", PackageName);
+	/* Identical names always hash to the same slot, only the first one needs to be found */
+	std::vector<std::string_view> UniqueNames(Names.begin(), Names.end());
+	std::sort(UniqueNames.begin(), UniqueNames.end());
+	UniqueNames.erase(std::unique(UniqueNames.begin(), UniqueNames.end()), UniqueNames.end());
 
-		if (Package.HasParameterStructs())
-			File << std::format("#include \"{}_parameters.hpp\"\n", PackageName);
+	int32 NumSlots = 1;
+	while (NumSlots < static_cast<int32>(UniqueNames.size() * 2))
+		NumSlots <<= 1;
 
-		File << "\n";
-	}
-	else if (Package.IsValidHandle())
-	{
-		File << "\n";
+	std::vector<bool> UsedSlots;
 
-		const DependencyInfo& Dep = Package.GetPackageDependencies();
-		const DependencyListType& CurrentDependencyList = Type == EFileType::Structs ? Dep.StructsDependencies : (Type == EFileType::Classes ? Dep.ClassesDependencies : Dep.ParametersDependencies);
+	for (; NumSlots <= MaxSlots; NumSlots <<= 1)
+	{
+		for (uint32 Seed = 0; Seed < MaxSeedsPerTableSize; Seed++)
+		{
+			UsedSlots.assign(NumSlots, false);
 
-		bool bAddNewLine = false;
+			bool bHasCollision = false;
 
-		for (const auto& [PackageIndex, Requirements] : CurrentDependencyList)
-		{
-			bAddNewLine = true;
+			for (const std::string_view Name : UniqueNames)
+			{
+				const uint32 Slot = HashPropertyName(Name, Seed) & (NumSlots - 1);
 
-			std::string DependencyName = PackageManager::GetName(PackageIndex);
+				if (UsedSlots[Slot])
+				{
+					bHasCollision = true;
+					break;
+				}
 
-			if (Requirements.bShouldIncludeStructs)
-				File << std::format("#include \"{}_structs.hpp\"\n", DependencyName);
+				UsedSlots[Slot] = true;
+			}
 
-			if (Requirements.bShouldIncludeClasses)
-				File << std::format("#include \"{}_classes.hpp\"\n", DependencyName);
+			if (!bHasCollision)
+				return { Seed, NumSlots };
 		}
-
-		if (bAddNewLine)
-			File << "\n";
 	}
 
-	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib)
-		return; /* No namespace or packing in SDK.hpp or NameCollisions.inl */
+	return { 0, 0 };
+}
 
+void CppGenerator::GenerateReflectionHeader(StreamType& ReflectionHeader)
+{
+	WriteFileHead(ReflectionHeader, nullptr, EFileType::Reflection, "Constexpr perfect-hash tables mapping member-names to their offset, size and type", "#include <string_view>\n#include <type_traits>");
 
-	File << "\n";
+	ReflectionHeader << R"(namespace Reflection
+{
 
-	if constexpr (CppSettings::SDKNamespaceName)
-	{
-		File << std::format("namespace {}", CppSettings::SDKNamespaceName);
+/* Generator-independent type of a member, as it would be written to a .usmap file. Members added by Dumper-7 are 'Unknown'. */
+enum class EPropertyTypeId : uint8
+{
+	ByteProperty,
+	BoolProperty,
+	IntProperty,
+	FloatProperty,
+	ObjectProperty,
+	NameProperty,
+	DelegateProperty,
+	DoubleProperty,
+	ArrayProperty,
+	StructProperty,
+	StrProperty,
+	TextProperty,
+	InterfaceProperty,
+	MulticastDelegateProperty,
+	WeakObjectProperty,
+	LazyObjectProperty,
+	AssetObjectProperty,
+	SoftObjectProperty,
+	UInt64Property,
+	UInt32Property,
+	UInt16Property,
+	Int64Property,
+	Int16Property,
+	Int8Property,
+	MapProperty,
+	SetProperty,
+	EnumProperty,
+	FieldPathProperty,
+	OptionalProperty,
+
+	Unknown = 0xFF
+};
 
-		if (Type == EFileType::Parameters && CppSettings::ParamNamespaceName)
-			File << std::format("::{}", CppSettings::ParamNamespaceName);
+struct FPropertyInfo
+{
+	const char* Name;
+	int32 Offset;
+	int32 Size;
+	EPropertyTypeId TypeId;
 
-		File << "\n{\n";
-	}
-	else if constexpr (CppSettings::ParamNamespaceName)
+	/* Mask of the bit within the byte at 'Offset' for bitfield-members, 0xFF otherwise */
+	uint8 FieldMask;
+};
+
+constexpr uint32 HashPropertyName(std::string_view Name, uint32 Seed)
+{
+	uint32 Hash = 0x811C9DC5 ^ (Seed * 0x9E3779B9);
+
+	for (const char C : Name)
 	{
-		if (Type == EFileType::Parameters)
-			File << std::format("namespace {}\n{{\n", CppSettings::ParamNamespaceName);
+		Hash ^= static_cast<uint8>(C);
+		Hash *= 0x01000193;
 	}
+
+	return Hash ^ (Hash >> 15);
 }
 
-void CppGenerator::WriteFileEnd(StreamType& File, EFileType Type)
+/* Specialized for every struct/class of the SDK below */
+template<typename StructType>
+struct TStructReflection
 {
-	namespace CppSettings = Settings::CppGenerator;
+	static constexpr bool bHasReflection = false;
+};
 
-	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib)
-		return; /* No namespace or packing in SDK.hpp or NameCollisions.inl */
+/* Finds a member of 'StructType', or of any of its bases, by name. Returns nullptr if there is no such member. */
+template<typename StructType>
+constexpr const FPropertyInfo* FindProperty(std::string_view Name)
+{
+	using ReflectionType = TStructReflection<std::remove_cv_t<StructType>>;
 
-	if constexpr (CppSettings::SDKNamespaceName || CppSettings::ParamNamespaceName)
+	if constexpr (!ReflectionType::bHasReflection)
 	{
-		if (Type != EFileType::Functions)
-			File << "\n";
+		return nullptr;
+	}
+	else
+	{
+		/* 'bHasPerfectHash', 'Seed' and 'Slots' only exist for structs with properties */
+		if constexpr (ReflectionType::NumProperties > 0)
+		{
+			if constexpr (ReflectionType::bHasPerfectHash)
+			{
+				constexpr uint32 SlotMask = static_cast<uint32>(sizeof(ReflectionType::Slots) / sizeof(ReflectionType::Slots[0])) - 1;
 
-		File << "}\n\n";
+				const int16 Index = ReflectionType::Slots[HashPropertyName(Name, ReflectionType::Seed) & SlotMask];
+
+				if (Index >= 0 && std::string_view(ReflectionType::Properties[Index].Name) == Name)
+					return &ReflectionType::Properties[Index];
+			}
+			else
+			{
+				for (const FPropertyInfo& Info : ReflectionType::Properties)
+				{
+					if (std::string_view(Info.Name) == Name)
+						return &Info;
+				}
+			}
+		}
+
+		if constexpr (!std::is_void_v<typename ReflectionType::SuperType>)
+		{
+			return FindProperty<typename ReflectionType::SuperType>(Name);
+		}
+		else
+		{
+			return nullptr;
+		}
 	}
 }
 
-void CppGenerator::Generate()
+/* Returns a pointer to the member 'Name' of 'Object', or nullptr if there is no such member. Bitfield-members need to be masked with 'FieldMask'. */
+template<typename ValueType, typename StructType>
+inline ValueType* GetPropertyPtr(StructType* Object, std::string_view Name)
 {
-	// Generate SDK.hpp with sorted packages
-	StreamType SdkHpp(MainFolder / "SDK.hpp");
-	GenerateSDKHeader(SdkHpp);
-
-	// Generate PropertyFixup.hpp
-	StreamType PropertyFixup(MainFolder / "PropertyFixup.hpp");
-	GeneratePropertyFixupFile(PropertyFixup);
+	const FPropertyInfo* Info = FindProperty<StructType>(Name);
 
-	// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
-	StreamType NameCollisionsInl(MainFolder / "NameCollisions.inl");
-	GenerateNameCollisionsInl(NameCollisionsInl);
+	if (!Object || !Info)
+		return nullptr;
 
-	// Generate UnrealContainers.hpp
-	StreamType UnrealContainers(MainFolder / "UnrealContainers.hpp");
-	GenerateUnrealContainers(UnrealContainers);
+	using BytePtrType = std::conditional_t<std::is_const_v<StructType>, const uint8*, uint8*>;
 
-	// Generate UtfN.hpp
-	StreamType UnicodeLib(MainFolder / "UtfN.hpp");
-	GenerateUnicodeLib(UnicodeLib);
+	return reinterpret_cast<ValueType*>(const_cast<uint8*>(reinterpret_cast<BytePtrType>(Object) + Info->Offset));
+}
 
-	// Generate Basic.hpp and Basic.cpp files
-	StreamType BasicHpp(Subfolder / "Basic.hpp");
-	StreamType BasicCpp(Subfolder / "Basic.cpp");
-	GenerateBasicFiles(BasicHpp, BasicCpp);
+)";
 
+	/* Fully qualified, so SDK-types can't be confused with the types declared in 'Reflection' */
+	const std::string SDKNamespacePrefix = Settings::CppGenerator::SDKNamespaceName ? std::format("::{}::", Settings::CppGenerator::SDKNamespaceName) : "::";
 
-	if constexpr (Settings::Debug::bGenerateAssertionFile)
+	auto GenerateStructReflectionCallback = [&ReflectionHeader, &SDKNamespacePrefix](int32 Index) -> void
 	{
-		// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets
-		StreamType DebugAssertions(MainFolder / "Assertions.inl");
-		GenerateDebugAssertions(DebugAssertions);
-	}
+		if (!IsReachable(Index))
+			return;
 
-	// Generates all packages and writes them to files
-	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
-	{
-		if (Package.IsEmpty())
-			continue;
+		StructWrapper Struct = ObjectArray::GetByIndex<UEStruct>(Index);
 
-		const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
-		const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
+		const std::string UniquePrefixedName = SDKNamespacePrefix + GetStructPrefixedName(Struct);
 
-		StreamType ClassesFile;
-		StreamType StructsFile;
-		StreamType ParametersFile;
-		StreamType FunctionsFile;
+		StructWrapper Super = Struct.GetSuper();
 
-		/* Create files and handles namespaces and includes */
-		if (Package.HasClasses())
+		std::vector<std::string> Names;
+		std::string PropertiesString;
+
+		MemberManager Members = Struct.GetMembers();
+
+		for (const PropertyWrapper& Member : Members.IterateMembers())
 		{
-			ClassesFile = StreamType(Subfolder / (U8FileName + u8"_classes.hpp"));
+			if (Member.IsStatic() || Member.IsZeroSizedMember())
+				continue;
 
-			if (!ClassesFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
+			const EMappingsTypeFlags TypeId = Member.IsUnrealProperty() ? TypeManager::GetInfo(Member.GetUnrealProperty()).GetMappingType() : EMappingsTypeFlags::Unknown;
 
-			WriteFileHead(ClassesFile, Package, EFileType::Classes);
+			PropertiesString += std::format("\t\t{{ \"{}\", 0x{:04X}, 0x{:04X}, static_cast<EPropertyTypeId>(0x{:02X}), 0x{:02X} }},\n", Member.GetName(), Member.GetOffset(), Member.GetSize(),
+				static_cast<uint8>(TypeId), Member.IsBitField() ? Member.GetFieldMask() : 0xFF);
 
-			/* Write enum foward declarations before all of the classes */
-			GenerateEnumFwdDeclarations(ClassesFile, Package, true);
+			Names.push_back(Member.GetName());
 		}
 
-		if (Package.HasStructs() || Package.HasEnums())
+		ReflectionHeader << std::format("// {} {}\ntemplate<>\nstruct TStructReflection<{}>\n{{\n", (Struct.IsClass() ? "class" : "struct"), UniquePrefixedName, UniquePrefixedName);
+		ReflectionHeader << std::format("\tusing SuperType = {};\n\n", Super.IsValid() ? SDKNamespacePrefix + GetStructPrefixedName(Super) : "void");
+		ReflectionHeader << "\tstatic constexpr bool bHasReflection = true;\n";
+		ReflectionHeader << std::format("\tstatic constexpr int32 NumProperties = 0x{:X};\n", Names.size());
+
+		if (!Names.empty())
 		{
-			StructsFile = StreamType(Subfolder / (U8FileName + u8"_structs.hpp"));
+			const auto [Seed, NumSlots] = FindPerfectHashSeed(Names);
 
-			if (!StructsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
+			ReflectionHeader << std::format("\tstatic constexpr bool bHasPerfectHash = {};\n", NumSlots > 0);
+			ReflectionHeader << std::format("\tstatic constexpr FPropertyInfo Properties[0x{:X}] =\n\t{{\n{}\t}};\n", Names.size(), PropertiesString);
 
-			WriteFileHead(StructsFile, Package, EFileType::Structs);
+			if (NumSlots > 0)
+			{
+				std::vector<int16> Slots(NumSlots, -1);
 
-			/* Write enum foward declarations before all of the structs */
-			GenerateEnumFwdDeclarations(StructsFile, Package, false);
-		}
+				/* Duplicate names share a slot, the first member with that name is the one found by a lookup */
+				for (int32 i = 0; i < static_cast<int32>(Names.size()); i++)
+				{
+					int16& Slot = Slots[HashPropertyName(Names[i], Seed) & (NumSlots - 1)];
 
-		if (Package.HasParameterStructs())
-		{
-			ParametersFile = StreamType(Subfolder / (U8FileName + u8"_parameters.hpp"));
+					if (Slot < 0)
+						Slot = static_cast<int16>(i);
+				}
+
+				std::string SlotsString;
 
-			if (!ParametersFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
+				for (int32 i = 0; i < NumSlots; i++)
+					SlotsString += std::format("{}{}", (i > 0 ? ((i % 0x20) == 0 ? ",\n\t\t" : ", ") : ""), Slots[i]);
 
-			WriteFileHead(ParametersFile, Package, EFileType::Parameters);
+				ReflectionHeader << std::format("\n\tstatic constexpr uint32 Seed = 0x{:X};\n\n", Seed);
+				ReflectionHeader << std::format("\tstatic constexpr int16 Slots[0x{:X}] =\n\t{{\n\t\t{}\n\t}};\n", NumSlots, SlotsString);
+			}
 		}
 
-		if (Package.HasFunctions())
-		{
-			FunctionsFile = StreamType(Subfolder / (U8FileName + u8"_functions.cpp"));
+		ReflectionHeader << "};\n\n";
+	};
 
-			if (!FunctionsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		if (Package.HasStructs())
+			Package.GetSortedStructs().VisitAllNodesWithCallback(GenerateStructReflectionCallback);
 
-			WriteFileHead(FunctionsFile, Package, EFileType::Functions);
-		}
+		if (Package.HasClasses())
+			Package.GetSortedClasses().VisitAllNodesWithCallback(GenerateStructReflectionCallback);
+	}
 
-		const int32 PackageIndex = Package.GetIndex();
+	ReflectionHeader << "}\n";
 
-		/* 
-		* Generate classes/structs/enums/functions directly into the respective files
-		* 
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
-		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
-		}
+	WriteFileEnd(ReflectionHeader, EFileType::Reflection);
+}
 
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
+void CppGenerator::GenerateSDKHeader(StreamType& SdkHpp)
+{
+	WriteFileHead(SdkHpp, nullptr, EFileType::SdkHpp, "Includes the entire SDK. Include files directly for faster compilation!");
 
-			DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
 
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+	auto ForEachElementCallback = [&SdkHpp](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+	{
+		PackageInfoHandle CurrentPackage = PackageManager::GetInfo(NewParams.RequiredPackage);
 
-		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+		const PackageContent Content = GetPackageContent(CurrentPackage);
 
-			DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
+		const bool bHasClassesFile = Content.bHasClasses;
+		const bool bHasStructsFile = (Content.bHasStructs || Content.bHasEnums);
 
-			Classes.VisitAllNodesWithCallback(GenerateClassCallback);
-		}
+		if (bIsStruct && bHasStructsFile)
+			SdkHpp << std::format("#include \"SDK/{}_structs.hpp\"\n", CurrentPackage.GetName());
 
+		if (!bIsStruct && bHasClassesFile)
+			SdkHpp << std::format("#include \"SDK/{}_classes.hpp\"\n", CurrentPackage.GetName());
+	};
 
-		/* Closes any namespaces if required */
-		if (Package.HasClasses())
-			WriteFileEnd(ClassesFile, EFileType::Classes);
+	PackageManager::IterateDependencies(ForEachElementCallback);
 
-		if (Package.HasStructs() || Package.HasEnums())
-			WriteFileEnd(StructsFile, EFileType::Structs);
 
-		if (Package.HasParameterStructs())
-			WriteFileEnd(ParametersFile, EFileType::Parameters);
+	WriteFileEnd(SdkHpp, EFileType::SdkHpp);
+}
 
-		if (Package.HasFunctions())
-			WriteFileEnd(FunctionsFile, EFileType::Functions);
-	}
+/*
+* All standard-library headers included by the headers of the SDK, written to Basic.hpp and included before the SDK in SDK.ixx and SDK_PCH.hpp.
+* 
+* Includes the headers required by UnrealContainers.hpp, UtfN.hpp and Reflection.hpp, such that every file of the SDK sees the same standard-library.
+*/
+static constexpr const char* SDKStandardLibraryIncludes = R"(#include <cstdint>
+#include <limits>
+#include <concepts>
+#include <type_traits>
+#include <functional>
+#include <charconv>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <mutex>
+#include <vector>
+)";
+
+void CppGenerator::GenerateModuleAndPCHFiles(StreamType& SdkModule, StreamType& PrecompiledHeader)
+{
+	/* SDK.ixx is a module interface unit and can't use '#pragma once', so WriteFileHead isn't used */
+	SdkModule << "\xEF\xBB\xBF";
+
+	SdkModule << R"(/*
+* SDK generated by Dumper-7
+*
+* https://github.com/Encryqed/Dumper-7
+*/
+
+// C++20 module containing the entire SDK. Compile this file as a module interface unit and replace '#include "SDK.hpp"' with 'import SDK;'.
+// Experimental: everything in SDK.hpp is exported, including 'using namespace UC;' and static_asserts. Use SDK_PCH.hpp if your compiler rejects this file.
+
+module;
+
+/* The standard library is included in the global module fragment, such that it isn't part of the module itself */
+)";
+
+	SdkModule << SDKStandardLibraryIncludes;
+
+	SdkModule << std::format(R"(
+export module SDK;
+
+/* extern "C++" attaches the SDK to the global module, such that it links against the definitions in Basic.cpp and the *_functions.cpp files */
+/* Exporting only the SDK namespaces would require a using-declaration for every type, so the whole header is exported */
+export extern "C++"
+{{
+#include "SDK.hpp"{}
+}}
+)", Settings::CppGenerator::bGenerateReflectionHeader ? "\n#include \"Reflection.hpp\"" : "");
+
+
+	WriteFileHead(PrecompiledHeader, nullptr, EFileType::PrecompiledHeader, "Header to precompile the SDK with, for compilers without support for modules (eg. '/Yc\"SDK_PCH.hpp\"' and '/Yu\"SDK_PCH.hpp\"' on MSVC)", SDKStandardLibraryIncludes);
+
+	/* Same contents as SDK.ixx */
+	if constexpr (Settings::CppGenerator::bGenerateReflectionHeader)
+		PrecompiledHeader << "#include \"Reflection.hpp\"\n";
+
+	WriteFileEnd(PrecompiledHeader, EFileType::PrecompiledHeader);
 }
 
-void CppGenerator::InitPredefinedMembers()
+void CppGenerator::GenerateUnityBuildFiles()
 {
-	static auto SortMembers = [](std::vector<PredefinedMember>& Members) -> void
-	{
-		std::sort(Members.begin(), Members.end(), ComparePredefinedMembers);
-	};
+	/* Only called if unity-build files are enabled, the minimum of 1 prevents a constant modulo by zero */
+	constexpr uint64 NumUnityFiles = std::max<uint64>(Settings::CppGenerator::NumUnityBuildFiles, 1);
 
-	/* Assumes Members to be sorted */
-	static auto InitStructSize = [](PredefinedStruct& Struct) -> void
+	/* FNV-1a, the group of a package only depends on its name, so adding, removing or regenerating other packages never moves it */
+	auto GetUnityFileIndex = [](const std::string& PackageName) -> uint64
 	{
-		if (Struct.Size > 0x0)
-			return;
+		uint64 Hash = 0xCBF29CE484222325;
 
-		if (Struct.Properties.empty() && Struct.Super)
-			Struct.Size = Struct.Super->Size;
+		for (const char C : PackageName)
+			Hash = (Hash ^ static_cast<uint8>(C)) * 0x100000001B3;
 
-		const PredefinedMember& LastMember = Struct.Properties[Struct.Properties.size() - 1];
-		Struct.Size = LastMember.Offset + LastMember.Size;
+		return Hash % NumUnityFiles;
 	};
 
+	/* Taken from the PackageManager, as only some packages are regenerated by GenerateDelta() */
+	std::vector<std::vector<std::string>> FunctionFilesPerUnityFile(NumUnityFiles);
 
-	if (Off::InSDK::ULevel::Actors != -1)
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		UEClass Level = ObjectArray::FindClassFast("Level");
+		if (!GetPackageContent(Package).bHasFunctions)
+			continue;
 
-		if (Level == nullptr)
-			Level = ObjectArray::FindClassFast("level");
+		const std::string PackageName = Package.GetName();
 
-		PredefinedElements& ULevelPredefs = PredefinedMembers[Level.GetIndex()];
-		ULevelPredefs.Members =
-		{
-			PredefinedMember {
-				.Comment = "THIS IS THE ARRAY YOU'RE LOOKING FOR! [NOT AUTO-GENERATED PROPERTY]",
-				.Type = "class TArray<class AActor*>", .Name = "Actors", .Offset = Off::InSDK::ULevel::Actors, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+		FunctionFilesPerUnityFile[GetUnityFileIndex(PackageName)].push_back(Settings::CppGenerator::FilePrefix + PackageName + "_functions.cpp");
 	}
 
-	UEClass DataTable = ObjectArray::FindClassFast("DataTable");
-
-	PredefinedElements& UDataTablePredefs = PredefinedMembers[DataTable.GetIndex()];
-	UDataTablePredefs.Members =
+	for (uint64 i = 0; i < NumUnityFiles; i++)
 	{
-		PredefinedMember {
-			.Comment = "So, here's a RowMap. Good luck with it.",
-			.Type = "TMap<class FName, uint8*>", .Name = "RowMap", .Offset = Off::InSDK::UDataTable::RowMap, .Size = 0x50, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		std::vector<std::string>& FunctionFiles = FunctionFilesPerUnityFile[i];
+		std::sort(FunctionFiles.begin(), FunctionFiles.end());
 
-	PredefinedElements& UObjectPredefs = PredefinedMembers[ObjectArray::FindClassFast("Object").GetIndex()];
-	UObjectPredefs.Members = 
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "inline class TUObjectArrayWrapper", .Name = "GObjects", .Offset = 0x0, .Size = sizeof(void*), .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "void*", .Name = "VTable", .Offset = Off::UObject::Vft, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "EObjectFlags", .Name = "Flags", .Offset = Off::UObject::Flags, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "Index", .Offset = Off::UObject::Index, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UClass*", .Name = "Class", .Offset = Off::UObject::Class, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class FName", .Name = "Name", .Offset = Off::UObject::Name, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UObject*", .Name = "Outer", .Offset = Off::UObject::Outer, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		std::string UnityFileIncludes;
 
-	PredefinedElements& UFieldPredefs = PredefinedMembers[ObjectArray::FindClassFast("Field").GetIndex()];
-	UFieldPredefs.Members =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UField*", .Name = "Next", .Offset = Off::UField::Next, .Size = 0x8, .ArrayDim = 0x1, .Alignment =0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		for (const std::string& FileName : FunctionFiles)
+			UnityFileIncludes += std::format("#include \"{}\"\n", FileName);
 
-	PredefinedElements& UEnumPredefs = PredefinedMembers[ObjectArray::FindClassFast("Enum").GetIndex()];
-	UEnumPredefs.Members =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class TArray<class TPair<class FName, int64>>", .Name = "Names", .Offset = Off::UEnum::Names, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		/* Groups without packages are written as well, to replace files of a previous dump that included packages which are gone now */
+		StreamType UnityFile(Subfolder / std::format("UnityBuild_{}.cpp", i));
 
-	UEObject UStruct = ObjectArray::FindClassFast("Struct");
+		if (!UnityFile.is_open())
+			std::cout << "Error opening file \"" << std::format("UnityBuild_{}.cpp", i) << "\"" << std::endl;
 
-	if (UStruct == nullptr)
-		UStruct = ObjectArray::FindClassFast("struct");
+		WriteFileHead(UnityFile, nullptr, EFileType::UnityBuild, "Unity-build file, compile these instead of the \"PackageName_functions.cpp\" files", UnityFileIncludes);
 
-	PredefinedElements& UStructPredefs = PredefinedMembers[UStruct.GetIndex()];
-	UStructPredefs.Members =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UStruct*", .Name = "Super", .Offset = Off::UStruct::SuperStruct, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UField*", .Name = "Children", .Offset = Off::UStruct::Children, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "MinAlignemnt", .Offset = Off::UStruct::MinAlignemnt, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "Size", .Offset = Off::UStruct::Size, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		WriteFileEnd(UnityFile, EFileType::UnityBuild);
+	}
 
-	if (Settings::Internal::bUseFProperty)
+	/* Files of groups beyond 'NumUnityFiles', from a dump with more groups */
+	for (uint64 i = NumUnityFiles;; i++)
 	{
-		UStructPredefs.Members.push_back({
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class FField*", .Name = "ChildProperties", .Offset = Off::UStruct::ChildProperties, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		});
+		std::error_code ErrorCode;
+
+		if (!fs::remove(Subfolder / std::format("UnityBuild_{}.cpp", i), ErrorCode))
+			break;
 	}
+}
 
-	PredefinedElements& UFunctionPredefs = PredefinedMembers[ObjectArray::FindClassFast("Function").GetIndex()];
-	UFunctionPredefs.Members =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "using FNativeFuncPtr = void (*)(void* Context, void* TheStack, void* Result)", .Name = "", .Offset = 0x0, .Size = 0x00, .ArrayDim = 0x1, .Alignment = 0x0,
-			.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint32", .Name = "FunctionFlags", .Offset = Off::UFunction::FunctionFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "FNativeFuncPtr", .Name = "ExecFunction", .Offset = Off::UFunction::ExecFunction, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+void CppGenerator::WriteFileHead(StreamType& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment, const std::string& CustomIncludes)
+{
+	namespace CppSettings = Settings::CppGenerator;
 
-	PredefinedElements& UClassPredefs = PredefinedMembers[ObjectArray::FindClassFast("Class").GetIndex()];
-	UClassPredefs.Members =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "enum class EClassCastFlags", .Name = "CastFlags", .Offset = Off::UClass::CastFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UObject*", .Name = "DefaultObject", .Offset = Off::UClass::ClassDefaultObject, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	/* Write the utf8 BOM to indicate that this is a utf8 encoded file. */
+	File << "\xEF\xBB\xBF";
 
-	std::string PropertyTypePtr = Settings::Internal::bUseFProperty ? "class FProperty*" : "class UProperty*";
+	File << R"(#pragma once
 
-	std::vector<PredefinedMember> PropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "ArrayDim", .Offset = Off::Property::ArrayDim, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "ElementSize", .Offset = Off::Property::ElementSize, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false,  .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint64", .Name = "PropertyFlags", .Offset = Off::Property::PropertyFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "Offset", .Offset = Off::Property::Offset_Internal, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+/*
+* SDK generated by Dumper-7
+*
+* https://github.com/Encryqed/Dumper-7
+*/
+)";
 
-	std::vector<PredefinedMember> BytePropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UEnum*", .Name = "Enum", .Offset = Off::ByteProperty::Enum, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	if (Type == EFileType::SdkHpp)
+		File << std::format("\n// {}\n// {}\n", Settings::Generator::GameName, Settings::Generator::GameVersion);
+	
 
-	std::vector<PredefinedMember> BoolPropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint8", .Name = "FieldSize", .Offset = Off::BoolProperty::Base, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint8", .Name = "ByteOffset", .Offset = Off::BoolProperty::Base + 0x1, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
-			.bIsStatic = false, .bIsZeroSizeMember = false,  .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint8", .Name = "ByteMask", .Offset = Off::BoolProperty::Base + 0x2, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint8", .Name = "FieldMask", .Offset = Off::BoolProperty::Base + 0x3, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	File << std::format("\n// {}\n\n", Package.IsValidHandle() ? std::format("Package: {}", Package.GetName()) : CustomFileComment);
 
-	std::vector<PredefinedMember> ObjectPropertyBaseMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UClass*", .Name = "PropertyClass", .Offset = Off::ObjectProperty::PropertyClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
 
-	std::vector<PredefinedMember> ClassPropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UClass*", .Name = "MetaClass", .Offset = Off::ClassProperty::MetaClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	if (!CustomIncludes.empty())
+		File << CustomIncludes + "\n";
 
-	std::vector<PredefinedMember> StructPropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UStruct*", .Name = "Struct", .Offset = Off::StructProperty::Struct, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	if (Type != EFileType::BasicHpp && Type != EFileType::NameCollisionsInl && Type != EFileType::PropertyFixup && Type != EFileType::SdkHpp && Type != EFileType::DebugAssertions && Type != EFileType::Reflection && Type != EFileType::PrecompiledHeader
+		&& Type != EFileType::UnrealContainers && Type != EFileType::UnicodeLib && Type != EFileType::StructHeader && Type != EFileType::EnumHeader && Type != EFileType::UnityBuild)
+		File << "#include \"Basic.hpp\"\n";
 
-	std::vector<PredefinedMember> ArrayPropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = PropertyTypePtr, .Name = "InnerProperty", .Offset = Off::ArrayProperty::Inner, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	/* Per-class headers are placed in a subfolder per package */
+	if (Type == EFileType::StructHeader || Type == EFileType::EnumHeader)
+		File << "#include \"../Basic.hpp\"\n";
 
-	std::vector<PredefinedMember> DelegatePropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UFunction*", .Name = "SignatureFunction", .Offset = Off::DelegateProperty::SignatureFunction, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	if (Type == EFileType::SdkHpp)
+		File << "#include \"SDK/Basic.hpp\"\n";
 
-	std::vector<PredefinedMember> MapPropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = PropertyTypePtr, .Name = "KeyProperty", .Offset = Off::MapProperty::Base, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = PropertyTypePtr, .Name = "ValueProperty", .Offset = Off::MapProperty::Base + 0x8, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	if (Type == EFileType::DebugAssertions || Type == EFileType::Reflection || Type == EFileType::PrecompiledHeader)
+		File << "#include \"SDK.hpp\"\n";
 
-	std::vector<PredefinedMember> SetPropertyMembers =
+	if (Type == EFileType::BasicHpp)
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = PropertyTypePtr, .Name = "ElementProperty", .Offset = Off::SetProperty::ElementProp, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		File << "#include \"../PropertyFixup.hpp\"\n";
+		File << "#include \"../UnrealContainers.hpp\"\n";
+	}
 
-	std::vector<PredefinedMember> EnumPropertyMembers =
+	if (Type == EFileType::BasicCpp)
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = PropertyTypePtr, .Name = "UnderlayingProperty", .Offset = Off::EnumProperty::Base, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class UEnum*", .Name = "Enum", .Offset = Off::EnumProperty::Base + 0x8, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		File << "\n#include \"CoreUObject_classes.hpp\"";
+		File << "\n#include \"CoreUObject_structs.hpp\"\n";
+	}
 
-	std::vector<PredefinedMember> FieldPathPropertyMembers =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class FFieldClass*", .Name = "FieldClass", .Offset = Off::FieldPathProperty::FieldClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	const PackageContent Content = Package.IsValidHandle() ? GetPackageContent(Package) : PackageContent{};
 
-	std::vector<PredefinedMember> OptionalPropertyMembers =
+	if (Type == EFileType::Functions && (Content.bHasClasses || Content.bHasParameterStructs))
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = PropertyTypePtr, .Name = "ValueProperty", .Offset = Off::OptionalProperty::ValueProperty, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		std::string PackageName = Package.GetName();
 
-	SortMembers(UObjectPredefs.Members);
-	SortMembers(UFieldPredefs.Members);
-	SortMembers(UEnumPredefs.Members);
-	SortMembers(UStructPredefs.Members);
-	SortMembers(UFunctionPredefs.Members);
-	SortMembers(UClassPredefs.Members);
+		File << "\n";
 
-	SortMembers(PropertyMembers);
-	SortMembers(BytePropertyMembers);
-	SortMembers(BoolPropertyMembers);
-	SortMembers(ObjectPropertyBaseMembers);
-	SortMembers(ClassPropertyMembers);
-	SortMembers(StructPropertyMembers);
-	SortMembers(ArrayPropertyMembers);
-	SortMembers(DelegatePropertyMembers);
-	SortMembers(MapPropertyMembers);
-	SortMembers(SetPropertyMembers);
-	SortMembers(FieldPathPropertyMembers);
-	SortMembers(OptionalPropertyMembers);
+		if (Content.bHasClasses)
+			File << std::format("#include \"{}_classes.hpp\"\n", PackageName);
 
-	if (!Settings::Internal::bUseFProperty)
+		if (Content.bHasParameterStructs)
+			File << std::format("#include \"{}_parameters.hpp\"\n", PackageName);
+
+		File << "\n";
+	}
+	else if (Package.IsValidHandle())
 	{
-		auto AssignValueIfObjectIsFound = [](const std::string& ClassName, std::vector<PredefinedMember>&& Members) -> void
+		File << "\n";
+
+		const DependencyInfo& Dep = Package.GetPackageDependencies();
+		const DependencyListType& CurrentDependencyList = Type == EFileType::Structs ? Dep.StructsDependencies : (Type == EFileType::Classes ? Dep.ClassesDependencies : Dep.ParametersDependencies);
+
+		bool bAddNewLine = false;
+
+		for (const auto& [PackageIndex, Requirements] : CurrentDependencyList)
 		{
-			if (UEClass Class = ObjectArray::FindClassFast(ClassName))
-				PredefinedMembers[Class.GetIndex()].Members = std::move(Members);
-		};
+			/* Files of packages without any reachable types aren't generated if the SDK is tree-shaken */
+			const PackageContent DependencyContent = GetPackageContent(PackageManager::GetInfo(PackageIndex));
 
-		AssignValueIfObjectIsFound("Property", std::move(PropertyMembers));
-		AssignValueIfObjectIsFound("ByteProperty", std::move(BytePropertyMembers));
-		AssignValueIfObjectIsFound("BoolProperty", std::move(BoolPropertyMembers));
-		AssignValueIfObjectIsFound("ObjectPropertyBase", std::move(ObjectPropertyBaseMembers));
-		AssignValueIfObjectIsFound("ClassProperty", std::move(ClassPropertyMembers));
-		AssignValueIfObjectIsFound("StructProperty", std::move(StructPropertyMembers));
-		AssignValueIfObjectIsFound("DelegateProperty", std::move(DelegatePropertyMembers));
-		AssignValueIfObjectIsFound("ArrayProperty", std::move(ArrayPropertyMembers));
-		AssignValueIfObjectIsFound("MapProperty", std::move(MapPropertyMembers));
-		AssignValueIfObjectIsFound("SetProperty", std::move(SetPropertyMembers));
-		AssignValueIfObjectIsFound("EnumProperty", std::move(EnumPropertyMembers));
+			const bool bIncludeStructs = Requirements.bShouldIncludeStructs && (DependencyContent.bHasStructs || DependencyContent.bHasEnums);
+			const bool bIncludeClasses = Requirements.bShouldIncludeClasses && DependencyContent.bHasClasses;
 
-		// FieldPathProperty and OptionalProperty don't exist in UE versions which are using UProperty
-		return;
+			if (!bIncludeStructs && !bIncludeClasses)
+				continue;
+
+			bAddNewLine = true;
+
+			std::string DependencyName = PackageManager::GetName(PackageIndex);
+
+			if (bIncludeStructs)
+				File << std::format("#include \"{}_structs.hpp\"\n", DependencyName);
+
+			if (bIncludeClasses)
+				File << std::format("#include \"{}_classes.hpp\"\n", DependencyName);
+		}
+
+		if (bAddNewLine)
+			File << "\n";
 	}
-	else
+
+	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib || Type == EFileType::PrecompiledHeader || Type == EFileType::UnityBuild)
+		return; /* No namespace or packing in SDK.hpp or NameCollisions.inl */
+
+
+	File << "\n";
+
+	if constexpr (CppSettings::SDKNamespaceName)
 	{
-		/* Reserving enough space is required because otherwise the vector could reallocate and invalidate some structs' 'Super' pointer */
-		PredefinedStructs.reserve(0x20);
+		File << std::format("namespace {}", CppSettings::SDKNamespaceName);
 
-		PredefinedStruct& FFieldClass = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FFieldClass", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = nullptr
-		});
-		PredefinedStruct& FFieldVariant = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FFieldVariant", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = nullptr
-		});
+		if (Type == EFileType::Parameters && CppSettings::ParamNamespaceName)
+			File << std::format("::{}", CppSettings::ParamNamespaceName);
 
-		PredefinedStruct& FField = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FField", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = nullptr
-		});
+		File << "\n{\n";
+	}
+	else if constexpr (CppSettings::ParamNamespaceName)
+	{
+		if (Type == EFileType::Parameters)
+			File << std::format("namespace {}\n{{\n", CppSettings::ParamNamespaceName);
+	}
+}
 
-		PredefinedStruct& FProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FProperty", .Size = Off::InSDK::Properties::PropertySize, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = &FField  /* FField */
-		});
-		PredefinedStruct& FByteProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FByteProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FBoolProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FBoolProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FObjectPropertyBase = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FObjectPropertyBase", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FClassProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FClassProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FObjectPropertyBase  /* FObjectPropertyBase */
-		});
-		PredefinedStruct& FStructProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FStructProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FArrayProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FArrayProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FDelegateProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FDelegateProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FMapProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FMapProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FSetProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FSetProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FEnumProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FEnumProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FFieldPathProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FFieldPathProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
-		PredefinedStruct& FOptionalProperty = PredefinedStructs.emplace_back(PredefinedStruct{
-			.UniqueName = "FOptionalProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
-		});
+void CppGenerator::WriteFileEnd(StreamType& File, EFileType Type)
+{
+	namespace CppSettings = Settings::CppGenerator;
 
-		FFieldClass.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "FName", .Name = "Name", .Offset = Off::FFieldClass::Name, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint64", .Name = "Id", .Offset = Off::FFieldClass::Id, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint64", .Name = "CastFlags", .Offset = Off::FFieldClass::CastFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "EClassFlags", .Name = "ClassFlags", .Offset = Off::FFieldClass::ClassFlags, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "class FFieldClass*", .Name = "SuperClass", .Offset = Off::FFieldClass::SuperClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+	if (Type == EFileType::SdkHpp || Type == EFileType::NameCollisionsInl || Type == EFileType::UnrealContainers || Type == EFileType::UnicodeLib || Type == EFileType::PrecompiledHeader || Type == EFileType::UnityBuild)
+		return; /* No namespace or packing in SDK.hpp or NameCollisions.inl */
 
+	if constexpr (CppSettings::SDKNamespaceName || CppSettings::ParamNamespaceName)
+	{
+		if (Type != EFileType::Functions)
+			File << "\n";
 
-		const int32 FFieldVariantSize = Settings::Internal::bUseMaskForFieldOwner ? 0x8 : 0x10;
-		const int32 IdentifierOffset = Settings::Internal::bUseMaskForFieldOwner ? 0x0 : 0x8;
-		std::string UObjectIdentifierType = (Settings::Internal::bUseMaskForFieldOwner ? "constexpr uint64" : "bool");
-		std::string UObjectIdentifierName = (Settings::Internal::bUseMaskForFieldOwner ? "UObjectMask = 0x1" : "bIsUObject");
+		File << "}\n\n";
+	}
+}
 
-		FFieldVariant.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "using ContainerType = union { class FField* Field; class UObject* Object; }", .Name = "", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "ContainerType", .Name = "Container", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = UObjectIdentifierType, .Name = UObjectIdentifierName, .Offset = IdentifierOffset, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = Settings::Internal::bUseMaskForFieldOwner, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+bool CppGenerator::IsTreeShaking()
+{
+	return !Settings::CppGenerator::SDKRoots.empty();
+}
+
+void CppGenerator::InitReachableObjects()
+{
+	ReachableObjects.clear();
+	ReachablePackageContents.clear();
+
+	if (!IsTreeShaking())
+		return;
 
+	std::vector<int32> ObjectsToVisit;
 
-		FField.Properties =
+	auto AddPackageAsRoot = [&ObjectsToVisit](PackageInfoHandle Package) -> void
+	{
+		Package.GetSortedStructs().VisitAllNodesWithCallback([&ObjectsToVisit](int32 Index) -> void { ObjectsToVisit.push_back(Index); });
+		Package.GetSortedClasses().VisitAllNodesWithCallback([&ObjectsToVisit](int32 Index) -> void { ObjectsToVisit.push_back(Index); });
+
+		ObjectsToVisit.insert(ObjectsToVisit.end(), Package.GetEnums().begin(), Package.GetEnums().end());
+	};
+
+	/* Packages and classes the SDK itself relies on, eg. in Basic.cpp or in predefined functions */
+	static const char* const RequiredClasses[] = { "Engine", "GameEngine", "GameViewportClient", "World", "Level", "level", "Actor" };
+
+	for (const char* ClassName : RequiredClasses)
+	{
+		if (UEClass Class = ObjectArray::FindClassFast(ClassName))
+			ObjectsToVisit.push_back(Class.GetIndex());
+	}
+
+	for (const std::string& Root : Settings::CppGenerator::SDKRoots)
+	{
+		bool bFoundPackage = false;
+
+		for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "void*", .Name = "VTable", .Offset = Off::FField::Vft, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "class FFieldClass*", .Name = "ClassPrivate", .Offset = Off::FField::Class, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "FFieldVariant", .Name = "Owner", .Offset = Off::FField::Owner, .Size = FFieldVariantSize, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "class FField*", .Name = "Next", .Offset = Off::FField::Next, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "FName", .Name = "Name", .Offset = Off::FField::Name, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "int32", .Name = "ObjFlags", .Offset = Off::FField::Flags, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+			if (Package.GetName() != Root)
+				continue;
 
-		SortMembers(FFieldClass.Properties);
-		SortMembers(FFieldVariant.Properties);
+			AddPackageAsRoot(Package);
+			bFoundPackage = true;
+		}
 
-		SortMembers(FField.Properties);
+		if (bFoundPackage)
+			continue;
 
-		FProperty.Properties = PropertyMembers;
-		FByteProperty.Properties = BytePropertyMembers;
-		FBoolProperty.Properties = BoolPropertyMembers;
-		FObjectPropertyBase.Properties = ObjectPropertyBaseMembers;
-		FClassProperty.Properties = ClassPropertyMembers;
-		FStructProperty.Properties = StructPropertyMembers;
-		FArrayProperty.Properties = ArrayPropertyMembers;
-		FDelegateProperty.Properties = DelegatePropertyMembers;
-		FMapProperty.Properties = MapPropertyMembers;
-		FSetProperty.Properties = SetPropertyMembers;
-		FEnumProperty.Properties = EnumPropertyMembers;
-		FFieldPathProperty.Properties = FieldPathPropertyMembers;
-		FOptionalProperty.Properties = OptionalPropertyMembers;
+		UEStruct Struct = ObjectArray::FindStructFast(Root);
 
-		/* Init PredefindedStruct::Size **after** sorting the members */
-		InitStructSize(FFieldClass);
-		InitStructSize(FFieldVariant);
+		if (Struct && !Struct.IsA(EClassCastFlags::Function))
+		{
+			ObjectsToVisit.push_back(Struct.GetIndex());
+			continue;
+		}
 
-		InitStructSize(FField);
+		if (UEEnum Enum = ObjectArray::FindObjectFast<UEEnum>(Root, EClassCastFlags::Enum))
+		{
+			ObjectsToVisit.push_back(Enum.GetIndex());
+			continue;
+		}
 
-		InitStructSize(FProperty);
-		InitStructSize(FByteProperty);
-		InitStructSize(FBoolProperty);
-		InitStructSize(FObjectPropertyBase);
-		InitStructSize(FClassProperty);
-		InitStructSize(FStructProperty);
-		InitStructSize(FArrayProperty);
-		InitStructSize(FDelegateProperty);
-		InitStructSize(FMapProperty);
-		InitStructSize(FSetProperty);
-		InitStructSize(FEnumProperty);
-		InitStructSize(FFieldPathProperty);
-		InitStructSize(FOptionalProperty);
+		std::cout << "Tree-shaking root \"" << Root << "\" wasn't found!" << std::endl;
 	}
-}
 
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		if (Package.GetName() == "CoreUObject")
+			AddPackageAsRoot(Package);
+	}
 
-void CppGenerator::InitPredefinedFunctions()
-{
-	static auto SortFunctions = [](std::vector<PredefinedFunction>& Functions) -> void
+	/* Pointers to classes are always forward-declared, so only supers and structs/enums used by value need to be generated */
+	while (!ObjectsToVisit.empty())
 	{
-		std::sort(Functions.begin(), Functions.end(), ComparePredefinedFunctions);
-	};
+		const int32 Index = ObjectsToVisit.back();
+		ObjectsToVisit.pop_back();
 
-	PredefinedElements& UObjectPredefs = PredefinedMembers[ObjectArray::FindClassFast("Object").GetIndex()];
+		if (Index < 0 || !ReachableObjects.insert(Index).second)
+			continue;
 
-	UObjectPredefs.Functions =
-	{
-		/* static non-inline functions */
-		PredefinedFunction {
-			.CustomComment = "Finds a UObject in the global object array by full-name, optionally with ECastFlags to reduce heavy string comparison",
-			.ReturnType = "class UObject*", .NameWithParams = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body =
-R"({
-	for (int i = 0; i < GObjects->Num(); ++i)
-	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (!Obj.IsA(EClassCastFlags::Struct))
 			continue;
-		
-		if (Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName)
-			return Object;
-	}
 
-	return nullptr;
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison",
-			.ReturnType = "class UObject*", .NameWithParams = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body =
-R"({
-	for (int i = 0; i < GObjects->Num(); ++i)
-	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
+		UEStruct Struct = Obj.Cast<UEStruct>();
+
+		if (UEStruct Super = Struct.GetSuper())
+			ObjectsToVisit.push_back(Super.GetIndex());
+
+		for (int32 DependencyIndex : PackageManagerUtils::GetDependencies(Struct, Index))
+			ObjectsToVisit.push_back(DependencyIndex);
+
+		if (!Obj.IsA(EClassCastFlags::Class))
 			continue;
-		
-		if (Object->HasTypeFlag(RequiredType) && Object->GetName() == Name)
-			return Object;
+
+		for (UEFunction Func : Struct.GetFunctions())
+		{
+			for (int32 DependencyIndex : PackageManagerUtils::GetDependencies(Func, Func.GetIndex()))
+				ObjectsToVisit.push_back(DependencyIndex);
+		}
 	}
 
-	return nullptr;
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
-		},
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		PackageContent& Content = ReachablePackageContents[Package.GetIndex()];
 
-		/* static inline functions */
-		PredefinedFunction {
-			.CustomComment = "",
-			.CustomTemplateText = "template<typename UEType = UObject>",
-			.ReturnType = "UEType*", .NameWithParams = "FindObject(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)", .Body =
-R"({
-	return static_cast<UEType*>(FindObjectImpl(Name, RequiredType));
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.CustomTemplateText = "template<typename UEType = UObject>",
-			.ReturnType = "UEType*", .NameWithParams = "FindObjectFast(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)", .Body =
-R"({
-	return static_cast<UEType*>(FindObjectFastImpl(Name, RequiredType));
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "class UClass*", .NameWithParams = "FindClass(const std::string& ClassFullName)", .Body =
-R"({
-	return FindObject<class UClass>(ClassFullName, EClassCastFlags::Class);
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "class UClass*", .NameWithParams = "FindClassFast(const std::string& ClassName)", .Body =
-R"({
-	return FindObjectFast<class UClass>(ClassName, EClassCastFlags::Class);
-}
-)",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
-		},
+		Package.GetSortedStructs().VisitAllNodesWithCallback([&Content](int32 Index) -> void
+		{
+			Content.bHasStructs = Content.bHasStructs || IsReachable(Index);
+		});
 
+		Package.GetSortedClasses().VisitAllNodesWithCallback([&Content](int32 Index) -> void
+		{
+			if (!IsReachable(Index))
+				return;
 
-		/* non-static non-inline functions */
-		PredefinedFunction {
-			.CustomComment = "Retuns the name of this object",
-			.ReturnType = "std::string", .NameWithParams = "GetName()", .Body =
-R"({
-	return this ? Name.ToString() : "None";
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "Returns the name of this object in the format 'Class Package.Outer.Object'",
-			.ReturnType = "std::string", .NameWithParams = "GetFullName()", .Body =
-R"({
-	if (this && Class)
-	{
-		std::string Temp;
+			Content.bHasClasses = true;
 
-		for (UObject* NextOuter = Outer; NextOuter; NextOuter = NextOuter->Outer)
-		{
-			Temp = NextOuter->GetName() + "." + Temp;
-		}
+			for (UEFunction Func : ObjectArray::GetByIndex<UEClass>(Index).GetFunctions())
+			{
+				Content.bHasFunctions = true;
+				Content.bHasParameterStructs = Content.bHasParameterStructs || Func.HasMembers();
+			}
+		});
 
-		std::string Name = Class->GetName();
-		Name += " ";
-		Name += Temp;
-		Name += GetName();
+		for (int32 EnumIndex : Package.GetEnums())
+			Content.bHasEnums = Content.bHasEnums || IsReachable(EnumIndex);
+	}
+
+	std::cout << std::format("Tree-shaking: {} structs, classes and enums are reachable from {} root(s)\n", ReachableObjects.size(), Settings::CppGenerator::SDKRoots.size());
+}
+
+bool CppGenerator::IsReachable(int32 ObjectIndex)
+{
+	return !IsTreeShaking() || ReachableObjects.contains(ObjectIndex);
+}
 
-		return Name;
+CppGenerator::PackageContent CppGenerator::GetPackageContent(PackageInfoHandle Package)
+{
+	if (!IsTreeShaking())
+	{
+		return PackageContent{
+			.bHasStructs = Package.HasStructs(), .bHasClasses = Package.HasClasses(), .bHasEnums = Package.HasEnums(), .bHasFunctions = Package.HasFunctions(), .bHasParameterStructs = Package.HasParameterStructs()
+		};
 	}
 
-	return "None";
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction{
-			.CustomComment = "Checks a UObjects' type by Class",
-			.ReturnType = "bool", .NameWithParams = "IsA(class UClass* TypeClass)", .Body =
-R"({
-	return Class->IsSubclassOf(TypeClass);
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction{
-			.CustomComment = "Checks a UObjects' type by TypeFlags",
-			.ReturnType = "bool", .NameWithParams = "IsA(EClassCastFlags TypeFlags)", .Body =
-R"({
-	return (Class->CastFlags & TypeFlags);
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction{
-			.CustomComment = "Checks Class->FunctionFlags for TypeFlags",
-			.ReturnType = "bool", .NameWithParams = "HasTypeFlag(EClassCastFlags TypeFlags)", .Body =
-R"({
-	return (Class->CastFlags & TypeFlags);
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction{
-			.CustomComment = "Checks whether this object is a classes' default-object",
-			.ReturnType = "bool", .NameWithParams = "IsDefaultObject()", .Body =
-		R"({
-	return (Flags & EObjectFlags::ClassDefaultObject);
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
+	auto It = ReachablePackageContents.find(Package.GetIndex());
 
-		/* non-static inline functions */
-		PredefinedFunction{
-			.CustomComment = "Unreal Function to process all UFunction-calls",
-			.ReturnType = "void", .NameWithParams = "ProcessEvent(class UFunction* Function, void* Parms)", .Body =
-R"({
-	InSDKUtils::CallGameFunction(InSDKUtils::GetVirtualFunction<void(*)(const UObject*, class UFunction*, void*)>(this, Offsets::ProcessEventIdx), this, Function, Parms);
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-		},
-	};
+	return It != ReachablePackageContents.end() ? It->second : PackageContent{};
+}
 
-	UEClass Struct = ObjectArray::FindClassFast("Struct");
+std::string CppGenerator::GetStructHeaderPath(const StructWrapper& Struct)
+{
+	const std::string PackageName = PackageManager::GetName(Struct.GetUnrealStruct().GetPackageIndex());
 
-	const int32 UStructIdx = Struct ? Struct.GetIndex() : ObjectArray::FindClassFast("struct").GetIndex(); // misspelled on some UE versions.
+	return Settings::CppGenerator::FilePrefix + PackageName + "/" + Struct.GetUniqueName().first + ".hpp";
+}
 
-	PredefinedElements& UStructPredefs = PredefinedMembers[UStructIdx];
+std::string CppGenerator::GetEnumHeaderPath(int32 PackageIndex)
+{
+	return Settings::CppGenerator::FilePrefix + PackageManager::GetName(PackageIndex) + "/Enums.hpp";
+}
 
-	UStructPredefs.Functions =
-	{
-		PredefinedFunction {
-			.CustomComment = "Checks if this class has a certain base",
-			.ReturnType = "bool", .NameWithParams = "IsSubclassOf(const UStruct* Base)", .Body =
-R"({
-	if (!Base)
-		return false;
+std::vector<int32> CppGenerator::GetDirectStructDependencies(UEStruct Struct)
+{
+	std::vector<int32> Dependencies;
 
-	for (const UStruct* Struct = this; Struct; Struct = Struct->Super)
+	if (UEStruct Super = Struct.GetSuper())
+		Dependencies.push_back(Super.GetIndex());
+
+	for (int32 DependencyIndex : PackageManagerUtils::GetDependencies(Struct, Struct.GetIndex()))
 	{
-		if (Struct == Base)
-			return true;
+		/* Enums are defined in a header per package, see GetEnumHeaderPath() */
+		if (!ObjectArray::GetByIndex(DependencyIndex).IsA(EClassCastFlags::Enum))
+			Dependencies.push_back(DependencyIndex);
 	}
 
-	return false;
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-	};
+	std::sort(Dependencies.begin(), Dependencies.end());
+	Dependencies.erase(std::unique(Dependencies.begin(), Dependencies.end()), Dependencies.end());
 
-	PredefinedElements& UClassPredefs = PredefinedMembers[ObjectArray::FindClassFast("Class").GetIndex()];
+	return Dependencies;
+}
 
-	UClassPredefs.Functions =
+const std::unordered_set<int32>& CppGenerator::GetStructIncludeClosure(int32 StructIndex)
+{
+	if (auto It = StructIncludeClosures.find(StructIndex); It != StructIncludeClosures.end())
+		return It->second;
+
+	/*
+	* Structs can include each other through delegate-parameters. Tarjan's algorithm finds these cycles, a closure is only stored once the
+	* whole strongly connected component it belongs to is known. All structs of a component share their closure, which contains the component itself.
+	*/
+	struct VisitState
 	{
-		/* non-static non-inline functions */
-		PredefinedFunction {
-			.CustomComment = "Gets a UFunction from this UClasses' 'Children' list",
-			.ReturnType = "class UFunction*", .NameWithParams = "GetFunction(const std::string& ClassName, const std::string& FuncName)", .Body =
-R"({
-	for(const UStruct* Clss = this; Clss; Clss = Clss->Super)
+		int32 Order;
+		int32 LowLink;
+		bool bIsOnStack;
+		std::vector<int32> Dependencies;
+	};
+
+	std::unordered_map<int32, VisitState> States;
+	std::vector<int32> Stack;
+	int32 NextOrder = 0;
+
+	auto Visit = [&](auto& Self, int32 Index) -> void
 	{
-		if (Clss->GetName() != ClassName)
-			continue;
-			
-		for (UField* Field = Clss->Children; Field; Field = Field->Next)
+		States[Index] = { NextOrder, NextOrder, true, GetDirectStructDependencies(ObjectArray::GetByIndex<UEStruct>(Index)) };
+		NextOrder++;
+
+		Stack.push_back(Index);
+
+		for (int32 DependencyIndex : States[Index].Dependencies)
 		{
-			if(Field->HasTypeFlag(EClassCastFlags::Function) && Field->GetName() == FuncName)
-				return static_cast<class UFunction*>(Field);
-		}
-	}
+			/* Part of a component that is already done */
+			if (StructIncludeClosures.contains(DependencyIndex))
+				continue;
 
-	return nullptr;
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-	};
+			auto DependencyIt = States.find(DependencyIndex);
 
+			if (DependencyIt == States.end())
+			{
+				Self(Self, DependencyIndex);
+				States[Index].LowLink = std::min(States[Index].LowLink, States[DependencyIndex].LowLink);
+			}
+			else if (DependencyIt->second.bIsOnStack)
+			{
+				States[Index].LowLink = std::min(States[Index].LowLink, DependencyIt->second.Order);
+			}
+		}
 
-	PredefinedElements& UEnginePredefs = PredefinedMembers[ObjectArray::FindClassFast("Engine").GetIndex()];
+		if (States[Index].LowLink != States[Index].Order)
+			return;
 
-	UEnginePredefs.Functions =
-	{
-		/* static non-inline functions */
-		PredefinedFunction {
-			.CustomComment = "Gets a pointer to a valid UObject of type UEngine",
-			.ReturnType = "class UEngine*", .NameWithParams = "GetEngine()", .Body =
-R"({
-	static UEngine* GEngine = nullptr;
+		std::vector<int32> Component;
 
-	if (GEngine)
-		return GEngine;
-	
-	/* (Re-)Initialize if GEngine is nullptr */
-	for (int i = 0; i < UObject::GObjects->Num(); i++)
-	{
-		UObject* Obj = UObject::GObjects->GetByIndex(i);
+		do
+		{
+			Component.push_back(Stack.back());
+			Stack.pop_back();
 
-		if (!Obj)
-			continue;
+			States[Component.back()].bIsOnStack = false;
+		} while (Component.back() != Index);
 
-		if (Obj->IsA(UEngine::StaticClass()) && !Obj->IsDefaultObject())
+		std::unordered_set<int32> Closure;
+
+		/* Dependencies within the component are inserted directly, all others were finished before this component */
+		for (int32 Member : Component)
 		{
-			GEngine = static_cast<UEngine*>(Obj);
-			break;
+			for (int32 DependencyIndex : States[Member].Dependencies)
+			{
+				Closure.insert(DependencyIndex);
+
+				if (auto It = StructIncludeClosures.find(DependencyIndex); It != StructIncludeClosures.end())
+					Closure.insert(It->second.begin(), It->second.end());
+			}
 		}
-	}
 
-	return GEngine; 
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
-		},
+		for (int32 Member : Component)
+			StructIncludeClosures[Member] = Closure;
 	};
 
+	Visit(Visit, StructIndex);
 
-	PredefinedElements& UGameEnginePredefs = PredefinedMembers[ObjectArray::FindClassFast("GameEngine").GetIndex()];
+	return StructIncludeClosures[StructIndex];
+}
 
-	UGameEnginePredefs.Functions =
-	{
-		/* static non-inline functions */
-		PredefinedFunction {
-			.CustomComment = "Returns the result of UEngine::GetEngine() without a type-check, might be dangerous",
-			.ReturnType = "class UGameEngine*", .NameWithParams = "GetEngine()", .Body =
-R"({
-	return static_cast<UGameEngine*>(UEngine::GetEngine());
-})",
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
-		},
-	};
+std::vector<int32> CppGenerator::GetMinimalStructIncludes(UEStruct Struct)
+{
+	const std::vector<int32> DirectDependencies = GetDirectStructDependencies(Struct);
 
+	std::vector<int32> Includes;
+	Includes.reserve(DirectDependencies.size());
 
-	PredefinedElements& UWorldPredefs = PredefinedMembers[ObjectArray::FindClassFast("World").GetIndex()];
+	for (int32 DependencyIndex : DirectDependencies)
+	{
+		auto IsIncludedByOtherDependency = [DependencyIndex](int32 OtherIndex) -> bool
+		{
+			if (OtherIndex == DependencyIndex || !GetStructIncludeClosure(OtherIndex).contains(DependencyIndex))
+				return false;
 
-	constexpr const char* GetWorldThroughGWorldCode = R"(
-	if constexpr (Offsets::GWorld != 0)
-		return *reinterpret_cast<UWorld**>(InSDKUtils::GetImageBase() + Offsets::GWorld);
-)";
+			/* Dependencies including each other, only the one with the lowest index is included */
+			return OtherIndex < DependencyIndex || !GetStructIncludeClosure(DependencyIndex).contains(OtherIndex);
+		};
 
-	UWorldPredefs.Functions =
-	{
-		/* static non-inline functions */
-		PredefinedFunction {
-			.CustomComment = "Gets a pointer to the current World of the GameViewport",
-			.ReturnType = "class UWorld*", .NameWithParams = "GetWorld()", .Body =
-std::format(R"({{{}
-	if (UEngine* Engine = UEngine::GetEngine())
-	{{
-		if (!Engine->GameViewport)
-			return nullptr;
+		if (!std::any_of(DirectDependencies.begin(), DirectDependencies.end(), IsIncludedByOtherDependency))
+			Includes.push_back(DependencyIndex);
+	}
 
-		return Engine->GameViewport->World;
-	}}
+	return Includes;
+}
 
-	return nullptr;
-}})", !Settings::CppGenerator::bForceNoGWorldInSDK ?  GetWorldThroughGWorldCode : ""),
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
-		},
-	};
+void CppGenerator::GenerateStructHeader(const StructWrapper& Struct, StreamType& FunctionFile, StreamType& ParamFile, int32 PackageIndex)
+{
+	const UEStruct UnrealStruct = Struct.GetUnrealStruct();
+	const std::string HeaderPath = GetStructHeaderPath(Struct);
 
-	UEStruct Vector = ObjectArray::FindObjectFast<UEStruct>("Vector");
+	StreamType StructHeader(Subfolder / reinterpret_cast<const std::u8string&>(HeaderPath));
 
-	PredefinedElements& FVectorPredefs = PredefinedMembers[Vector.GetIndex()];
+	if (!StructHeader.is_open())
+		std::cout << "Error opening file \"" << HeaderPath << "\"" << std::endl;
 
-	FVectorPredefs.Members.push_back(PredefinedMember{
-		PredefinedMember{
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = std::format("using UnderlayingType = {}", (Settings::Internal::bUseLargeWorldCoordinates ? "double" : "float")), .Name = "", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF,
+	/* Enums of members and function-parameters, functions are only declared so structs used as parameters don't need to be included */
+	std::unordered_set<int32> EnumDependencies = PackageManagerUtils::GetDependencies(UnrealStruct, UnrealStruct.GetIndex());
+
+	if (Struct.IsClass())
+	{
+		for (UEFunction Func : UnrealStruct.GetFunctions())
+		{
+			const std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(Func, Func.GetIndex());
+			EnumDependencies.insert(ParamDependencies.begin(), ParamDependencies.end());
 		}
-	});
+	}
 
-	FVectorPredefs.Functions =
+	std::set<std::string> EnumIncludes;
+
+	for (int32 DependencyIndex : EnumDependencies)
 	{
-		/* const operators */
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "FVector", .NameWithParams = "operator+(const FVector& Other)", .Body =
-R"({
+		UEObject Dependency = ObjectArray::GetByIndex(DependencyIndex);
+
+		if (Dependency.IsA(EClassCastFlags::Enum))
+			EnumIncludes.insert(std::format("#include \"../{}\"\n", GetEnumHeaderPath(Dependency.GetPackageIndex())));
+	}
+
+	std::string Includes;
+
+	for (const std::string& EnumInclude : EnumIncludes)
+		Includes += EnumInclude;
+
+	for (int32 DependencyIndex : GetMinimalStructIncludes(UnrealStruct))
+		Includes += std::format("#include \"../{}\"\n", GetStructHeaderPath(ObjectArray::GetByIndex<UEStruct>(DependencyIndex)));
+
+	WriteFileHead(StructHeader, nullptr, EFileType::StructHeader, Struct.GetFullName(), Includes);
+
+	GenerateStruct(Struct, StructHeader, FunctionFile, ParamFile, PackageIndex);
+
+	WriteFileEnd(StructHeader, EFileType::StructHeader);
+}
+
+void CppGenerator::Generate()
+{
+	InitReachableObjects();
+
+	StructIncludeClosures.clear();
+
+	// Generate SDK.hpp, NameCollisions.inl and other files covering all packages
+	GenerateAllPackagesFiles();
+
+	// Generate PropertyFixup.hpp
+	StreamType PropertyFixup(MainFolder / "PropertyFixup.hpp");
+	GeneratePropertyFixupFile(PropertyFixup);
+
+	// Generate UnrealContainers.hpp
+	StreamType UnrealContainers(MainFolder / "UnrealContainers.hpp");
+	GenerateUnrealContainers(UnrealContainers);
+
+	// Generate UtfN.hpp
+	StreamType UnicodeLib(MainFolder / "UtfN.hpp");
+	GenerateUnicodeLib(UnicodeLib);
+
+	// Generate Basic.hpp and Basic.cpp files
+	StreamType BasicHpp(Subfolder / "Basic.hpp");
+	StreamType BasicCpp(Subfolder / "Basic.cpp");
+	GenerateBasicFiles(BasicHpp, BasicCpp);
+
+	if constexpr (Settings::CppGenerator::bGenerateModuleAndPCH)
+	{
+		// Generate SDK.ixx module interface unit and SDK_PCH.hpp precompiled header, both including SDK.hpp
+		StreamType SdkModule(MainFolder / "SDK.ixx");
+		StreamType PrecompiledHeader(MainFolder / "SDK_PCH.hpp");
+		GenerateModuleAndPCHFiles(SdkModule, PrecompiledHeader);
+	}
+
+	// Generates all packages and writes them to files
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		GeneratePackage(Package);
+	}
+
+	if constexpr (Settings::CppGenerator::NumUnityBuildFiles > 0)
+	{
+		// Generate UnityBuild_N.cpp files, each including a group of PackageName_functions.cpp files
+		GenerateUnityBuildFiles();
+	}
+}
+
+void CppGenerator::GenerateDelta(const std::unordered_set<int32>& PackagesToRegenerate, const std::vector<std::string>& RemovedPackages)
+{
+	for (const std::string& PackageName : RemovedPackages)
+		RemovePackageFiles(PackageName);
+
+	/* Names of existing types can become non-unique through new types, which changes their type-strings */
+	CachedTypeStrings.clear();
+
+	InitReachableObjects();
+
+	StructIncludeClosures.clear();
+
+	GenerateAllPackagesFiles();
+
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		if (!PackagesToRegenerate.contains(Package.GetIndex()))
+			continue;
+
+		/* Packages might have lost types, files that wouldn't be generated anymore must not be left behind */
+		RemovePackageFiles(Package.GetName());
+		GeneratePackage(Package);
+	}
+
+	if constexpr (Settings::CppGenerator::NumUnityBuildFiles > 0)
+		GenerateUnityBuildFiles();
+}
+
+void CppGenerator::GenerateAllPackagesFiles()
+{
+	// Generate SDK.hpp with sorted packages
+	StreamType SdkHpp(MainFolder / "SDK.hpp");
+	GenerateSDKHeader(SdkHpp);
+
+	// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
+	StreamType NameCollisionsInl(MainFolder / "NameCollisions.inl");
+	GenerateNameCollisionsInl(NameCollisionsInl);
+
+	if constexpr (Settings::Debug::bGenerateAssertionFile)
+	{
+		// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets
+		StreamType DebugAssertions(MainFolder / "Assertions.inl");
+		GenerateDebugAssertions(DebugAssertions);
+	}
+
+	if constexpr (Settings::CppGenerator::bGenerateReflectionHeader)
+	{
+		// Generate Reflection.hpp file containing perfect-hash tables of the members of all structs/classes
+		StreamType ReflectionHeader(MainFolder / "Reflection.hpp");
+		GenerateReflectionHeader(ReflectionHeader);
+	}
+}
+
+void CppGenerator::RemovePackageFiles(const std::string& PackageName)
+{
+	const std::string FileName = Settings::CppGenerator::FilePrefix + PackageName;
+	const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
+
+	std::error_code ErrorCode;
+
+	for (const char8_t* Suffix : { u8"_classes.hpp", u8"_structs.hpp", u8"_parameters.hpp", u8"_functions.cpp", u8"_assertions.cpp" })
+		fs::remove(Subfolder / (U8FileName + Suffix), ErrorCode);
+
+	/* Per-class headers and the enum header */
+	fs::remove_all(Subfolder / U8FileName, ErrorCode);
+}
+
+void CppGenerator::GeneratePackage(PackageInfoHandle Package)
+{
+	const PackageContent Content = GetPackageContent(Package);
+
+	if (Content.IsEmpty())
+		return;
+
+	const std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
+	const std::u8string U8FileName = reinterpret_cast<const std::u8string&>(FileName);
+
+	StreamType ClassesFile;
+	StreamType StructsFile;
+	StreamType EnumsFile;
+	StreamType ParametersFile;
+	StreamType FunctionsFile;
+
+	/* With per-class headers the "_classes.hpp" and "_structs.hpp" files only include the headers of all classes/structs of this package */
+	std::string ClassHeaderIncludes;
+	std::string StructHeaderIncludes;
+
+	if constexpr (Settings::CppGenerator::bGeneratePerClassHeaders)
+	{
+		fs::create_directories(Subfolder / U8FileName);
+
+		auto AddHeaderInclude = [](std::string& OutIncludes) -> DependencyManager::OnVisitCallbackType
+		{
+			return [&OutIncludes](int32 Index) -> void
+			{
+				if (IsReachable(Index))
+					OutIncludes += std::format("#include \"{}\"\n", GetStructHeaderPath(ObjectArray::GetByIndex<UEStruct>(Index)));
+			};
+		};
+
+		if (Content.bHasEnums)
+		{
+			const std::string EnumHeaderPath = GetEnumHeaderPath(Package.GetIndex());
+
+			EnumsFile = StreamType(Subfolder / reinterpret_cast<const std::u8string&>(EnumHeaderPath));
+
+			if (!EnumsFile.is_open())
+				std::cout << "Error opening file \"" << EnumHeaderPath << "\"" << std::endl;
+
+			WriteFileHead(EnumsFile, nullptr, EFileType::EnumHeader, std::format("Enums of package {}", Package.GetName()));
+
+			StructHeaderIncludes += std::format("#include \"{}\"\n", EnumHeaderPath);
+		}
+
+		if (Content.bHasStructs)
+			Package.GetSortedStructs().VisitAllNodesWithCallback(AddHeaderInclude(StructHeaderIncludes));
+
+		if (Content.bHasClasses)
+			Package.GetSortedClasses().VisitAllNodesWithCallback(AddHeaderInclude(ClassHeaderIncludes));
+	}
+
+	/* Create files and handles namespaces and includes */
+	if (Content.bHasClasses)
+	{
+		ClassesFile = StreamType(Subfolder / (U8FileName + u8"_classes.hpp"));
+
+		if (!ClassesFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
+
+		WriteFileHead(ClassesFile, Package, EFileType::Classes, "", ClassHeaderIncludes);
+
+		/* Write enum foward declarations before all of the classes */
+		GenerateEnumFwdDeclarations(ClassesFile, Package, true);
+	}
+
+	if (Content.bHasStructs || Content.bHasEnums)
+	{
+		StructsFile = StreamType(Subfolder / (U8FileName + u8"_structs.hpp"));
+
+		if (!StructsFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
+
+		WriteFileHead(StructsFile, Package, EFileType::Structs, "", StructHeaderIncludes);
+
+		/* Write enum foward declarations before all of the structs */
+		GenerateEnumFwdDeclarations(StructsFile, Package, false);
+	}
+
+	if (Content.bHasParameterStructs)
+	{
+		ParametersFile = StreamType(Subfolder / (U8FileName + u8"_parameters.hpp"));
+
+		if (!ParametersFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
+
+		WriteFileHead(ParametersFile, Package, EFileType::Parameters);
+	}
+
+	if (Content.bHasFunctions)
+	{
+		FunctionsFile = StreamType(Subfolder / (U8FileName + u8"_functions.cpp"));
+
+		if (!FunctionsFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
+
+		WriteFileHead(FunctionsFile, Package, EFileType::Functions);
+	}
+
+	const int32 PackageIndex = Package.GetIndex();
+
+	/* 
+	* Generate classes/structs/enums/functions directly into the respective files
+	* 
+	* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
+	*/
+	for (int32 EnumIdx : Package.GetEnums())
+	{
+		if (IsReachable(EnumIdx))
+			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), Settings::CppGenerator::bGeneratePerClassHeaders ? EnumsFile : StructsFile);
+	}
+
+	if (Content.bHasStructs)
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
+
+		DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
+		{
+			if (!IsReachable(Index))
+				return;
+
+			if constexpr (Settings::CppGenerator::bGeneratePerClassHeaders)
+			{
+				GenerateStructHeader(ObjectArray::GetByIndex<UEStruct>(Index), FunctionsFile, ParametersFile, PackageIndex);
+			}
+			else
+			{
+				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
+			}
+		};
+
+		Structs.VisitAllNodesWithCallback(GenerateStructCallback);
+	}
+
+	if (Content.bHasClasses)
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
+
+		DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
+		{
+			if (!IsReachable(Index))
+				return;
+
+			if constexpr (Settings::CppGenerator::bGeneratePerClassHeaders)
+			{
+				GenerateStructHeader(ObjectArray::GetByIndex<UEStruct>(Index), FunctionsFile, ParametersFile, PackageIndex);
+			}
+			else
+			{
+				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
+			}
+		};
+
+		Classes.VisitAllNodesWithCallback(GenerateClassCallback);
+	}
+
+
+	/* Closes any namespaces if required */
+	if (Content.bHasClasses)
+		WriteFileEnd(ClassesFile, EFileType::Classes);
+
+	if (Content.bHasStructs || Content.bHasEnums)
+		WriteFileEnd(StructsFile, EFileType::Structs);
+
+	if (EnumsFile.is_open())
+		WriteFileEnd(EnumsFile, EFileType::EnumHeader);
+
+	if (Content.bHasParameterStructs)
+		WriteFileEnd(ParametersFile, EFileType::Parameters);
+
+	if (Content.bHasFunctions)
+		WriteFileEnd(FunctionsFile, EFileType::Functions);
+
+	if constexpr (Settings::Debug::bMoveInlineAssertionsToPackageFiles)
+		GeneratePackageAssertions(Package, Content);
+}
+
+void CppGenerator::InitPredefinedMembers()
+{
+	static auto SortMembers = [](std::vector<PredefinedMember>& Members) -> void
+	{
+		std::sort(Members.begin(), Members.end(), ComparePredefinedMembers);
+	};
+
+	/* Assumes Members to be sorted */
+	static auto InitStructSize = [](PredefinedStruct& Struct) -> void
+	{
+		if (Struct.Size > 0x0)
+			return;
+
+		if (Struct.Properties.empty() && Struct.Super)
+			Struct.Size = Struct.Super->Size;
+
+		const PredefinedMember& LastMember = Struct.Properties[Struct.Properties.size() - 1];
+		Struct.Size = LastMember.Offset + LastMember.Size;
+	};
+
+
+	if (Off::InSDK::ULevel::Actors != -1)
+	{
+		UEClass Level = ObjectArray::FindClassFast("Level");
+
+		if (Level == nullptr)
+			Level = ObjectArray::FindClassFast("level");
+
+		PredefinedElements& ULevelPredefs = PredefinedMembers[Level.GetIndex()];
+		ULevelPredefs.Members =
+		{
+			PredefinedMember {
+				.Comment = "THIS IS THE ARRAY YOU'RE LOOKING FOR! [NOT AUTO-GENERATED PROPERTY]",
+				.Type = "class TArray<class AActor*>", .Name = "Actors", .Offset = Off::InSDK::ULevel::Actors, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+	}
+
+	UEClass DataTable = ObjectArray::FindClassFast("DataTable");
+
+	PredefinedElements& UDataTablePredefs = PredefinedMembers[DataTable.GetIndex()];
+	UDataTablePredefs.Members =
+	{
+		PredefinedMember {
+			.Comment = "So, here's a RowMap. Good luck with it.",
+			.Type = "TMap<class FName, uint8*>", .Name = "RowMap", .Offset = Off::InSDK::UDataTable::RowMap, .Size = 0x50, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	PredefinedElements& UObjectPredefs = PredefinedMembers[ObjectArray::FindClassFast("Object").GetIndex()];
+	UObjectPredefs.Members = 
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "inline class TUObjectArrayWrapper", .Name = "GObjects", .Offset = 0x0, .Size = sizeof(void*), .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "void*", .Name = "VTable", .Offset = Off::UObject::Vft, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "EObjectFlags", .Name = "Flags", .Offset = Off::UObject::Flags, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "Index", .Offset = Off::UObject::Index, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UClass*", .Name = "Class", .Offset = Off::UObject::Class, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class FName", .Name = "Name", .Offset = Off::UObject::Name, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UObject*", .Name = "Outer", .Offset = Off::UObject::Outer, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	PredefinedElements& UFieldPredefs = PredefinedMembers[ObjectArray::FindClassFast("Field").GetIndex()];
+	UFieldPredefs.Members =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UField*", .Name = "Next", .Offset = Off::UField::Next, .Size = 0x8, .ArrayDim = 0x1, .Alignment =0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	PredefinedElements& UEnumPredefs = PredefinedMembers[ObjectArray::FindClassFast("Enum").GetIndex()];
+	UEnumPredefs.Members =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class TArray<class TPair<class FName, int64>>", .Name = "Names", .Offset = Off::UEnum::Names, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	UEObject UStruct = ObjectArray::FindClassFast("Struct");
+
+	if (UStruct == nullptr)
+		UStruct = ObjectArray::FindClassFast("struct");
+
+	PredefinedElements& UStructPredefs = PredefinedMembers[UStruct.GetIndex()];
+	UStructPredefs.Members =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UStruct*", .Name = "Super", .Offset = Off::UStruct::SuperStruct, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UField*", .Name = "Children", .Offset = Off::UStruct::Children, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "MinAlignemnt", .Offset = Off::UStruct::MinAlignemnt, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "Size", .Offset = Off::UStruct::Size, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	if (Settings::Internal::bUseFProperty)
+	{
+		UStructPredefs.Members.push_back({
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class FField*", .Name = "ChildProperties", .Offset = Off::UStruct::ChildProperties, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		});
+	}
+
+	PredefinedElements& UFunctionPredefs = PredefinedMembers[ObjectArray::FindClassFast("Function").GetIndex()];
+	UFunctionPredefs.Members =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "using FNativeFuncPtr = void (*)(void* Context, void* TheStack, void* Result)", .Name = "", .Offset = 0x0, .Size = 0x00, .ArrayDim = 0x1, .Alignment = 0x0,
+			.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint32", .Name = "FunctionFlags", .Offset = Off::UFunction::FunctionFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "FNativeFuncPtr", .Name = "ExecFunction", .Offset = Off::UFunction::ExecFunction, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	PredefinedElements& UClassPredefs = PredefinedMembers[ObjectArray::FindClassFast("Class").GetIndex()];
+	UClassPredefs.Members =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "enum class EClassCastFlags", .Name = "CastFlags", .Offset = Off::UClass::CastFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UObject*", .Name = "DefaultObject", .Offset = Off::UClass::ClassDefaultObject, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::string PropertyTypePtr = Settings::Internal::bUseFProperty ? "class FProperty*" : "class UProperty*";
+
+	std::vector<PredefinedMember> PropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "ArrayDim", .Offset = Off::Property::ArrayDim, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "ElementSize", .Offset = Off::Property::ElementSize, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false,  .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint64", .Name = "PropertyFlags", .Offset = Off::Property::PropertyFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "Offset", .Offset = Off::Property::Offset_Internal, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> BytePropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UEnum*", .Name = "Enum", .Offset = Off::ByteProperty::Enum, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> BoolPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint8", .Name = "FieldSize", .Offset = Off::BoolProperty::Base, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint8", .Name = "ByteOffset", .Offset = Off::BoolProperty::Base + 0x1, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
+			.bIsStatic = false, .bIsZeroSizeMember = false,  .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint8", .Name = "ByteMask", .Offset = Off::BoolProperty::Base + 0x2, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint8", .Name = "FieldMask", .Offset = Off::BoolProperty::Base + 0x3, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x1,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> ObjectPropertyBaseMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UClass*", .Name = "PropertyClass", .Offset = Off::ObjectProperty::PropertyClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> ClassPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UClass*", .Name = "MetaClass", .Offset = Off::ClassProperty::MetaClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> StructPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UStruct*", .Name = "Struct", .Offset = Off::StructProperty::Struct, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> ArrayPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = PropertyTypePtr, .Name = "InnerProperty", .Offset = Off::ArrayProperty::Inner, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> DelegatePropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UFunction*", .Name = "SignatureFunction", .Offset = Off::DelegateProperty::SignatureFunction, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> MapPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = PropertyTypePtr, .Name = "KeyProperty", .Offset = Off::MapProperty::Base, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = PropertyTypePtr, .Name = "ValueProperty", .Offset = Off::MapProperty::Base + 0x8, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> SetPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = PropertyTypePtr, .Name = "ElementProperty", .Offset = Off::SetProperty::ElementProp, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> EnumPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = PropertyTypePtr, .Name = "UnderlayingProperty", .Offset = Off::EnumProperty::Base, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class UEnum*", .Name = "Enum", .Offset = Off::EnumProperty::Base + 0x8, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> FieldPathPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class FFieldClass*", .Name = "FieldClass", .Offset = Off::FieldPathProperty::FieldClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	std::vector<PredefinedMember> OptionalPropertyMembers =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = PropertyTypePtr, .Name = "ValueProperty", .Offset = Off::OptionalProperty::ValueProperty, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	SortMembers(UObjectPredefs.Members);
+	SortMembers(UFieldPredefs.Members);
+	SortMembers(UEnumPredefs.Members);
+	SortMembers(UStructPredefs.Members);
+	SortMembers(UFunctionPredefs.Members);
+	SortMembers(UClassPredefs.Members);
+
+	SortMembers(PropertyMembers);
+	SortMembers(BytePropertyMembers);
+	SortMembers(BoolPropertyMembers);
+	SortMembers(ObjectPropertyBaseMembers);
+	SortMembers(ClassPropertyMembers);
+	SortMembers(StructPropertyMembers);
+	SortMembers(ArrayPropertyMembers);
+	SortMembers(DelegatePropertyMembers);
+	SortMembers(MapPropertyMembers);
+	SortMembers(SetPropertyMembers);
+	SortMembers(FieldPathPropertyMembers);
+	SortMembers(OptionalPropertyMembers);
+
+	if (!Settings::Internal::bUseFProperty)
+	{
+		auto AssignValueIfObjectIsFound = [](const std::string& ClassName, std::vector<PredefinedMember>&& Members) -> void
+		{
+			if (UEClass Class = ObjectArray::FindClassFast(ClassName))
+				PredefinedMembers[Class.GetIndex()].Members = std::move(Members);
+		};
+
+		AssignValueIfObjectIsFound("Property", std::move(PropertyMembers));
+		AssignValueIfObjectIsFound("ByteProperty", std::move(BytePropertyMembers));
+		AssignValueIfObjectIsFound("BoolProperty", std::move(BoolPropertyMembers));
+		AssignValueIfObjectIsFound("ObjectPropertyBase", std::move(ObjectPropertyBaseMembers));
+		AssignValueIfObjectIsFound("ClassProperty", std::move(ClassPropertyMembers));
+		AssignValueIfObjectIsFound("StructProperty", std::move(StructPropertyMembers));
+		AssignValueIfObjectIsFound("DelegateProperty", std::move(DelegatePropertyMembers));
+		AssignValueIfObjectIsFound("ArrayProperty", std::move(ArrayPropertyMembers));
+		AssignValueIfObjectIsFound("MapProperty", std::move(MapPropertyMembers));
+		AssignValueIfObjectIsFound("SetProperty", std::move(SetPropertyMembers));
+		AssignValueIfObjectIsFound("EnumProperty", std::move(EnumPropertyMembers));
+
+		// FieldPathProperty and OptionalProperty don't exist in UE versions which are using UProperty
+		return;
+	}
+	else
+	{
+		/* Reserving enough space is required because otherwise the vector could reallocate and invalidate some structs' 'Super' pointer */
+		PredefinedStructs.reserve(0x20);
+
+		PredefinedStruct& FFieldClass = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FFieldClass", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = nullptr
+		});
+		PredefinedStruct& FFieldVariant = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FFieldVariant", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = nullptr
+		});
+
+		PredefinedStruct& FField = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FField", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = nullptr
+		});
+
+		PredefinedStruct& FProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FProperty", .Size = Off::InSDK::Properties::PropertySize, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = &FField  /* FField */
+		});
+		PredefinedStruct& FByteProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FByteProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FBoolProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FBoolProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FObjectPropertyBase = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FObjectPropertyBase", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FClassProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FClassProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FObjectPropertyBase  /* FObjectPropertyBase */
+		});
+		PredefinedStruct& FStructProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FStructProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FArrayProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FArrayProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FDelegateProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FDelegateProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FMapProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FMapProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FSetProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FSetProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FEnumProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FEnumProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FFieldPathProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FFieldPathProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+		PredefinedStruct& FOptionalProperty = PredefinedStructs.emplace_back(PredefinedStruct{
+			.UniqueName = "FOptionalProperty", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .Super = &FProperty  /* FProperty */
+		});
+
+		FFieldClass.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "FName", .Name = "Name", .Offset = Off::FFieldClass::Name, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint64", .Name = "Id", .Offset = Off::FFieldClass::Id, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint64", .Name = "CastFlags", .Offset = Off::FFieldClass::CastFlags, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "EClassFlags", .Name = "ClassFlags", .Offset = Off::FFieldClass::ClassFlags, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "class FFieldClass*", .Name = "SuperClass", .Offset = Off::FFieldClass::SuperClass, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+
+
+		const int32 FFieldVariantSize = Settings::Internal::bUseMaskForFieldOwner ? 0x8 : 0x10;
+		const int32 IdentifierOffset = Settings::Internal::bUseMaskForFieldOwner ? 0x0 : 0x8;
+		std::string UObjectIdentifierType = (Settings::Internal::bUseMaskForFieldOwner ? "constexpr uint64" : "bool");
+		std::string UObjectIdentifierName = (Settings::Internal::bUseMaskForFieldOwner ? "UObjectMask = 0x1" : "bIsUObject");
+
+		FFieldVariant.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "using ContainerType = union { class FField* Field; class UObject* Object; }", .Name = "", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "ContainerType", .Name = "Container", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = UObjectIdentifierType, .Name = UObjectIdentifierName, .Offset = IdentifierOffset, .Size = 0x01, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = Settings::Internal::bUseMaskForFieldOwner, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+
+
+		FField.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "void*", .Name = "VTable", .Offset = Off::FField::Vft, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "class FFieldClass*", .Name = "ClassPrivate", .Offset = Off::FField::Class, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "FFieldVariant", .Name = "Owner", .Offset = Off::FField::Owner, .Size = FFieldVariantSize, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "class FField*", .Name = "Next", .Offset = Off::FField::Next, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "FName", .Name = "Name", .Offset = Off::FField::Name, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "int32", .Name = "ObjFlags", .Offset = Off::FField::Flags, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+
+		SortMembers(FFieldClass.Properties);
+		SortMembers(FFieldVariant.Properties);
+
+		SortMembers(FField.Properties);
+
+		FProperty.Properties = PropertyMembers;
+		FByteProperty.Properties = BytePropertyMembers;
+		FBoolProperty.Properties = BoolPropertyMembers;
+		FObjectPropertyBase.Properties = ObjectPropertyBaseMembers;
+		FClassProperty.Properties = ClassPropertyMembers;
+		FStructProperty.Properties = StructPropertyMembers;
+		FArrayProperty.Properties = ArrayPropertyMembers;
+		FDelegateProperty.Properties = DelegatePropertyMembers;
+		FMapProperty.Properties = MapPropertyMembers;
+		FSetProperty.Properties = SetPropertyMembers;
+		FEnumProperty.Properties = EnumPropertyMembers;
+		FFieldPathProperty.Properties = FieldPathPropertyMembers;
+		FOptionalProperty.Properties = OptionalPropertyMembers;
+
+		/* Init PredefindedStruct::Size **after** sorting the members */
+		InitStructSize(FFieldClass);
+		InitStructSize(FFieldVariant);
+
+		InitStructSize(FField);
+
+		InitStructSize(FProperty);
+		InitStructSize(FByteProperty);
+		InitStructSize(FBoolProperty);
+		InitStructSize(FObjectPropertyBase);
+		InitStructSize(FClassProperty);
+		InitStructSize(FStructProperty);
+		InitStructSize(FArrayProperty);
+		InitStructSize(FDelegateProperty);
+		InitStructSize(FMapProperty);
+		InitStructSize(FSetProperty);
+		InitStructSize(FEnumProperty);
+		InitStructSize(FFieldPathProperty);
+		InitStructSize(FOptionalProperty);
+	}
+}
+
+
+void CppGenerator::InitPredefinedFunctions()
+{
+	static auto SortFunctions = [](std::vector<PredefinedFunction>& Functions) -> void
+	{
+		std::sort(Functions.begin(), Functions.end(), ComparePredefinedFunctions);
+	};
+
+	PredefinedElements& UObjectPredefs = PredefinedMembers[ObjectArray::FindClassFast("Object").GetIndex()];
+
+	UObjectPredefs.Functions =
+	{
+		/* static non-inline functions */
+		PredefinedFunction {
+			.CustomComment = "Finds a UObject in the global object array by full-name, optionally with ECastFlags to reduce heavy string comparison",
+			.ReturnType = "class UObject*", .NameWithParams = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None)",
+			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body = Settings::CppGenerator::bUseObjectLookupCache ?
+R"({
+	return ObjectLookupCache::FindObject(FullName, RequiredType);
+})" :
+R"({
+	for (int i = 0; i < GObjects->Num(); ++i)
+	{
+		UObject* Object = GObjects->GetByIndex(i);
+	
+		if (!Object)
+			continue;
+		
+		if (Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName)
+			return Object;
+	}
+
+	return nullptr;
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
+		},
+		PredefinedFunction {
+			.CustomComment = "Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison",
+			.ReturnType = "class UObject*", .NameWithParams = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)",
+			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body = Settings::CppGenerator::bUseObjectLookupCache ?
+R"({
+	return ObjectLookupCache::FindObjectFast(Name, RequiredType);
+})" :
+R"({
+	for (int i = 0; i < GObjects->Num(); ++i)
+	{
+		UObject* Object = GObjects->GetByIndex(i);
+	
+		if (!Object)
+			continue;
+		
+		if (Object->HasTypeFlag(RequiredType) && Object->GetName() == Name)
+			return Object;
+	}
+
+	return nullptr;
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
+		},
+
+		/* static inline functions */
+		PredefinedFunction {
+			.CustomComment = "",
+			.CustomTemplateText = "template<typename UEType = UObject>",
+			.ReturnType = "UEType*", .NameWithParams = "FindObject(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)", .Body =
+R"({
+	return static_cast<UEType*>(FindObjectImpl(Name, RequiredType));
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.CustomTemplateText = "template<typename UEType = UObject>",
+			.ReturnType = "UEType*", .NameWithParams = "FindObjectFast(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)", .Body =
+R"({
+	return static_cast<UEType*>(FindObjectFastImpl(Name, RequiredType));
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "class UClass*", .NameWithParams = "FindClass(const std::string& ClassFullName)", .Body =
+R"({
+	return FindObject<class UClass>(ClassFullName, EClassCastFlags::Class);
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "class UClass*", .NameWithParams = "FindClassFast(const std::string& ClassName)", .Body =
+R"({
+	return FindObjectFast<class UClass>(ClassName, EClassCastFlags::Class);
+}
+)",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+		},
+
+
+		/* non-static non-inline functions */
+		PredefinedFunction {
+			.CustomComment = "Retuns the name of this object",
+			.ReturnType = "std::string", .NameWithParams = "GetName()", .Body =
+R"({
+	return this ? std::string(Name.ToStringView()) : "None";
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction {
+			.CustomComment = "Returns the name of this object in the format 'Class Package.Outer.Object'",
+			.ReturnType = "std::string", .NameWithParams = "GetFullName()", .Body =
+R"({
+	if (this && Class)
+	{
+		/* Names are inserted right away, views of decoded names are only valid until the next name is decoded */
+		std::string FullName(Name.ToStringView());
+
+		for (UObject* NextOuter = Outer; NextOuter; NextOuter = NextOuter->Outer)
+		{
+			FullName.insert(0, 1, '.');
+			FullName.insert(0, NextOuter->Name.ToStringView());
+		}
+
+		FullName.insert(0, 1, ' ');
+		FullName.insert(0, Class->Name.ToStringView());
+
+		return FullName;
+	}
+
+	return "None";
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction{
+			.CustomComment = "Checks a UObjects' type by Class",
+			.ReturnType = "bool", .NameWithParams = "IsA(class UClass* TypeClass)", .Body =
+R"({
+	return Class->IsSubclassOf(TypeClass);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction{
+			.CustomComment = "Checks a UObjects' type by TypeFlags",
+			.ReturnType = "bool", .NameWithParams = "IsA(EClassCastFlags TypeFlags)", .Body =
+R"({
+	return (Class->CastFlags & TypeFlags);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction{
+			.CustomComment = "Checks Class->FunctionFlags for TypeFlags",
+			.ReturnType = "bool", .NameWithParams = "HasTypeFlag(EClassCastFlags TypeFlags)", .Body =
+R"({
+	return (Class->CastFlags & TypeFlags);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction{
+			.CustomComment = "Checks whether this object is a classes' default-object",
+			.ReturnType = "bool", .NameWithParams = "IsDefaultObject()", .Body =
+		R"({
+	return (Flags & EObjectFlags::ClassDefaultObject);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+
+		/* non-static inline functions */
+		PredefinedFunction{
+			.CustomComment = "Unreal Function to process all UFunction-calls",
+			.ReturnType = "void", .NameWithParams = "ProcessEvent(class UFunction* Function, void* Parms)", .Body =
+R"({
+	InSDKUtils::CallGameFunction(InSDKUtils::GetVirtualFunction<void(*)(const UObject*, class UFunction*, void*)>(this, Offsets::ProcessEventIdx), this, Function, Parms);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+	};
+
+	UEClass Struct = ObjectArray::FindClassFast("Struct");
+
+	const int32 UStructIdx = Struct ? Struct.GetIndex() : ObjectArray::FindClassFast("struct").GetIndex(); // misspelled on some UE versions.
+
+	PredefinedElements& UStructPredefs = PredefinedMembers[UStructIdx];
+
+	UStructPredefs.Functions =
+	{
+		PredefinedFunction {
+			.CustomComment = "Checks if this class has a certain base",
+			.ReturnType = "bool", .NameWithParams = "IsSubclassOf(const UStruct* Base)", .Body = Settings::CppGenerator::bUseClassHierarchyIndex ?
+R"({
+	return ClassHierarchyIndex::IsSubclassOf(this, Base);
+})" :
+R"({
+	if (!Base)
+		return false;
+
+	for (const UStruct* Struct = this; Struct; Struct = Struct->Super)
+	{
+		if (Struct == Base)
+			return true;
+	}
+
+	return false;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+	};
+
+	PredefinedElements& UClassPredefs = PredefinedMembers[ObjectArray::FindClassFast("Class").GetIndex()];
+
+	UClassPredefs.Functions =
+	{
+		/* non-static non-inline functions */
+		PredefinedFunction {
+			.CustomComment = "Gets a UFunction from this UClasses' 'Children' list",
+			.ReturnType = "class UFunction*", .NameWithParams = "GetFunction(const std::string& ClassName, const std::string& FuncName)", .Body =
+R"({
+	for(const UStruct* Clss = this; Clss; Clss = Clss->Super)
+	{
+		if (Clss->GetName() != ClassName)
+			continue;
+			
+		for (UField* Field = Clss->Children; Field; Field = Field->Next)
+		{
+			if(Field->HasTypeFlag(EClassCastFlags::Function) && Field->GetName() == FuncName)
+				return static_cast<class UFunction*>(Field);
+		}
+	}
+
+	return nullptr;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+	};
+
+
+	PredefinedElements& UEnginePredefs = PredefinedMembers[ObjectArray::FindClassFast("Engine").GetIndex()];
+
+	UEnginePredefs.Functions =
+	{
+		/* static non-inline functions */
+		PredefinedFunction {
+			.CustomComment = "Gets a pointer to a valid UObject of type UEngine",
+			.ReturnType = "class UEngine*", .NameWithParams = "GetEngine()", .Body =
+R"({
+	static UEngine* GEngine = nullptr;
+
+	if (GEngine)
+		return GEngine;
+	
+	/* (Re-)Initialize if GEngine is nullptr */
+	for (UEngine* Engine : TObjectRange<UEngine>())
+	{
+		GEngine = Engine;
+		break;
+	}
+
+	return GEngine; 
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
+		},
+	};
+
+
+	PredefinedElements& UGameEnginePredefs = PredefinedMembers[ObjectArray::FindClassFast("GameEngine").GetIndex()];
+
+	UGameEnginePredefs.Functions =
+	{
+		/* static non-inline functions */
+		PredefinedFunction {
+			.CustomComment = "Returns the result of UEngine::GetEngine() without a type-check, might be dangerous",
+			.ReturnType = "class UGameEngine*", .NameWithParams = "GetEngine()", .Body =
+R"({
+	return static_cast<UGameEngine*>(UEngine::GetEngine());
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
+		},
+	};
+
+
+	PredefinedElements& UWorldPredefs = PredefinedMembers[ObjectArray::FindClassFast("World").GetIndex()];
+
+	constexpr const char* GetWorldThroughGWorldCode = R"(
+	if constexpr (Offsets::GWorld != 0)
+		return *reinterpret_cast<UWorld**>(InSDKUtils::GetImageBase() + Offsets::GWorld);
+)";
+
+	UWorldPredefs.Functions =
+	{
+		/* static non-inline functions */
+		PredefinedFunction {
+			.CustomComment = "Gets a pointer to the current World of the GameViewport",
+			.ReturnType = "class UWorld*", .NameWithParams = "GetWorld()", .Body =
+std::format(R"({{{}
+	if (UEngine* Engine = UEngine::GetEngine())
+	{{
+		if (!Engine->GameViewport)
+			return nullptr;
+
+		return Engine->GameViewport->World;
+	}}
+
+	return nullptr;
+}})", !Settings::CppGenerator::bForceNoGWorldInSDK ?  GetWorldThroughGWorldCode : ""),
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = false
+		},
+	};
+
+	UEClass World = ObjectArray::FindClassFast("World");
+
+	/* Actor enumeration requires the 'Actors' array of ULevel, which isn't a reflected property */
+	if (Off::InSDK::ULevel::Actors != -1 && World.FindMember("PersistentLevel", EClassCastFlags::ObjectProperty))
+	{
+		const bool bHasLevelsArray = static_cast<bool>(World.FindMember("Levels", EClassCastFlags::ArrayProperty));
+
+		constexpr const char* AddStreamingLevelsCode = R"(
+	/* 'Levels' contains the PersistentLevel, as well as all streaming-levels which are currently loaded */
+	for (int32 i = 0; i < Levels.Num(); i++)
+	{
+		if (Levels[i] != PersistentLevel)
+			AddActorsOfLevel(Levels[i]);
+	}
+)";
+
+		UWorldPredefs.Functions.push_back(PredefinedFunction {
+			.CustomComment = "Gets all actors of 'Class' (including subclasses) from the actor-arrays of all loaded levels, without calling any UFunction",
+			.ReturnType = "void", .NameWithParams = "GetActorsOfClass(const class UClass* Class, std::vector<class AActor*>& OutActors)", .Body =
+std::format(R"({{
+	OutActors.clear();
+
+	if (!Class)
+		return;
+
+	/* Actors are prefiltered by CastFlags, the check is exact if 'Class' introduces a CastFlag of its own */
+	const EClassCastFlags RequiredFlags = Class->CastFlags;
+	const UClass* SuperClass = static_cast<const UClass*>(Class->Super);
+	const bool bFlagsAreExact = RequiredFlags != EClassCastFlags::None && (!SuperClass || SuperClass->CastFlags != RequiredFlags);
+
+	auto AddActorsOfLevel = [&](const ULevel* Level) -> void
+	{{
+		if (!Level)
+			return;
+
+		for (int32 i = 0; i < Level->Actors.Num(); i++)
+		{{
+			AActor* Actor = Level->Actors[i];
+
+			if (!Actor || !Actor->Class)
+				continue;
+
+			if (RequiredFlags != EClassCastFlags::None && !(Actor->Class->CastFlags & RequiredFlags))
+				continue;
+
+			if (bFlagsAreExact || Actor->Class->IsSubclassOf(Class))
+				OutActors.push_back(Actor);
+		}}
+	}};
+
+	AddActorsOfLevel(PersistentLevel);
+{}}}
+)", bHasLevelsArray ? AddStreamingLevelsCode : ""),
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		});
+
+		UWorldPredefs.Functions.push_back(PredefinedFunction {
+			.CustomComment = "Gets all actors of type UEType (including subclasses) from all loaded levels",
+			.CustomTemplateText = "template<typename UEType = class AActor>",
+			.ReturnType = "void", .NameWithParams = "GetAllActorsOfClass(std::vector<UEType*>& OutActors)", .Body =
+R"({
+	if constexpr (std::is_same_v<UEType, class AActor>)
+	{
+		GetActorsOfClass(UEType::StaticClass(), OutActors);
+	}
+	else
+	{
+		thread_local std::vector<class AActor*> Actors;
+		GetActorsOfClass(UEType::StaticClass(), Actors);
+
+		OutActors.clear();
+		OutActors.reserve(Actors.size());
+
+		for (class AActor* Actor : Actors)
+			OutActors.push_back(static_cast<UEType*>(Actor));
+	}
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		});
+
+		UWorldPredefs.Functions.push_back(PredefinedFunction {
+			.CustomComment = "Like GetAllActorsOfClass, but the result is cached per class and thread until 'FrameStamp' (eg. a frame-counter), or the World, changes",
+			.CustomTemplateText = "template<typename UEType = class AActor>",
+			.ReturnType = "const std::vector<UEType*>&", .NameWithParams = "GetAllActorsOfClassCached(uint64 FrameStamp)", .Body =
+R"({
+	struct FActorCache
+	{
+		const UWorld* World = nullptr;
+		uint64 FrameStamp = 0;
+		bool bIsValid = false;
+
+		std::vector<UEType*> Actors;
+	};
+
+	thread_local FActorCache Cache;
+
+	if (!Cache.bIsValid || Cache.World != this || Cache.FrameStamp != FrameStamp)
+	{
+		GetAllActorsOfClass<UEType>(Cache.Actors);
+
+		Cache.World = this;
+		Cache.FrameStamp = FrameStamp;
+		Cache.bIsValid = true;
+	}
+
+	return Cache.Actors;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		});
+	}
+
+	UEStruct Vector = ObjectArray::FindObjectFast<UEStruct>("Vector");
+
+	PredefinedElements& FVectorPredefs = PredefinedMembers[Vector.GetIndex()];
+
+	FVectorPredefs.Members.push_back(PredefinedMember{
+		PredefinedMember{
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = std::format("using UnderlayingType = {}", (Settings::Internal::bUseLargeWorldCoordinates ? "double" : "float")), .Name = "", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF,
+		}
+	});
+
+	FVectorPredefs.Functions =
+	{
+		/* const operators */
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "FVector", .NameWithParams = "operator+(const FVector& Other)", .Body =
+R"({
 	return { X + Other.X, Y + Other.Y, Z + Other.Z };
 })",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
@@ -2907,13 +4070,12 @@ void CppGenerator::GenerateBasicFiles(StreamType& BasicHpp, StreamType& BasicCpp
 	std::string CustomIncludes = R"(#define VC_EXTRALEAN
 #define WIN32_LEAN_AND_MEAN
 
-#include <string>
-#include <functional>
-#include <type_traits>
 )";
 
+	CustomIncludes += SDKStandardLibraryIncludes;
+
 	WriteFileHead(BasicHpp, nullptr, EFileType::BasicHpp, "Basic file containing structs required by the SDK", CustomIncludes);
-	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", "#include <Windows.h>");
+	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", "#include <Windows.h>\n#include <algorithm>\n#include <mutex>\n#include <shared_mutex>\n#include <unordered_map>\n#include <vector>");
 
 
 	/* use namespace of UnrealContainers */
@@ -2930,6 +4092,7 @@ using namespace UC;
 * Disclaimer:
 *	- The 'GNames' is only a fallback and null by default, FName::AppendString is used
 *	- THe 'GWorld' offset is not used by the SDK, it's just there for "decoration", use the provided 'UWorld::GetWorld()' function instead
+*	- The same applies to 'GEngine', use 'UEngine::GetEngine()' instead
 */
 namespace Offsets
 {{
@@ -2937,10 +4100,11 @@ namespace Offsets
 	constexpr int32 AppendString      = 0x{:08X};
 	constexpr int32 GNames            = 0x{:08X};
 	constexpr int32 GWorld            = 0x{:08X};
+	constexpr int32 GEngine           = 0x{:08X};
 	constexpr int32 ProcessEvent      = 0x{:08X};
 	constexpr int32 ProcessEventIdx   = 0x{:08X};
 }}
-)", Off::InSDK::ObjArray::GObjects, Off::InSDK::Name::AppendNameToString, Off::InSDK::NameArray::GNames, Off::InSDK::World::GWorld, Off::InSDK::ProcessEvent::PEOffset, Off::InSDK::ProcessEvent::PEIndex);
+)", Off::InSDK::ObjArray::GObjects, Off::InSDK::Name::AppendNameToString, Off::InSDK::NameArray::GNames, Off::InSDK::World::GWorld, Off::InSDK::World::GEngine, Off::InSDK::ProcessEvent::PEOffset, Off::InSDK::ProcessEvent::PEIndex);
 
 
 
@@ -3044,7 +4208,60 @@ namespace BasicFilesImpleUtils
 	UObject* GetObjectByIndex(int32 Index);
 
 	UFunction* FindFunctionByFName(const FName* Name);
+
+	/* Resolves all functions in 'SortedNames' in a single pass over the 'Children' of 'Class' */
+	void ResolveFunctionTable(class UClass* Class, const char* const* SortedNames, int32 NumNames, class UFunction** OutFunctions);
 }
+)";
+
+	/* Table of UFunctions shared by all function-wrappers of a class */
+	BasicHpp << R"(
+/*
+* Table of all UFunctions of a class called by the SDK, shared between all function-wrappers of that class.
+* The first lookup resolves every function of the class at once, instead of searching the class-hierarchy by name for every single function.
+*/
+template<int32 NumFunctions>
+class TFunctionTable
+{
+private:
+	class UClass* (*GetStaticClass)();
+	const char* const* SortedNames;
+
+	class UFunction* Functions[NumFunctions] = {};
+
+	/* Functions may be called from multiple threads, the first caller resolves the table while holding 'ResolveMutex' */
+	std::atomic<bool> bIsResolved = false;
+	std::mutex ResolveMutex;
+
+public:
+	constexpr TFunctionTable(class UClass* (*StaticClassFunc)(), const char* const* Names)
+		: GetStaticClass(StaticClassFunc), SortedNames(Names)
+	{
+	}
+
+public:
+	/* Returns nullptr if the class, or the function, could not be found */
+	inline class UFunction* Get(int32 Index)
+	{
+		if (!bIsResolved.load(std::memory_order_acquire))
+		{
+			std::scoped_lock Lock(ResolveMutex);
+
+			if (!bIsResolved.load(std::memory_order_relaxed))
+			{
+				class UClass* Class = GetStaticClass();
+
+				if (!Class)
+					return nullptr;
+
+				BasicFilesImpleUtils::ResolveFunctionTable(Class, SortedNames, NumFunctions, Functions);
+				bIsResolved.store(true, std::memory_order_release);
+			}
+		}
+
+		return Functions[Index];
+	}
+};
 )";
 
 	BasicCpp << R"(
@@ -3084,17 +4301,162 @@ UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
 	{
 		UObject* Object = UObject::GObjects->GetByIndex(i);
 
-		if (!Object)
-			continue;
+		if (!Object)
+			continue;
+
+		if (Object->Name == *Name)
+			return static_cast<UFunction*>(Object);
+	}
+
+	return nullptr;
+}
+
+void BasicFilesImpleUtils::ResolveFunctionTable(class UClass* Class, const char* const* SortedNames, int32 NumNames, class UFunction** OutFunctions)
+{
+	for (UField* Field = Class->Children; Field; Field = Field->Next)
+	{
+		if (!Field->HasTypeFlag(EClassCastFlags::Function))
+			continue;
+
+		const std::string Name = Field->GetName();
+
+		const char* const* It = std::lower_bound(SortedNames, SortedNames + NumNames, Name, [](const char* Left, const std::string& Right) -> bool { return Right.compare(Left) > 0; });
+
+		if (It != SortedNames + NumNames && Name == *It)
+			OutFunctions[It - SortedNames] = static_cast<UFunction*>(Field);
+	}
+}
+
+)";
+
+	/* FFrame built by the SDK to call the exec-thunks of native UFunctions without going through ProcessEvent */
+	if constexpr (Settings::CppGenerator::bUseNativeThunkCalls)
+	{
+		BasicHpp << R"(
+/* Linked list of the out-parameters of a function call, the exec-thunk looks up the address of out-parameters through it */
+struct FOutParmRec
+{
+	void* Property;
+	uint8* PropAddr;
+	FOutParmRec* NextOutParm;
+};
+
+/*
+* Minimal replica of the engines' FFrame, as it is passed to the exec-thunk of a native UFunction.
+* 
+* 'Code' is always nullptr, so the thunk reads its parameters from 'Locals' by following 'PropertyChainForCompiledIn'.
+* Members following 'CurrentNativeFunction' differ between engine versions and are covered by zero-initialized padding.
+*/
+struct FFrame
+{
+	const void* VTable; // FOutputDevice
+	bool bSuppressEventTag;
+	bool bAutoEmitLineTerminator;
+	uint8 Pad_A[0x6];
+	class UFunction* Node;
+	class UObject* Object;
+	uint8* Code;
+	uint8* Locals;
+	void* MostRecentProperty;
+	uint8* MostRecentPropertyAddress;)";
+
+		if constexpr (Settings::CppGenerator::bFFrameHasPropertyContainer)
+			BasicHpp << "\n\tuint8* MostRecentPropertyContainer;";
+
+		BasicHpp << R"(
+	uint8 FlowStack[0x30]; // TArray<uint32, TInlineAllocator<8>>
+	FFrame* PreviousFrame;
+	FOutParmRec* OutParms;
+	void* PropertyChainForCompiledIn;
+	class UFunction* CurrentNativeFunction;
+	uint8 Pad_B[0x40];
+};
+
+namespace BasicFilesImpleUtils
+{
+	/* Calls the exec-thunk of 'Func' on 'Context' with the parameters in 'Parms', the return value is written to 'ReturnValue' */
+	void CallNativeFunction(const class UObject* Context, class UFunction* Func, void* Parms, void* ReturnValue);
+}
+)";
+
+		BasicCpp << R"(
+namespace BasicFilesImpleUtils
+{
+	/* Thunks only call into the FOutputDevice-vtable of FFrame when reporting script-errors, every entry is a no-op returning 0 */
+	static uint64 FrameVTableNoOp()
+	{
+		return 0;
+	}
+
+	struct FFrameVTable
+	{
+		uint64(*Entries[0x20])();
+
+		FFrameVTable()
+		{
+			for (auto& Entry : Entries)
+				Entry = &FrameVTableNoOp;
+		}
+	};
+
+	static const FFrameVTable FrameVTable;
+}
+
+void BasicFilesImpleUtils::CallNativeFunction(const class UObject* Context, class UFunction* Func, void* Parms, void* ReturnValue)
+{
+	constexpr int32 MaxOutParms = 0x20;
+
+	FOutParmRec OutParms[MaxOutParms];
+	int32 NumOutParms = 0;
+
+	FFrame Frame{};
+	Frame.VTable = FrameVTable.Entries;
+	Frame.Node = Func;
+	Frame.Object = const_cast<UObject*>(Context);
+	Frame.Code = nullptr;
+	Frame.Locals = static_cast<uint8*>(Parms);)";
+
+		BasicCpp << std::format(R"(
+	Frame.PropertyChainForCompiledIn = Func->{0};
+	Frame.CurrentNativeFunction = Func;
+
+	FOutParmRec** LastOut = &Frame.OutParms;
+
+	for ({1}* Field = Func->{0}; Field; Field = Field->Next)
+	{{
+		{2}* Property = static_cast<{2}*>(Field);
+
+		if (!(Property->PropertyFlags & static_cast<uint64>(EPropertyFlags::OutParm)))
+			continue;
+
+		/* Functions with an unusually high number of out-parameters take the regular path */
+		if (NumOutParms >= MaxOutParms) [[unlikely]]
+		{{
+			const auto Flags = Func->FunctionFlags;
+			Func->FunctionFlags |= 0x400;
+
+			Context->ProcessEvent(Func, Parms);
+
+			Func->FunctionFlags = Flags;
+			return;
+		}}
+
+		FOutParmRec* Out = &OutParms[NumOutParms++];
+		Out->Property = Property;
+		Out->PropAddr = static_cast<uint8*>(Parms) + Property->Offset;
+		Out->NextOutParm = nullptr;
 
-		if (Object->Name == *Name)
-			return static_cast<UFunction*>(Object);
-	}
+		*LastOut = Out;
+		LastOut = &Out->NextOutParm;
+	}}
 
-	return nullptr;
-}
+	InSDKUtils::CallGameFunction(Func->ExecFunction, Frame.Object, &Frame, ReturnValue);
+}}
 
-)";
+)", Settings::Internal::bUseFProperty ? "ChildProperties" : "Children"
+, Settings::Internal::bUseFProperty ? "FField" : "UField"
+, Settings::Internal::bUseFProperty ? "FProperty" : "UProperty");
+	}
 
 	/* Implementation of 'UObject::StaticClass()', templated to allow for a per-class local static class-pointer */
 	BasicHpp << R"(
@@ -3265,6 +4627,24 @@ R"({
 		return nullptr;
 
 	return GetDecrytedObjPtr()[Index].Object;
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "The fixed array is treated as a single chunk, so TObjectRange can iterate both layouts the same way",
+				.ReturnType = "inline int32", .NameWithParams = "GetNumChunks()", .Body =
+R"({
+	return 1;
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "inline FUObjectItem*", .NameWithParams = "GetChunkItems(const int32 ChunkIndex, int32& OutNumItems)", .Body =
+R"({
+	OutNumItems = ChunkIndex == 0 ? NumElements : 0;
+
+	return ChunkIndex == 0 ? GetDecrytedObjPtr() : nullptr;
 })",
 				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 			},
@@ -3366,6 +4746,33 @@ R"({
 	if (!ChunkPtr) return nullptr;
 	
 	return ChunkPtr[InChunkIdx].Object;
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "inline int32", .NameWithParams = "GetNumChunks()", .Body =
+R"({
+	return NumChunks;
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "Returns the items of a single chunk, OutNumItems is the number of items in use within this chunk",
+				.ReturnType = "inline FUObjectItem*", .NameWithParams = "GetChunkItems(const int32 ChunkIndex, int32& OutNumItems)", .Body =
+R"({
+	OutNumItems = 0;
+
+	if (ChunkIndex < 0 || ChunkIndex >= NumChunks)
+		return nullptr;
+
+	FUObjectItem* ChunkPtr = GetDecrytedObjPtr()[ChunkIndex];
+	if (!ChunkPtr) return nullptr;
+
+	const int32 NumInChunk = NumElements - (ChunkIndex * ElementsPerChunk);
+	OutNumItems = NumInChunk < ElementsPerChunk ? (NumInChunk > 0 ? NumInChunk : 0) : ElementsPerChunk;
+
+	return ChunkPtr;
 })",
 				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 			},
@@ -3449,61 +4856,266 @@ public:)";
 
 
 
-	/* struct FStringData */
-	PredefinedStruct FStringData = PredefinedStruct{
-		.UniqueName = "FStringData", .Size = 0x800, .Alignment = 0x2, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = true, .Super = nullptr
-	};
 
-	FStringData.Properties =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "char", .Name = "AnsiName", .Offset = 0x00, .Size = 0x01, .ArrayDim = 0x400, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "wchar_t", .Name = "WideName", .Offset = 0x0, .Size = 0x02, .ArrayDim = 0x400, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	/* struct FStringData */
+	PredefinedStruct FStringData = PredefinedStruct{
+		.UniqueName = "FStringData", .Size = 0x800, .Alignment = 0x2, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = true, .Super = nullptr
+	};
+
+	FStringData.Properties =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "char", .Name = "AnsiName", .Offset = 0x00, .Size = 0x01, .ArrayDim = 0x400, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "wchar_t", .Name = "WideName", .Offset = 0x0, .Size = 0x02, .ArrayDim = 0x400, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	
+	if (Off::InSDK::Name::AppendNameToString == 0x0 && !Settings::Internal::bUseNamePool)
+	{
+		/* struct FNameEntry */
+		PredefinedStruct FNameEntry = PredefinedStruct{
+			.UniqueName = "FNameEntry", .Size = Off::FNameEntry::NameArray::StringOffset + 0x800, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
+		};
+
+		FNameEntry.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "constexpr int32", .Name = "NameWideMask", .Offset = 0x0, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "0x1"
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "int32", .Name = "NameIndex", .Offset = Off::FNameEntry::NameArray::IndexOffset, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "union FStringData", .Name = "Name", .Offset = Off::FNameEntry::NameArray::StringOffset, .Size = 0x800, .ArrayDim = 0x1, .Alignment = 0x2,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+
+		SortMembers(FNameEntry.Properties);
+
+		FNameEntry.Functions =
+		{
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "bool", .NameWithParams = "IsWide()", .Body =
+R"({
+	return (NameIndex & NameWideMask);
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "std::string", .NameWithParams = "GetString()", .Body =
+R"({
+	if (IsWide())
+	{
+		return UtfN::Utf16StringToUtf8String<std::string>(Name.WideName, wcslen(Name.WideName));
+	}
+
+	return Name.AnsiName;
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "Only valid if this entry is not wide",
+				.ReturnType = "std::string_view", .NameWithParams = "GetAnsiStringView()", .Body =
+R"({
+	return std::string_view(Name.AnsiName);
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+		};
+
+		const int32 ChunkTableSize = Off::NameArray::NumElements / 0x8;
+		const int32 ChunkTableSizeBytes = ChunkTableSize * 0x8;
+
+		PredefinedStruct TNameEntryArray = PredefinedStruct{
+			.UniqueName = "TNameEntryArray", .Size = (ChunkTableSizeBytes + 0x08), .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+		};
+
+		/* class TNameEntryArray */
+		TNameEntryArray.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "constexpr uint32", .Name = "ChunkTableSize", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = std::format("0x{:04X}", ChunkTableSize)
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "constexpr uint32", .Name = "NumElementsPerChunk", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "0x4000"
+			},
+
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "FNameEntry**", .Name = "Chunks", .Offset = 0x0, .Size = ChunkTableSizeBytes, .ArrayDim = ChunkTableSize, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "int32", .Name = "NumElements", .Offset = (ChunkTableSizeBytes + 0x0), .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "int32", .Name = "NumChunks", .Offset = (ChunkTableSizeBytes + 0x4), .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+
+		TNameEntryArray.Functions =
+		{
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "bool", .NameWithParams = "IsValidIndex(int32 Index, int32 ChunkIdx, int32 InChunkIdx)", .Body =
+R"({
+	return Index >= 0 && Index < NumElements;
+}
+)",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "FNameEntry*", .NameWithParams = "GetEntryByIndex(int32 Index)", .Body =
+R"({
+	const int32 ChunkIdx = Index / NumElementsPerChunk;
+	const int32 InChunk  = Index % NumElementsPerChunk;
+
+	if (!IsValidIndex(Index, ChunkIdx, InChunk))
+		return nullptr;
+
+	return Chunks[ChunkIdx][InChunk];
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+		};
+
+		GenerateStruct(&FStringData, BasicHpp, BasicCpp, BasicHpp);
+		GenerateStruct(&FNameEntry, BasicHpp, BasicCpp, BasicHpp);
+		GenerateStruct(&TNameEntryArray, BasicHpp, BasicCpp, BasicHpp);
+	}
+	else if (Off::InSDK::Name::AppendNameToString == 0x0 && Settings::Internal::bUseNamePool)
+	{
+		/* struct FNumberedData */
+		const int32 FNumberedDataSize = Settings::Internal::bUseCasePreservingName ? 0xA : 0x8;
+
+		PredefinedStruct FNumberedData = PredefinedStruct{
+			.UniqueName = "FNumberedData", .Size = FNumberedDataSize, .Alignment = 0x1, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
+		};
+
+		const int32 FNumberedDataInitialOffset = Settings::Internal::bUseCasePreservingName ? 0x2 : 0x0;
+
+		FNumberedData.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint8", .Name = "Id", .Offset = FNumberedDataInitialOffset, .Size = 0x01, .ArrayDim = 0x4, .Alignment = 0x1,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0x0, .BitCount = 1
+			},
+			PredefinedMember{
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint8", .Name = "Number", .Offset = FNumberedDataInitialOffset + 0x4, .Size = 0x01, .ArrayDim = 0x4, .Alignment = 0x1,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			}
+		};
+
+		FNumberedData.Functions =
+		{
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "int32", .NameWithParams = "GetTypedId()", .Body = 
+R"({
+	return reinterpret_cast<int32>(Id);
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "uint32", .NameWithParams = "GetNumber()", .Body =
+R"({
+	return reinterpret_cast<uint32>(Number);
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+		};
+
+
+		if (Settings::Internal::bUseOutlineNumberName)
+		{
+			FStringData.Properties.push_back(
+				PredefinedMember{
+					.Comment = "NOT AUTO-GENERATED PROPERTY",
+					.Type = "FNumberedData", .Name = "AnsiName", .Offset = 0x10, .Size = FNumberedDataSize, .ArrayDim = 0x400, .Alignment = 0x1,
+					.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+				}
+			);
+		}
+
+
+		/* struct FNameEntryHeader */
+		const int32 FNameEntryHeaderSize = Off::FNameEntry::NamePool::StringOffset - Off::FNameEntry::NamePool::HeaderOffset;
+
+		PredefinedStruct FNameEntryHeader = PredefinedStruct{
+			.UniqueName = "FNameEntryHeader", .Size = FNameEntryHeaderSize, .Alignment = 0x2, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
+		};
+
+		const uint8 LenBitCount = Settings::Internal::bUseCasePreservingName ? 15 : 10;
+		const uint8 LenBitOffset = Settings::Internal::bUseCasePreservingName ? 1 : 6;
+
+		FNameEntryHeader.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint16", .Name = "bIsWide", .Offset = 0x0, .Size = 0x02, .ArrayDim = 0x1, .Alignment = 0x2,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = true, .BitIndex = 0x0, .BitCount = 1
+			},
+			PredefinedMember{
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint16", .Name = "Len", .Offset = 0x0, .Size = 0x02, .ArrayDim = 0x1, .Alignment = 0x2,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = true, .BitIndex = LenBitOffset, .BitCount = LenBitCount
+			}
+		};
+
 
-	
-	if (Off::InSDK::Name::AppendNameToString == 0x0 && !Settings::Internal::bUseNamePool)
-	{
 		/* struct FNameEntry */
 		PredefinedStruct FNameEntry = PredefinedStruct{
-			.UniqueName = "FNameEntry", .Size = Off::FNameEntry::NameArray::StringOffset + 0x800, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
+			.UniqueName = "FNameEntry", .Size = Off::FNameEntry::NamePool::StringOffset + 0x800, .Alignment = 0x2, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
 		};
 
 		FNameEntry.Properties =
 		{
 			PredefinedMember {
 				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "constexpr int32", .Name = "NameWideMask", .Offset = 0x0, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "0x1"
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "int32", .Name = "NameIndex", .Offset = Off::FNameEntry::NameArray::IndexOffset, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+				.Type = "struct FNameEntryHeader", .Name = "Header", .Offset = Off::FNameEntry::NamePool::HeaderOffset, .Size = FNameEntryHeaderSize, .ArrayDim = 0x1, .Alignment = 0x2,
 				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 			},
 			PredefinedMember {
 				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "union FStringData", .Name = "Name", .Offset = Off::FNameEntry::NameArray::StringOffset, .Size = 0x800, .ArrayDim = 0x1, .Alignment = 0x2,
+				.Type = "union FStringData", .Name = "Name", .Offset = Off::FNameEntry::NamePool::HeaderOffset + FNameEntryHeaderSize, .Size = 0x800, .ArrayDim = 0x1, .Alignment = 0x2,
 				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 			},
 		};
 
-		SortMembers(FNameEntry.Properties);
-
 		FNameEntry.Functions =
 		{
 			PredefinedFunction {
 				.CustomComment = "",
 				.ReturnType = "bool", .NameWithParams = "IsWide()", .Body =
 R"({
-	return (NameIndex & NameWideMask);
+	return Header.bIsWide;
 })",
 				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 			},
@@ -3513,1486 +5125,2021 @@ R"({
 R"({
 	if (IsWide())
 	{
-		return UtfN::Utf16StringToUtf8String<std::string>(Name.WideName, wcslen(Name.WideName));
+		return UtfN::Utf16StringToUtf8String<std::string>(Name.WideName, Header.Len);
 	}
 
-	return Name.AnsiName;
+	return std::string(Name.AnsiName, Header.Len);
 })",
 				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 			},
 		};
 
-		const int32 ChunkTableSize = Off::NameArray::NumElements / 0x8;
-		const int32 ChunkTableSizeBytes = ChunkTableSize * 0x8;
+		if (!Settings::Internal::bUseOutlineNumberName)
+		{
+			FNameEntry.Functions.push_back(PredefinedFunction{
+				.CustomComment = "Only valid if this entry is not wide",
+				.ReturnType = "std::string_view", .NameWithParams = "GetAnsiStringView()", .Body =
+R"({
+	return std::string_view(Name.AnsiName, Header.Len);
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			});
+		}
 
-		PredefinedStruct TNameEntryArray = PredefinedStruct{
-			.UniqueName = "TNameEntryArray", .Size = (ChunkTableSizeBytes + 0x08), .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+		constexpr int32 SizeOfChunkPtrs = 0x2000 * 0x8;
+
+		/* class FNamePool */
+		PredefinedStruct FNamePool = PredefinedStruct{
+			.UniqueName = "FNamePool", .Size = Off::NameArray::ChunksStart + SizeOfChunkPtrs, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
 		};
 
-		/* class TNameEntryArray */
-		TNameEntryArray.Properties =
+		FNamePool.Properties =
 		{
 			PredefinedMember {
 				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "constexpr uint32", .Name = "ChunkTableSize", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = std::format("0x{:04X}", ChunkTableSize)
+				.Type = "constexpr uint32", .Name = "FNameEntryStride", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = std::format("0x{:04X}", Off::InSDK::NameArray::FNameEntryStride)
 			},
 			PredefinedMember {
 				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "constexpr uint32", .Name = "NumElementsPerChunk", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "0x4000"
+				.Type = "constexpr uint32", .Name = "FNameBlockOffsetBits", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = std::format("0x{:04X}", Off::InSDK::NameArray::FNamePoolBlockOffsetBits)
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "constexpr uint32", .Name = "FNameBlockOffsets", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "1 << FNameBlockOffsetBits"
+			},
+
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint32", .Name = "CurrentBlock", .Offset = Off::NameArray::MaxChunkIndex, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x2,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint32", .Name = "CurrentByteCursor", .Offset = Off::NameArray::ByteCursor, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "uint8*", .Name = "Blocks", .Offset = Off::NameArray::ChunksStart, .Size = SizeOfChunkPtrs, .ArrayDim = 0x2000, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+
+		FNamePool.Functions =
+		{
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "bool", .NameWithParams = "IsValidIndex(int32 Index, int32 ChunkIdx, int32 InChunkIdx)", .Body =
+R"({
+	return ChunkIdx <= CurrentBlock && !(ChunkIdx == CurrentBlock && InChunkIdx > CurrentByteCursor);
+}
+)",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			},
+			PredefinedFunction {
+				.CustomComment = "",
+				.ReturnType = "FNameEntry*", .NameWithParams = "GetEntryByIndex(int32 Index)", .Body =
+R"({
+	const int32 ChunkIdx = Index >> FNameBlockOffsetBits;
+	const int32 InChunk = (Index & (FNameBlockOffsets - 1));
+
+	if (!IsValidIndex(Index, ChunkIdx, InChunk))
+		return nullptr;
+
+	return reinterpret_cast<FNameEntry*>(Blocks[ChunkIdx] + (InChunk * FNameEntryStride));
+})",
+				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 			},
+		};
+
+		GenerateStruct(&FNumberedData, BasicHpp, BasicCpp, BasicHpp);
+		GenerateStruct(&FNameEntryHeader, BasicHpp, BasicCpp, BasicHpp);
+		GenerateStruct(&FStringData, BasicHpp, BasicCpp, BasicHpp);
+		GenerateStruct(&FNameEntry, BasicHpp, BasicCpp, BasicHpp);
+		GenerateStruct(&FNamePool, BasicHpp, BasicCpp, BasicHpp);
+	}
+
+
+	/* class FName */
+	PredefinedStruct FName = PredefinedStruct{
+		.UniqueName = "FName", .Size = Off::InSDK::Name::FNameSize, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
+
+	std::string NameArrayType = Off::InSDK::Name::AppendNameToString == 0 ? Settings::Internal::bUseNamePool ? "FNamePool*" : "TNameEntryArray*" : "void*";
+	std::string NameArrayName = Off::InSDK::Name::AppendNameToString == 0 ? "GNames" : "AppendString";
+
+	FName.Properties =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "inline " + NameArrayType, .Name = NameArrayName, .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "nullptr"
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "ComparisonIndex", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
+		},
+	};
+
+	/* Add an error message to FName if ToString is used */
+	if (!Off::InSDK::Name::bIsUsingAppendStringOverToString)
+	{
+		FName.Properties.insert(FName.Properties.begin(), {
+			PredefinedMember {
+				.Comment = "",
+				.Type = "/*  Unlike FMemory::AppendString, FName::ToString allocates memory every time it is used.  */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "",
+				.Type = "/*  This allocation needs to be freed using UE's FMemory::Free function.                   */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "",
+				.Type = "/*  Inside of 'FName::GetRawString':                                                       */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "",
+				.Type = "/*  1. Change \"thread_local FAllocatedString TempString(1024);\" to \"FString TempString;\"   */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "",
+				.Type = "/*  2. Add a \"Free\" function to FString that calls FMemory::Free(Data);                    */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "",
+				.Type = "/*  3. Replace \"TempString.Clear();\" with \"TempString.Free();\"                             */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
+			},
+			PredefinedMember {
+				.Comment = "Free your allocation with FMemory::Free!",
+				.Type = "static_assert(false, \"FName::ToString causes memory-leak. Read comment above!\")", .Name = NameArrayName, .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x0, .Alignment = 0x4,
+				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "nullptr"
+			},
+		});
+	}
+
+	if (!Settings::Internal::bUseOutlineNumberName)
+	{
+		FName.Properties.push_back(PredefinedMember{
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = (Settings::Internal::bUseNamePool ? "uint32" : "int32"), .Name = "Number", .Offset = Off::FName::Number, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
+			}
+		);
+	}
+
+	if (Settings::Internal::bUseCasePreservingName)
+	{
+		const int32 DisplayIndexOffset = Off::FName::Number == 4 ? 0x8 : 0x4;
+
+		FName.Properties.push_back(PredefinedMember{
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "DisplayIndex", .Offset = DisplayIndexOffset, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
+			}
+		);
+	}
+
+	SortMembers(FName.Properties);
+
+	constexpr const char* GetRawStringWithAppendString =
+		R"({
+	thread_local FAllocatedString TempString(1024);
+
+	if (!AppendString)
+		InitInternal();
+
+	InSDKUtils::CallGameFunction(reinterpret_cast<void(*)(const FName*, FString&)>(AppendString), this, TempString);
+
+	std::string OutputString = TempString.ToString();
+	TempString.Clear();
+
+	return OutputString;
+}
+)";
+
+	constexpr const char* GetRawStringWithNameArray =
+		R"({
+	if (!GNames)
+		InitInternal();
+
+	std::string RetStr = FName::GNames->GetEntryByIndex(GetDisplayIndex())->GetString();
+
+	if (Number > 0)
+		RetStr += ("_" + std::to_string(Number - 1));
+
+	return RetStr;
+}
+)";
+
+	constexpr const char* GetRawStringWithNameArrayWithOutlineNumber =
+		R"({
+	if (!GNames)
+		InitInternal();
 
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "FNameEntry**", .Name = "Chunks", .Offset = 0x0, .Size = ChunkTableSizeBytes, .ArrayDim = ChunkTableSize, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "int32", .Name = "NumElements", .Offset = (ChunkTableSizeBytes + 0x0), .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "int32", .Name = "NumChunks", .Offset = (ChunkTableSizeBytes + 0x4), .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+	const FNameEntry* Entry = FName::GNames->GetEntryByIndex(GetDisplayIndex());
 
-		TNameEntryArray.Functions =
-		{
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "bool", .NameWithParams = "IsValidIndex(int32 Index, int32 ChunkIdx, int32 InChunkIdx)", .Body =
-R"({
-	return Index >= 0 && Index < NumElements;
+	if (Entry->Header.Length == 0)
+	{{
+		if (Entry->Number > 0)
+			return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString() + "_" + std::to_string(Entry->Number - 1);
+
+		return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString();
+	}}
+
+	return Entry.GetString();
 }
-)",
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "FNameEntry*", .NameWithParams = "GetEntryByIndex(int32 Index)", .Body =
-R"({
-	const int32 ChunkIdx = Index / NumElementsPerChunk;
-	const int32 InChunk  = Index % NumElementsPerChunk;
+)";
 
-	if (!IsValidIndex(Index, ChunkIdx, InChunk))
-		return nullptr;
+	std::string GetRawStringBody = Off::InSDK::Name::AppendNameToString == 0 ? Settings::Internal::bUseOutlineNumberName ? GetRawStringWithNameArrayWithOutlineNumber : GetRawStringWithNameArray : GetRawStringWithAppendString;
 
-	return Chunks[ChunkIdx][InChunk];
-})",
+	FName.Functions =
+	{
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "void", .NameWithParams = "InitInternal()", .Body =
+std::format(R"({{
+	{0} = {2}reinterpret_cast<{1}{2}>(InSDKUtils::GetImageBase() + Offsets::{0});
+}})", NameArrayName, NameArrayType, (Off::InSDK::Name::AppendNameToString == 0 && !Settings::Internal::bUseNamePool ? "*" : "")),
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "int32", .NameWithParams = "GetDisplayIndex()", .Body =
+std::format(R"({{
+	return {};
+}}
+)", Settings::Internal::bUseCasePreservingName ? "DisplayIndex" : "ComparisonIndex"),
 				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-		};
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "std::string", .NameWithParams = "GetRawString()", .Body = GetRawStringBody,
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "std::string", .NameWithParams = "ToString()", .Body = R"({
+	std::string OutputString = GetRawString();
 
-		GenerateStruct(&FStringData, BasicHpp, BasicCpp, BasicHpp);
-		GenerateStruct(&FNameEntry, BasicHpp, BasicCpp, BasicHpp);
-		GenerateStruct(&TNameEntryArray, BasicHpp, BasicCpp, BasicHpp);
-	}
-	else if (Off::InSDK::Name::AppendNameToString == 0x0 && Settings::Internal::bUseNamePool)
-	{
-		/* struct FNumberedData */
-		const int32 FNumberedDataSize = Settings::Internal::bUseCasePreservingName ? 0xA : 0x8;
+	size_t pos = OutputString.rfind('/');
 
-		PredefinedStruct FNumberedData = PredefinedStruct{
-			.UniqueName = "FNumberedData", .Size = FNumberedDataSize, .Alignment = 0x1, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
-		};
+	if (pos == std::string::npos)
+		return OutputString;
 
-		const int32 FNumberedDataInitialOffset = Settings::Internal::bUseCasePreservingName ? 0x2 : 0x0;
+	return OutputString.substr(pos + 1);
+}
+)",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "bool", .NameWithParams = "operator==(const FName& Other)", .Body =
+std::format(R"({{
+	return ComparisonIndex == Other.ComparisonIndex{};
+}})", !Settings::Internal::bUseOutlineNumberName ? " && Number == Other.Number" : ""),
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "bool", .NameWithParams = "operator!=(const FName& Other)", .Body =
+std::format(R"({{
+	return ComparisonIndex != Other.ComparisonIndex{};
+}})", !Settings::Internal::bUseOutlineNumberName ? " || Number != Other.Number" : ""),
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+	};
 
-		FNumberedData.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint8", .Name = "Id", .Offset = FNumberedDataInitialOffset, .Size = 0x01, .ArrayDim = 0x4, .Alignment = 0x1,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0x0, .BitCount = 1
-			},
-			PredefinedMember{
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint8", .Name = "Number", .Offset = FNumberedDataInitialOffset + 0x4, .Size = 0x01, .ArrayDim = 0x4, .Alignment = 0x1,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			}
-		};
+	/* Names can only be referenced in-place if the name-entries are accessible, and hold the number-less string of the name */
+	const bool bCanReferenceNameEntries = Off::InSDK::Name::AppendNameToString == 0 && !Settings::Internal::bUseOutlineNumberName;
 
-		FNumberedData.Functions =
-		{
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "int32", .NameWithParams = "GetTypedId()", .Body = 
-R"({
-	return reinterpret_cast<int32>(Id);
-})",
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "uint32", .NameWithParams = "GetNumber()", .Body =
-R"({
-	return reinterpret_cast<uint32>(Number);
-})",
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-		};
+	constexpr const char* GetDecodedStringViewWithCache = R"({{
+	static std::shared_mutex CacheMutex;
+	static std::unordered_map<uint64, std::string> DecodedNames;
 
+	const uint64 Key = (static_cast<uint64>(GetDisplayIndex()) << 32){};
 
-		if (Settings::Internal::bUseOutlineNumberName)
-		{
-			FStringData.Properties.push_back(
-				PredefinedMember{
-					.Comment = "NOT AUTO-GENERATED PROPERTY",
-					.Type = "FNumberedData", .Name = "AnsiName", .Offset = 0x10, .Size = FNumberedDataSize, .ArrayDim = 0x400, .Alignment = 0x1,
-					.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-				}
-			);
-		}
+	{{
+		std::shared_lock Lock(CacheMutex);
 
+		auto It = DecodedNames.find(Key);
 
-		/* struct FNameEntryHeader */
-		const int32 FNameEntryHeaderSize = Off::FNameEntry::NamePool::StringOffset - Off::FNameEntry::NamePool::HeaderOffset;
+		if (It != DecodedNames.end())
+			return It->second;
+	}}
 
-		PredefinedStruct FNameEntryHeader = PredefinedStruct{
-			.UniqueName = "FNameEntryHeader", .Size = FNameEntryHeaderSize, .Alignment = 0x2, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
-		};
+	std::string DecodedName = ToString();
 
-		const uint8 LenBitCount = Settings::Internal::bUseCasePreservingName ? 15 : 10;
-		const uint8 LenBitOffset = Settings::Internal::bUseCasePreservingName ? 1 : 6;
+	std::unique_lock Lock(CacheMutex);
 
-		FNameEntryHeader.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint16", .Name = "bIsWide", .Offset = 0x0, .Size = 0x02, .ArrayDim = 0x1, .Alignment = 0x2,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = true, .BitIndex = 0x0, .BitCount = 1
-			},
-			PredefinedMember{
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint16", .Name = "Len", .Offset = 0x0, .Size = 0x02, .ArrayDim = 0x1, .Alignment = 0x2,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = true, .BitIndex = LenBitOffset, .BitCount = LenBitCount
-			}
-		};
+	return DecodedNames.try_emplace(Key, std::move(DecodedName)).first->second;
+}})";
 
+	constexpr const char* GetDecodedStringViewWithoutCache = R"({{
+	thread_local std::string DecodedName;
 
-		/* struct FNameEntry */
-		PredefinedStruct FNameEntry = PredefinedStruct{
-			.UniqueName = "FNameEntry", .Size = Off::FNameEntry::NamePool::StringOffset + 0x800, .Alignment = 0x2, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = false, .bIsUnion = false, .Super = nullptr
-		};
+	DecodedName = ToString();
 
-		FNameEntry.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "struct FNameEntryHeader", .Name = "Header", .Offset = Off::FNameEntry::NamePool::HeaderOffset, .Size = FNameEntryHeaderSize, .ArrayDim = 0x1, .Alignment = 0x2,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "union FStringData", .Name = "Name", .Offset = Off::FNameEntry::NamePool::HeaderOffset + FNameEntryHeaderSize, .Size = 0x800, .ArrayDim = 0x1, .Alignment = 0x2,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+	return DecodedName;
+}})";
 
-		FNameEntry.Functions =
-		{
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "bool", .NameWithParams = "IsWide()", .Body =
-R"({
-	return Header.bIsWide;
-})",
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "std::string", .NameWithParams = "GetString()", .Body =
-R"({
-	if (IsWide())
+	FName.Functions.push_back(PredefinedFunction{
+		.CustomComment = Settings::CppGenerator::bUseFNameDecodeCache ? "Decodes this name once, the view stays valid" : "Decodes this name, the view is only valid until the next call on this thread",
+		.ReturnType = "std::string_view", .NameWithParams = "GetDecodedStringView()", .Body =
+std::format(Settings::CppGenerator::bUseFNameDecodeCache ? GetDecodedStringViewWithCache : GetDecodedStringViewWithoutCache, !Settings::Internal::bUseOutlineNumberName ? " | static_cast<uint32>(Number)" : ""),
+		.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+	});
+
+	if (bCanReferenceNameEntries)
 	{
-		return UtfN::Utf16StringToUtf8String<std::string>(Name.WideName, Header.Len);
-	}
+		FName.Functions.push_back(PredefinedFunction{
+			.CustomComment = "Number-less name without path, referencing the name-entry. Returns false for wide names.",
+			.ReturnType = "bool", .NameWithParams = "TryGetAnsiEntryString(std::string_view& OutString)", .Body =
+R"({
+	if (!GNames)
+		InitInternal();
 
-	return std::string(Name.AnsiName, Header.Len);
-})",
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-		};
+	const FNameEntry* Entry = GNames->GetEntryByIndex(GetDisplayIndex());
 
-		constexpr int32 SizeOfChunkPtrs = 0x2000 * 0x8;
+	if (!Entry || Entry->IsWide())
+		return false;
 
-		/* class FNamePool */
-		PredefinedStruct FNamePool = PredefinedStruct{
-			.UniqueName = "FNamePool", .Size = Off::NameArray::ChunksStart + SizeOfChunkPtrs, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-		};
+	OutString = Entry->GetAnsiStringView();
 
-		FNamePool.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "constexpr uint32", .Name = "FNameEntryStride", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = std::format("0x{:04X}", Off::InSDK::NameArray::FNameEntryStride)
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "constexpr uint32", .Name = "FNameBlockOffsetBits", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = std::format("0x{:04X}", Off::InSDK::NameArray::FNamePoolBlockOffsetBits)
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "constexpr uint32", .Name = "FNameBlockOffsets", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "1 << FNameBlockOffsetBits"
-			},
+	const size_t Pos = OutString.rfind('/');
+
+	if (Pos != std::string_view::npos)
+		OutString.remove_prefix(Pos + 1);
+
+	return true;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		});
+	}
+
+	FName.Functions.push_back(PredefinedFunction{
+		.CustomComment = "Same as ToString(), but without allocating memory for ansi names",
+		.ReturnType = "std::string_view", .NameWithParams = "ToStringView()", .Body = bCanReferenceNameEntries ?
+R"({
+	std::string_view EntryString;
 
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint32", .Name = "CurrentBlock", .Offset = Off::NameArray::MaxChunkIndex, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x2,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint32", .Name = "CurrentByteCursor", .Offset = Off::NameArray::ByteCursor, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "uint8*", .Name = "Blocks", .Offset = Off::NameArray::ChunksStart, .Size = SizeOfChunkPtrs, .ArrayDim = 0x2000, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+	if (Number == 0 && TryGetAnsiEntryString(EntryString))
+		return EntryString;
 
-		FNamePool.Functions =
-		{
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "bool", .NameWithParams = "IsValidIndex(int32 Index, int32 ChunkIdx, int32 InChunkIdx)", .Body =
+	return GetDecodedStringView();
+})" :
 R"({
-	return ChunkIdx <= CurrentBlock && !(ChunkIdx == CurrentBlock && InChunkIdx > CurrentByteCursor);
-}
-)",
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-			PredefinedFunction {
-				.CustomComment = "",
-				.ReturnType = "FNameEntry*", .NameWithParams = "GetEntryByIndex(int32 Index)", .Body =
+	return GetDecodedStringView();
+})",
+		.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+	});
+
+	FName.Functions.push_back(PredefinedFunction{
+		.CustomComment = "Compares ToString() to 'Other', without decoding ansi names",
+		.ReturnType = "bool", .NameWithParams = "operator==(std::string_view Other)", .Body = bCanReferenceNameEntries ?
 R"({
-	const int32 ChunkIdx = Index >> FNameBlockOffsetBits;
-	const int32 InChunk = (Index & (FNameBlockOffsets - 1));
+	std::string_view EntryString;
 
-	if (!IsValidIndex(Index, ChunkIdx, InChunk))
-		return nullptr;
+	if (!TryGetAnsiEntryString(EntryString))
+		return GetDecodedStringView() == Other;
 
-	return reinterpret_cast<FNameEntry*>(Blocks[ChunkIdx] + (InChunk * FNameEntryStride));
+	if (Number == 0)
+		return EntryString == Other;
+
+	/* Compare to EntryString + "_" + (Number - 1), without building the string */
+	if (Other.size() <= EntryString.size() + 1 || !Other.starts_with(EntryString) || Other[EntryString.size()] != '_')
+		return false;
+
+	char NumberString[0x10];
+	const auto [NumberStringEnd, Error] = std::to_chars(NumberString, NumberString + sizeof(NumberString), Number - 1);
+
+	return Other.substr(EntryString.size() + 1) == std::string_view(NumberString, NumberStringEnd - NumberString);
+})" :
+R"({
+	return GetDecodedStringView() == Other;
 })",
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-			},
-		};
+		.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+	});
 
-		GenerateStruct(&FNumberedData, BasicHpp, BasicCpp, BasicHpp);
-		GenerateStruct(&FNameEntryHeader, BasicHpp, BasicCpp, BasicHpp);
-		GenerateStruct(&FStringData, BasicHpp, BasicCpp, BasicHpp);
-		GenerateStruct(&FNameEntry, BasicHpp, BasicCpp, BasicHpp);
-		GenerateStruct(&FNamePool, BasicHpp, BasicCpp, BasicHpp);
+	FName.Functions.push_back(PredefinedFunction{
+		.CustomComment = "",
+		.ReturnType = "bool", .NameWithParams = "operator!=(std::string_view Other)", .Body =
+R"({
+	return !(*this == Other);
+})",
+		.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+	});
+
+	if constexpr (Settings::CppGenerator::bAddManualOverrideOptions)
+	{
+		FName.Functions.insert(
+			FName.Functions.begin() + 1,
+			PredefinedFunction{
+			.CustomComment = "",
+			.ReturnType = "void", .NameWithParams = "InitManually(void* Location)", .Body =
+std::format(R"({{
+	{0} = {2}reinterpret_cast<{1}{2}>(Location);
+}})", NameArrayName, NameArrayType, (Off::InSDK::Name::AppendNameToString == 0 && !Settings::Internal::bUseNamePool ? "*" : "")),
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+			});
 	}
 
+	GenerateStruct(&FName, BasicHpp, BasicCpp, BasicHpp);
 
-	/* class FName */
-	PredefinedStruct FName = PredefinedStruct{
-		.UniqueName = "FName", .Size = Off::InSDK::Name::FNameSize, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-	};
+	/* Hash of an FName as calculated by the engine, allows UC::TMap/UC::TSet to look up FName keys through their hash-buckets */
+	BasicHpp << std::format(R"(
+inline uint32 GetTypeHash(const FName& Name)
+{{
+	return Name.ComparisonIndex{};
+}}
+)", !Settings::Internal::bUseOutlineNumberName ? " + Name.Number" : "");
 
-	std::string NameArrayType = Off::InSDK::Name::AppendNameToString == 0 ? Settings::Internal::bUseNamePool ? "FNamePool*" : "TNameEntryArray*" : "void*";
-	std::string NameArrayName = Off::InSDK::Name::AppendNameToString == 0 ? "GNames" : "AppendString";
 
-	FName.Properties =
+	BasicHpp <<
+		R"(
+template<typename ClassType>
+class TSubclassOf
+{
+	class UClass* ClassPtr;
+
+public:
+	TSubclassOf() = default;
+
+	inline TSubclassOf(UClass* Class)
+		: ClassPtr(Class)
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "inline " + NameArrayType, .Name = NameArrayName, .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "nullptr"
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "ComparisonIndex", .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
-		},
-	};
+	}
 
-	/* Add an error message to FName if ToString is used */
-	if (!Off::InSDK::Name::bIsUsingAppendStringOverToString)
+	inline UClass* Get()
 	{
-		FName.Properties.insert(FName.Properties.begin(), {
-			PredefinedMember {
-				.Comment = "",
-				.Type = "/*  Unlike FMemory::AppendString, FName::ToString allocates memory every time it is used.  */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "",
-				.Type = "/*  This allocation needs to be freed using UE's FMemory::Free function.                   */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "",
-				.Type = "/*  Inside of 'FName::GetRawString':                                                       */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "",
-				.Type = "/*  1. Change \"thread_local FAllocatedString TempString(1024);\" to \"FString TempString;\"   */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "",
-				.Type = "/*  2. Add a \"Free\" function to FString that calls FMemory::Free(Data);                    */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "",
-				.Type = "/*  3. Replace \"TempString.Clear();\" with \"TempString.Free();\"                             */", .Name = NameArrayName, .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF
-			},
-			PredefinedMember {
-				.Comment = "Free your allocation with FMemory::Free!",
-				.Type = "static_assert(false, \"FName::ToString causes memory-leak. Read comment above!\")", .Name = NameArrayName, .Offset = 0x0, .Size = 0x4, .ArrayDim = 0x0, .Alignment = 0x4,
-				.bIsStatic = true, .bIsZeroSizeMember = true, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "nullptr"
-			},
-		});
+		return ClassPtr;
 	}
 
-	if (!Settings::Internal::bUseOutlineNumberName)
+	inline operator UClass*() const
 	{
-		FName.Properties.push_back(PredefinedMember{
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = (Settings::Internal::bUseNamePool ? "uint32" : "int32"), .Name = "Number", .Offset = Off::FName::Number, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
-			}
-		);
+		return ClassPtr;
 	}
 
-	if (Settings::Internal::bUseCasePreservingName)
+	template<typename Target, typename = std::enable_if<std::is_base_of_v<Target, ClassType>, bool>::type>
+	inline operator TSubclassOf<Target>() const
 	{
-		const int32 DisplayIndexOffset = Off::FName::Number == 4 ? 0x8 : 0x4;
+		return ClassPtr;
+	}
 
-		FName.Properties.push_back(PredefinedMember{
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "DisplayIndex", .Offset = DisplayIndexOffset, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF,
-			}
-		);
+	inline UClass* operator->()
+	{
+		return ClassPtr;
 	}
 
-	SortMembers(FName.Properties);
+	inline TSubclassOf& operator=(UClass* Class)
+	{
+		ClassPtr = Class;
 
-	constexpr const char* GetRawStringWithAppendString =
-		R"({
-	thread_local FAllocatedString TempString(1024);
+		return *this;
+	}
 
-	if (!AppendString)
-		InitInternal();
+	inline bool operator==(const TSubclassOf& Other) const
+	{
+		return ClassPtr == Other.ClassPtr;
+	}
 
-	InSDKUtils::CallGameFunction(reinterpret_cast<void(*)(const FName*, FString&)>(AppendString), this, TempString);
+	inline bool operator!=(const TSubclassOf& Other) const
+	{
+		return ClassPtr != Other.ClassPtr;
+	}
 
-	std::string OutputString = TempString.ToString();
-	TempString.Clear();
+	inline bool operator==(UClass* Other) const
+	{
+		return ClassPtr == Other;
+	}
 
-	return OutputString;
-}
+	inline bool operator!=(UClass* Other) const
+	{
+		return ClassPtr != Other;
+	}
+};
 )";
 
-	constexpr const char* GetRawStringWithNameArray =
-		R"({
-	if (!GNames)
-		InitInternal();
+	const int32 TextDataSize = (Off::InSDK::Text::InTextDataStringOffset + 0x10);
 
-	std::string RetStr = FName::GNames->GetEntryByIndex(GetDisplayIndex())->GetString();
+	/* class FTextData */
+	PredefinedStruct FTextData = PredefinedStruct{
+		.UniqueName = "FTextData", .Size = TextDataSize, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
 
-	if (Number > 0)
-		RetStr += ("_" + std::to_string(Number - 1));
+	FTextData.Properties =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class FString", .Name = "TextSource", .Offset = Off::InSDK::Text::InTextDataStringOffset, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
 
-	return RetStr;
-}
-)";
+	BasicHpp << R"(namespace FTextImpl
+{)";
+	GenerateStruct(&FTextData, BasicHpp, BasicCpp, BasicHpp);
+	BasicHpp << "}\n";
 
-	constexpr const char* GetRawStringWithNameArrayWithOutlineNumber =
-		R"({
-	if (!GNames)
-		InitInternal();
+	/* class FText */
+	PredefinedStruct FText = PredefinedStruct{
+		.UniqueName = "FText", .Size = Off::InSDK::Text::TextSize, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
+
+	FText.Properties =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "class FTextImpl::FTextData*", .Name = "TextData", .Offset = Off::InSDK::Text::TextDatOffset, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x1,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	FText.Functions =
+	{
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "const class FString&", .NameWithParams = "GetStringRef()", .Body =
+R"({
+	return TextData->TextSource;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "std::string", .NameWithParams = "ToString()", .Body =
+R"({
+	return TextData->TextSource.ToString();
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+	};
 
-	const FNameEntry* Entry = FName::GNames->GetEntryByIndex(GetDisplayIndex());
+	GenerateStruct(&FText, BasicHpp, BasicCpp, BasicHpp);
 
-	if (Entry->Header.Length == 0)
-	{{
-		if (Entry->Number > 0)
-			return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString() + "_" + std::to_string(Entry->Number - 1);
 
-		return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString();
-	}}
+	constexpr int32 FWeakObjectPtrSize = 0x8;
 
-	return Entry.GetString();
-}
-)";
+	/* class FWeakObjectPtr */
+	PredefinedStruct FWeakObjectPtr = PredefinedStruct{
+		.UniqueName = "FWeakObjectPtr", .Size = FWeakObjectPtrSize, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
 
-	std::string GetRawStringBody = Off::InSDK::Name::AppendNameToString == 0 ? Settings::Internal::bUseOutlineNumberName ? GetRawStringWithNameArrayWithOutlineNumber : GetRawStringWithNameArray : GetRawStringWithAppendString;
+	FWeakObjectPtr.Properties =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "ObjectIndex", .Offset = 0x0, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "ObjectSerialNumber", .Offset = 0x4, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
 
-	FName.Functions =
+	FWeakObjectPtr.Functions =
 	{
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "void", .NameWithParams = "InitInternal()", .Body =
-std::format(R"({{
-	{0} = {2}reinterpret_cast<{1}{2}>(InSDKUtils::GetImageBase() + Offsets::{0});
-}})", NameArrayName, NameArrayType, (Off::InSDK::Name::AppendNameToString == 0 && !Settings::Internal::bUseNamePool ? "*" : "")),
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+			.ReturnType = "class UObject*", .NameWithParams = "Get()", .Body =
+R"({
+	return UObject::GObjects->GetByIndex(ObjectIndex);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
 		},
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "int32", .NameWithParams = "GetDisplayIndex()", .Body =
-std::format(R"({{
-	return {};
-}}
-)", Settings::Internal::bUseCasePreservingName ? "DisplayIndex" : "ComparisonIndex"),
-				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			.ReturnType = "class UObject*", .NameWithParams = "operator->()", .Body =
+R"({
+	return UObject::GObjects->GetByIndex(ObjectIndex);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
 		},
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "std::string", .NameWithParams = "GetRawString()", .Body = GetRawStringBody,
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+			.ReturnType = "bool", .NameWithParams = "operator==(const FWeakObjectPtr& Other)", .Body =
+R"({
+	return ObjectIndex == Other.ObjectIndex;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
 		},
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "std::string", .NameWithParams = "ToString()", .Body = R"({
-	std::string OutputString = GetRawString();
+			.ReturnType = "bool", .NameWithParams = "operator!=(const FWeakObjectPtr& Other)", .Body =
+R"({
+	return ObjectIndex != Other.ObjectIndex;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "bool", .NameWithParams = "operator==(const class UObject* Other)", .Body =
+R"({
+	return ObjectIndex == Other->Index;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "bool", .NameWithParams = "operator!=(const class UObject* Other)", .Body =
+R"({
+	return ObjectIndex != Other->Index;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+	};
 
-	size_t pos = OutputString.rfind('/');
+	GenerateStruct(&FWeakObjectPtr, BasicHpp, BasicCpp, BasicHpp);
 
-	if (pos == std::string::npos)
-		return OutputString;
 
-	return OutputString.substr(pos + 1);
-}
-)",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+	BasicHpp <<
+		R"(
+template<typename UEType>
+class TWeakObjectPtr : public FWeakObjectPtr
+{
+public:
+	UEType* Get() const
+	{
+		return static_cast<UEType*>(FWeakObjectPtr::Get());
+	}
+
+	UEType* operator->() const
+	{
+		return static_cast<UEType*>(FWeakObjectPtr::Get());
+	}
+};
+)";
+
+
+	/* class FUniqueObjectGuid */
+	PredefinedStruct FUniqueObjectGuid = PredefinedStruct{
+		.UniqueName = "FUniqueObjectGuid", .Size = 0x10, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
+
+	FUniqueObjectGuid.Properties =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint32", .Name = "A", .Offset = 0x0, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint32", .Name = "B", .Offset = 0x4, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint32", .Name = "C", .Offset = 0x8, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "uint32", .Name = "D", .Offset = 0xC, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+	};
+
+	GenerateStruct(&FUniqueObjectGuid, BasicHpp, BasicCpp, BasicHpp);
+
+
+	/* class TPersistentObjectPtr */
+	PredefinedStruct TPersistentObjectPtr = PredefinedStruct{
+		.CustomTemplateText = "template<typename TObjectID>",
+		.UniqueName = "TPersistentObjectPtr", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
+
+	const int32 ObjectIDOffset = Settings::Internal::bIsWeakObjectPtrWithoutTag ? 0x8 : 0xC;
+
+	TPersistentObjectPtr.Properties =
+	{
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "FWeakObjectPtr", .Name = "WeakPtr", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "int32", .Name = "TagAtLastTest", .Offset = 0x8, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "TObjectID", .Name = "ObjectID", .Offset = ObjectIDOffset, .Size = 0x00, .ArrayDim = 0x1, .Alignment = 0x1,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
+	};
+
+	if (Settings::Internal::bIsWeakObjectPtrWithoutTag)
+		TPersistentObjectPtr.Properties.erase(TPersistentObjectPtr.Properties.begin() + 1); // TagAtLast
+
+	TPersistentObjectPtr.Functions =
+	{
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "bool", .NameWithParams = "operator==(const FName& Other)", .Body =
-std::format(R"({{
-	return ComparisonIndex == Other.ComparisonIndex{};
-}})", !Settings::Internal::bUseOutlineNumberName ? " && Number == Other.Number" : ""),
+			.ReturnType = "class UObject*", .NameWithParams = "Get()", .Body =
+R"({
+	return WeakPtr.Get();
+})",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 		},
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "bool", .NameWithParams = "operator!=(const FName& Other)", .Body =
-std::format(R"({{
-	return ComparisonIndex != Other.ComparisonIndex{};
-}})", !Settings::Internal::bUseOutlineNumberName ? " || Number != Other.Number" : ""),
+			.ReturnType = "class UObject*", .NameWithParams = "operator->()", .Body =
+R"({
+	return WeakPtr.Get();
+})",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 		},
 	};
 
-	if constexpr (Settings::CppGenerator::bAddManualOverrideOptions)
+	GenerateStruct(&TPersistentObjectPtr, BasicHpp, BasicCpp, BasicHpp);
+
+
+	/* class TLazyObjectPtr */
+	BasicHpp <<
+		R"(
+template<typename UEType>
+class TLazyObjectPtr : public TPersistentObjectPtr<FUniqueObjectGuid>
+{
+public:
+	UEType* Get() const
 	{
-		FName.Functions.insert(
-			FName.Functions.begin() + 1,
-			PredefinedFunction{
-			.CustomComment = "",
-			.ReturnType = "void", .NameWithParams = "InitManually(void* Location)", .Body =
-std::format(R"({{
-	{0} = {2}reinterpret_cast<{1}{2}>(Location);
-}})", NameArrayName, NameArrayType, (Off::InSDK::Name::AppendNameToString == 0 && !Settings::Internal::bUseNamePool ? "*" : "")),
-			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
-			});
+		return static_cast<UEType*>(TPersistentObjectPtr::Get());
 	}
-
-	GenerateStruct(&FName, BasicHpp, BasicCpp, BasicHpp);
+	UEType* operator->() const
+	{
+		return static_cast<UEType*>(TPersistentObjectPtr::Get());
+	}
+};
+)";
 
 
+	// Start Namespace 'FakeSoftObjectPtr'
 	BasicHpp <<
 		R"(
-template<typename ClassType>
-class TSubclassOf
+namespace FakeSoftObjectPtr
 {
-	class UClass* ClassPtr;
+)";
 
-public:
-	TSubclassOf() = default;
+	UEStruct SoftObjectPath = ObjectArray::FindObjectFast<UEStruct>("SoftObjectPath");
+
+	/* if SoftObjectPath doesn't exist just generate FStringAssetReference and call it SoftObjectPath, it's basically the same thing anyways */
+	if (!SoftObjectPath)
+	{
+		/* struct FSoftObjectPtr */
+		PredefinedStruct FSoftObjectPath = PredefinedStruct{
+			.UniqueName = "FSoftObjectPath", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = false, .bIsUnion = false, .Super = nullptr
+		};
+
+		FSoftObjectPath.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "class FString", .Name = "AssetLongPathname", .Offset = 0x0, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
 
-	inline TSubclassOf(UClass* Class)
-		: ClassPtr(Class)
-	{
+		GenerateStruct(&FSoftObjectPath, BasicHpp, BasicCpp, BasicHpp);
 	}
-
-	inline UClass* Get()
+	else /* if SoftObjectPath exists generate a copy of it within this namespace to allow for TSoftObjectPtr declaration (comes before real SoftObjectPath) */
 	{
-		return ClassPtr;
-	}
+		UEProperty Assetpath = SoftObjectPath.FindMember("AssetPath");
 
-	inline operator UClass*() const
-	{
-		return ClassPtr;
-	}
+		if (Assetpath && Assetpath.IsA(EClassCastFlags::StructProperty))
+			GenerateStruct(Assetpath.Cast<UEStructProperty>().GetUnderlayingStruct(), BasicHpp, BasicCpp, BasicHpp);
 
-	template<typename Target, typename = std::enable_if<std::is_base_of_v<Target, ClassType>, bool>::type>
-	inline operator TSubclassOf<Target>() const
-	{
-		return ClassPtr;
+		GenerateStruct(SoftObjectPath, BasicHpp, BasicCpp, BasicHpp);
 	}
 
-	inline UClass* operator->()
-	{
-		return ClassPtr;
-	}
+	// Start Namespace 'FakeSoftObjectPtr'
+	BasicHpp << "\n}\n";
 
-	inline TSubclassOf& operator=(UClass* Class)
-	{
-		ClassPtr = Class;
 
-		return *this;
-	}
+	/* struct FSoftObjectPtr */
+	BasicHpp <<
+		R"(
+class FSoftObjectPtr : public TPersistentObjectPtr<FakeSoftObjectPtr::FSoftObjectPath>
+{
+};
+)";
 
-	inline bool operator==(const TSubclassOf& Other) const
+
+	/* struct TSoftObjectPtr */
+	BasicHpp <<
+		R"(
+template<typename UEType>
+class TSoftObjectPtr : public FSoftObjectPtr
+{
+public:
+	UEType* Get() const
 	{
-		return ClassPtr == Other.ClassPtr;
+		return static_cast<UEType*>(TPersistentObjectPtr::Get());
 	}
-
-	inline bool operator!=(const TSubclassOf& Other) const
+	UEType* operator->() const
 	{
-		return ClassPtr != Other.ClassPtr;
+		return static_cast<UEType*>(TPersistentObjectPtr::Get());
 	}
+};
+)";
 
-	inline bool operator==(UClass* Other) const
+	/* struct TSoftClassPtr */
+	BasicHpp <<
+		R"(
+template<typename UEType>
+class TSoftClassPtr : public FSoftObjectPtr
+{
+public:
+	UEType* Get() const
 	{
-		return ClassPtr == Other;
+		return static_cast<UEType*>(TPersistentObjectPtr::Get());
 	}
-
-	inline bool operator!=(UClass* Other) const
+	UEType* operator->() const
 	{
-		return ClassPtr != Other;
+		return static_cast<UEType*>(TPersistentObjectPtr::Get());
 	}
 };
 )";
 
-	const int32 TextDataSize = (Off::InSDK::Text::InTextDataStringOffset + 0x10);
 
-	/* class FTextData */
-	PredefinedStruct FTextData = PredefinedStruct{
-		.UniqueName = "FTextData", .Size = TextDataSize, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	/* class FScriptInterface */
+	PredefinedStruct FScriptInterface = PredefinedStruct{
+		.UniqueName = "FScriptInterface", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
 	};
 
-	FTextData.Properties =
+	FScriptInterface.Properties =
 	{
 		PredefinedMember {
 			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class FString", .Name = "TextSource", .Offset = Off::InSDK::Text::InTextDataStringOffset, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
+			.Type = "UObject*", .Name = "ObjectPointer", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
-	};
-
-	BasicHpp << R"(namespace FTextImpl
-{)";
-	GenerateStruct(&FTextData, BasicHpp, BasicCpp, BasicHpp);
-	BasicHpp << "}\n";
-
-	/* class FText */
-	PredefinedStruct FText = PredefinedStruct{
-		.UniqueName = "FText", .Size = Off::InSDK::Text::TextSize, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-	};
-
-	FText.Properties =
-	{
 		PredefinedMember {
 			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "class FTextImpl::FTextData*", .Name = "TextData", .Offset = Off::InSDK::Text::TextDatOffset, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x1,
+			.Type = "void*", .Name = "InterfacePointer", .Offset = 0x8, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
 	};
 
-	FText.Functions =
+	FScriptInterface.Functions =
 	{
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "const class FString&", .NameWithParams = "GetStringRef()", .Body =
+			.ReturnType = "class UObject*", .NameWithParams = "GetObjectRef()", .Body =
 R"({
-	return TextData->TextSource;
-})",
+	return ObjectPointer;
+}
+)",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 		},
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "std::string", .NameWithParams = "ToString()", .Body =
+			.ReturnType = "void*", .NameWithParams = "GetInterfaceRef()", .Body =
 R"({
-	return TextData->TextSource.ToString();
-})",
+	return InterfacePointer;
+}
+)",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 		},
 	};
 
-	GenerateStruct(&FText, BasicHpp, BasicCpp, BasicHpp);
-
+	GenerateStruct(&FScriptInterface, BasicHpp, BasicCpp, BasicHpp);
 
-	constexpr int32 FWeakObjectPtrSize = 0x8;
 
-	/* class FWeakObjectPtr */
-	PredefinedStruct FWeakObjectPtr = PredefinedStruct{
-		.UniqueName = "FWeakObjectPtr", .Size = FWeakObjectPtrSize, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	/* class TScriptInterface */
+	PredefinedStruct TScriptInterface = PredefinedStruct{
+		.CustomTemplateText = "template<class InterfaceType>",
+		.UniqueName = "TScriptInterface", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = &FScriptInterface
 	};
 
-	FWeakObjectPtr.Properties =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "ObjectIndex", .Offset = 0x0, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "ObjectSerialNumber", .Offset = 0x4, .Size = 0x4, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	GenerateStruct(&TScriptInterface, BasicHpp, BasicCpp, BasicHpp);
 
-	FWeakObjectPtr.Functions =
+
+	if (Settings::Internal::bUseFProperty)
 	{
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "class UObject*", .NameWithParams = "Get()", .Body =
-R"({
-	return UObject::GObjects->GetByIndex(ObjectIndex);
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "class UObject*", .NameWithParams = "operator->()", .Body =
-R"({
-	return UObject::GObjects->GetByIndex(ObjectIndex);
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "bool", .NameWithParams = "operator==(const FWeakObjectPtr& Other)", .Body =
-R"({
-	return ObjectIndex == Other.ObjectIndex;
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "bool", .NameWithParams = "operator!=(const FWeakObjectPtr& Other)", .Body =
-R"({
-	return ObjectIndex != Other.ObjectIndex;
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "bool", .NameWithParams = "operator==(const class UObject* Other)", .Body =
-R"({
-	return ObjectIndex == Other->Index;
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "bool", .NameWithParams = "operator!=(const class UObject* Other)", .Body =
-R"({
-	return ObjectIndex != Other->Index;
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
-		},
-	};
+		/* class FFieldPath */
+		PredefinedStruct FFieldPath = PredefinedStruct{
+			.UniqueName = "FFieldPath", .Size = PropertySizes::FieldPathProperty, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+		};
+
+		FFieldPath.Properties =
+		{
+			PredefinedMember {
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "class FField*", .Name = "ResolvedField", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			},
+		};
+
+		/* #ifdef WITH_EDITORONLY_DATA */
+		const bool bIsWithEditorOnlyData = PropertySizes::FieldPathProperty > 0x20;
+
+		if (bIsWithEditorOnlyData)
+		{
+			FFieldPath.Properties.emplace_back
+			(
+				PredefinedMember{
+					.Comment = "NOT AUTO-GENERATED PROPERTY",
+					.Type = "class FFieldClass*", .Name = "InitialFieldClass", .Offset = 0x08, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
+					.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+				}
+			);
+			FFieldPath.Properties.emplace_back
+			(
+				PredefinedMember{
+					.Comment = "NOT AUTO-GENERATED PROPERTY",
+					.Type = "int32", .Name = "FieldPathSerialNumber", .Offset = 0x10, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+					.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+				}
+			);
+		}
+
+		FFieldPath.Properties.push_back
+		(
+			PredefinedMember{
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "TWeakObjectPtr<class UStruct>", .Name = "ResolvedOwner", .Offset = (bIsWithEditorOnlyData ? 0x14 : 0x8), .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x4,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			}
+		);
+		FFieldPath.Properties.push_back
+		(
+			PredefinedMember{
+				.Comment = "NOT AUTO-GENERATED PROPERTY",
+				.Type = "TArray<FName>", .Name = "Path", .Offset = (bIsWithEditorOnlyData ? 0x20 : 0x10), .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
+				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+			}
+		);
+
+		GenerateStruct(&FFieldPath, BasicHpp, BasicCpp, BasicHpp);
+
+		/* class TFieldPath */
+		PredefinedStruct TFieldPath = PredefinedStruct{
+			.CustomTemplateText = "template<class PropertyType>",
+			.UniqueName = "TFieldPath", .Size = PropertySizes::FieldPathProperty, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = &FFieldPath
+		};
 
-	GenerateStruct(&FWeakObjectPtr, BasicHpp, BasicCpp, BasicHpp);
+		GenerateStruct(&TFieldPath, BasicHpp, BasicCpp, BasicHpp);
 
 
-	BasicHpp <<
-		R"(
-template<typename UEType>
-class TWeakObjectPtr : public FWeakObjectPtr
+
+		// TOptional
+		BasicHpp << R"(
+
+template<typename OptionalType, bool bIsIntrusiveUnsetCheck = false>
+class TOptional
 {
+private:
+	template<int32 TypeSize>
+	struct OptionalWithBool
+	{
+		static_assert(TypeSize > 0x0, "TOptional can not store an empty type!");
+
+		uint8 Value[TypeSize];
+		bool bIsSet;
+	};
+
+private:
+	using ValueType = std::conditional_t<bIsIntrusiveUnsetCheck, uint8[sizeof(OptionalType)], OptionalWithBool<sizeof(OptionalType)>>;
+
+private:
+	alignas(OptionalType) ValueType StoredValue;
+
+private:
+	inline uint8* GetValueBytes()
+	{
+		if constexpr (!bIsIntrusiveUnsetCheck)
+			return StoredValue.Value;
+
+		return StoredValue;
+	}
+
+	inline const uint8* GetValueBytes() const
+	{
+		if constexpr (!bIsIntrusiveUnsetCheck)
+			return StoredValue.Value;
+
+		return StoredValue;
+	}
 public:
-	UEType* Get() const
+
+	inline OptionalType& GetValueRef()
 	{
-		return static_cast<UEType*>(FWeakObjectPtr::Get());
+		return *reinterpret_cast<OptionalType*>(GetValueBytes());
 	}
 
-	UEType* operator->() const
+	inline const OptionalType& GetValueRef() const
 	{
-		return static_cast<UEType*>(FWeakObjectPtr::Get());
+		return *reinterpret_cast<const OptionalType*>(GetValueBytes());
+	}
+
+	inline bool IsSet() const
+	{
+		if constexpr (!bIsIntrusiveUnsetCheck)
+			return StoredValue.bIsSet;
+
+		constexpr char ZeroBytes[sizeof(OptionalType)];
+
+		return memcmp(GetValueBytes(), &ZeroBytes, sizeof(OptionalType)) == 0;
+	}
+
+	inline explicit operator bool() const
+	{
+		return IsSet();
 	}
 };
+
 )";
+	} /* End 'if (Settings::Internal::bUseFProperty)' */
 
+	const auto ScriptDelegateSize = (FWeakObjectPtrSize + Off::InSDK::Name::FNameSize);
 
-	/* class FUniqueObjectGuid */
-	PredefinedStruct FUniqueObjectGuid = PredefinedStruct{
-		.UniqueName = "FUniqueObjectGuid", .Size = 0x10, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	/* FScriptDelegate */
+	PredefinedStruct FScriptDelegate = PredefinedStruct{
+		.UniqueName = "FScriptDelegate", .Size = ScriptDelegateSize, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = false, .bIsUnion = false, .Super = nullptr
 	};
 
-	FUniqueObjectGuid.Properties =
+	FScriptDelegate.Properties =
 	{
 		PredefinedMember {
 			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint32", .Name = "A", .Offset = 0x0, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint32", .Name = "B", .Offset = 0x4, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint32", .Name = "C", .Offset = 0x8, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.Type = "FWeakObjectPtr", .Name = "Object", .Offset = 0x0, .Size = FWeakObjectPtrSize, .ArrayDim = 0x1, .Alignment = 0x4,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
 		PredefinedMember {
 			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "uint32", .Name = "D", .Offset = 0xC, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.Type = "FName", .Name = "FunctionName", .Offset = FWeakObjectPtrSize, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
 	};
 
-	GenerateStruct(&FUniqueObjectGuid, BasicHpp, BasicCpp, BasicHpp);
+	GenerateStruct(&FScriptDelegate, BasicHpp, BasicCpp, BasicHpp);
 
 
-	/* class TPersistentObjectPtr */
-	PredefinedStruct TPersistentObjectPtr = PredefinedStruct{
-		.CustomTemplateText = "template<typename TObjectID>",
-		.UniqueName = "TPersistentObjectPtr", .Size = 0x0, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	/* TDelegate */
+	PredefinedStruct TDelegate = PredefinedStruct{
+		.CustomTemplateText = "template<typename FunctionSignature>",
+		.UniqueName = "TDelegate", .Size = PropertySizes::DelegateProperty, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
 	};
 
-	const int32 ObjectIDOffset = Settings::Internal::bIsWeakObjectPtrWithoutTag ? 0x8 : 0xC;
-
-	TPersistentObjectPtr.Properties =
+	TDelegate.Properties =
 	{
 		PredefinedMember {
 			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "FWeakObjectPtr", .Name = "WeakPtr", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x4,
+			.Type = "struct InvalidUseOfTDelegate", .Name = "TemplateParamIsNotAFunctionSignature", .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x1,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
+	};
+
+
+	GenerateStruct(&TDelegate, BasicHpp, BasicCpp, BasicHpp);
+
+	/* TDelegate<Ret(Args...)> */
+	PredefinedStruct TDelegateSpezialiation = PredefinedStruct{
+		.CustomTemplateText = "template<typename Ret, typename... Args>",
+		.UniqueName = "TDelegate<Ret(Args...)>", .Size = PropertySizes::DelegateProperty, .Alignment = 0x1, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
+
+	TDelegateSpezialiation.Properties =
+	{
 		PredefinedMember {
 			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "int32", .Name = "TagAtLastTest", .Offset = 0x8, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+			.Type = "FScriptDelegate", .Name = "BoundFunction", .Offset = 0x0, .Size = ScriptDelegateSize, .ArrayDim = 0x1, .Alignment = 0x8,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
+		}
+	};
+
+	GenerateStruct(&TDelegateSpezialiation, BasicHpp, BasicCpp, BasicHpp);
+
+	/* TMulticastInlineDelegate */
+	PredefinedStruct TMulticastInlineDelegate = PredefinedStruct{
+		.CustomTemplateText = "template<typename FunctionSignature>",
+		.UniqueName = "TMulticastInlineDelegate", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
+
+	TMulticastInlineDelegate.Properties =
+	{
 		PredefinedMember {
 			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "TObjectID", .Name = "ObjectID", .Offset = ObjectIDOffset, .Size = 0x00, .ArrayDim = 0x1, .Alignment = 0x1,
+			.Type = "struct InvalidUseOfTMulticastInlineDelegate", .Name = "TemplateParamIsNotAFunctionSignature", .Offset = 0x0, .Size = ScriptDelegateSize, .ArrayDim = 0x1, .Alignment = 0x1,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
 	};
 
-	if (Settings::Internal::bIsWeakObjectPtrWithoutTag)
-		TPersistentObjectPtr.Properties.erase(TPersistentObjectPtr.Properties.begin() + 1); // TagAtLast
+	GenerateStruct(&TMulticastInlineDelegate, BasicHpp, BasicCpp, BasicHpp);
 
-	TPersistentObjectPtr.Functions =
+	/* TMulticastInlineDelegate<Ret(Args...)> */
+	PredefinedStruct TMulticastInlineDelegateSpezialiation = PredefinedStruct{
+		.CustomTemplateText = "template<typename Ret, typename... Args>",
+		.UniqueName = "TMulticastInlineDelegate<Ret(Args...)>", .Size = 0x0, .Alignment = 0x1, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
+	};
+
+	TMulticastInlineDelegateSpezialiation.Properties =
 	{
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "class UObject*", .NameWithParams = "Get()", .Body =
-R"({
-	return WeakPtr.Get();
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "class UObject*", .NameWithParams = "operator->()", .Body =
-R"({
-	return WeakPtr.Get();
-})",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-		},
+		PredefinedMember {
+			.Comment = "NOT AUTO-GENERATED PROPERTY",
+			.Type = "TArray<FScriptDelegate>", .Name = "InvocationList", .Offset = 0x0, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
+			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		}
 	};
 
-	GenerateStruct(&TPersistentObjectPtr, BasicHpp, BasicCpp, BasicHpp);
+	GenerateStruct(&TMulticastInlineDelegateSpezialiation, BasicHpp, BasicCpp, BasicHpp);
 
 
-	/* class TLazyObjectPtr */
+	/* UE_ENUM_OPERATORS - enum flag operations */
 	BasicHpp <<
 		R"(
-template<typename UEType>
-class TLazyObjectPtr : public TPersistentObjectPtr<FUniqueObjectGuid>
-{
-public:
-	UEType* Get() const
-	{
-		return static_cast<UEType*>(TPersistentObjectPtr::Get());
-	}
-	UEType* operator->() const
-	{
-		return static_cast<UEType*>(TPersistentObjectPtr::Get());
-	}
-};
+#define UE_ENUM_OPERATORS(EEnumClass)																																	\
+																																										\
+inline constexpr EEnumClass operator|(EEnumClass Left, EEnumClass Right)																								\
+{																																										\
+	return (EEnumClass)((std::underlying_type<EEnumClass>::type)(Left) | (std::underlying_type<EEnumClass>::type)(Right));												\
+}																																										\
+																																										\
+inline constexpr EEnumClass& operator|=(EEnumClass& Left, EEnumClass Right)																								\
+{																																										\
+	return (EEnumClass&)((std::underlying_type<EEnumClass>::type&)(Left) |= (std::underlying_type<EEnumClass>::type)(Right));											\
+}																																										\
+																																										\
+inline bool operator&(EEnumClass Left, EEnumClass Right)																												\
+{																																										\
+	return (((std::underlying_type<EEnumClass>::type)(Left) & (std::underlying_type<EEnumClass>::type)(Right)) == (std::underlying_type<EEnumClass>::type)(Right));		\
+}																																										
 )";
 
-
-	// Start Namespace 'FakeSoftObjectPtr'
+	/* enum class EObjectFlags */
 	BasicHpp <<
 		R"(
-namespace FakeSoftObjectPtr
+enum class EObjectFlags : int32
 {
-)";
+	NoFlags							= 0x00000000,
 
-	UEStruct SoftObjectPath = ObjectArray::FindObjectFast<UEStruct>("SoftObjectPath");
+	Public							= 0x00000001,
+	Standalone						= 0x00000002,
+	MarkAsNative					= 0x00000004,
+	Transactional					= 0x00000008,
+	ClassDefaultObject				= 0x00000010,
+	ArchetypeObject					= 0x00000020,
+	Transient						= 0x00000040,
 
-	/* if SoftObjectPath doesn't exist just generate FStringAssetReference and call it SoftObjectPath, it's basically the same thing anyways */
-	if (!SoftObjectPath)
-	{
-		/* struct FSoftObjectPtr */
-		PredefinedStruct FSoftObjectPath = PredefinedStruct{
-			.UniqueName = "FSoftObjectPath", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = false, .bIsUnion = false, .Super = nullptr
-		};
+	MarkAsRootSet					= 0x00000080,
+	TagGarbageTemp					= 0x00000100,
 
-		FSoftObjectPath.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "class FString", .Name = "AssetLongPathname", .Offset = 0x0, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+	NeedInitialization				= 0x00000200,
+	NeedLoad						= 0x00000400,
+	KeepForCooker					= 0x00000800,
+	NeedPostLoad					= 0x00001000,
+	NeedPostLoadSubobjects			= 0x00002000,
+	NewerVersionExists				= 0x00004000,
+	BeginDestroyed					= 0x00008000,
+	FinishDestroyed					= 0x00010000,
+
+	BeingRegenerated				= 0x00020000,
+	DefaultSubObject				= 0x00040000,
+	WasLoaded						= 0x00080000,
+	TextExportTransient				= 0x00100000,
+	LoadCompleted					= 0x00200000,
+	InheritableComponentTemplate	= 0x00400000,
+	DuplicateTransient				= 0x00800000,
+	StrongRefOnFrame				= 0x01000000,
+	NonPIEDuplicateTransient		= 0x02000000,
+	Dynamic							= 0x04000000,
+	WillBeLoaded					= 0x08000000,
+	HasExternalPackage				= 0x10000000,
 
-		GenerateStruct(&FSoftObjectPath, BasicHpp, BasicCpp, BasicHpp);
-	}
-	else /* if SoftObjectPath exists generate a copy of it within this namespace to allow for TSoftObjectPtr declaration (comes before real SoftObjectPath) */
-	{
-		UEProperty Assetpath = SoftObjectPath.FindMember("AssetPath");
+	MirroredGarbage					= 0x40000000,
+	AllocatedInSharedPage			= 0x80000000,
+};
+)";
 
-		if (Assetpath && Assetpath.IsA(EClassCastFlags::StructProperty))
-			GenerateStruct(Assetpath.Cast<UEStructProperty>().GetUnderlayingStruct(), BasicHpp, BasicCpp, BasicHpp);
 
-		GenerateStruct(SoftObjectPath, BasicHpp, BasicCpp, BasicHpp);
-	}
+	/* enum class EFunctionFlags */
+	BasicHpp <<
+		R"(
+enum class EFunctionFlags : uint32
+{
+	None							= 0x00000000,
 
-	// Start Namespace 'FakeSoftObjectPtr'
-	BasicHpp << "\n}\n";
+	Final							= 0x00000001,
+	RequiredAPI						= 0x00000002,
+	BlueprintAuthorityOnly			= 0x00000004, 
+	BlueprintCosmetic				= 0x00000008, 
+	Net								= 0x00000040,  
+	NetReliable						= 0x00000080, 
+	NetRequest						= 0x00000100,	
+	Exec							= 0x00000200,	
+	Native							= 0x00000400,	
+	Event							= 0x00000800,   
+	NetResponse						= 0x00001000,  
+	Static							= 0x00002000,   
+	NetMulticast					= 0x00004000,	
+	UbergraphFunction				= 0x00008000,  
+	MulticastDelegate				= 0x00010000,
+	Public							= 0x00020000,	
+	Private							= 0x00040000,	
+	Protected						= 0x00080000,
+	Delegate						= 0x00100000,	
+	NetServer						= 0x00200000,	
+	HasOutParms						= 0x00400000,	
+	HasDefaults						= 0x00800000,
+	NetClient						= 0x01000000,
+	DLLImport						= 0x02000000,
+	BlueprintCallable				= 0x04000000,
+	BlueprintEvent					= 0x08000000,
+	BlueprintPure					= 0x10000000,	
+	EditorOnly						= 0x20000000,	
+	Const							= 0x40000000,
+	NetValidate						= 0x80000000,
 
+	AllFlags						= 0xFFFFFFFF,
+};
+)";
 
-	/* struct FSoftObjectPtr */
+	/* enum class EClassFlags */
 	BasicHpp <<
 		R"(
-class FSoftObjectPtr : public TPersistentObjectPtr<FakeSoftObjectPtr::FSoftObjectPath>
+enum class EClassFlags : uint32
 {
+	CLASS_None						= 0x00000000u,
+	Abstract						= 0x00000001u,
+	DefaultConfig					= 0x00000002u,
+	Config							= 0x00000004u,
+	Transient						= 0x00000008u,
+	Parsed							= 0x00000010u,
+	MatchedSerializers				= 0x00000020u,
+	ProjectUserConfig				= 0x00000040u,
+	Native							= 0x00000080u,
+	NoExport						= 0x00000100u,
+	NotPlaceable					= 0x00000200u,
+	PerObjectConfig					= 0x00000400u,
+	ReplicationDataIsSetUp			= 0x00000800u,
+	EditInlineNew					= 0x00001000u,
+	CollapseCategories				= 0x00002000u,
+	Interface						= 0x00004000u,
+	CustomConstructor				= 0x00008000u,
+	Const							= 0x00010000u,
+	LayoutChanging					= 0x00020000u,
+	CompiledFromBlueprint			= 0x00040000u,
+	MinimalAPI						= 0x00080000u,
+	RequiredAPI						= 0x00100000u,
+	DefaultToInstanced				= 0x00200000u,
+	TokenStreamAssembled			= 0x00400000u,
+	HasInstancedReference			= 0x00800000u,
+	Hidden							= 0x01000000u,
+	Deprecated						= 0x02000000u,
+	HideDropDown					= 0x04000000u,
+	GlobalUserConfig				= 0x08000000u,
+	Intrinsic						= 0x10000000u,
+	Constructed						= 0x20000000u,
+	ConfigDoNotCheckDefaults		= 0x40000000u,
+	NewerVersionExists				= 0x80000000u,
 };
 )";
 
-
-	/* struct TSoftObjectPtr */
+	/* enum class EClassCastFlags */
 	BasicHpp <<
 		R"(
-template<typename UEType>
-class TSoftObjectPtr : public FSoftObjectPtr
+enum class EClassCastFlags : uint64
 {
-public:
-	UEType* Get() const
-	{
-		return static_cast<UEType*>(TPersistentObjectPtr::Get());
-	}
-	UEType* operator->() const
-	{
-		return static_cast<UEType*>(TPersistentObjectPtr::Get());
-	}
+	None = 0x0000000000000000,
+
+	Field								= 0x0000000000000001,
+	Int8Property						= 0x0000000000000002,
+	Enum								= 0x0000000000000004,
+	Struct								= 0x0000000000000008,
+	ScriptStruct						= 0x0000000000000010,
+	Class								= 0x0000000000000020,
+	ByteProperty						= 0x0000000000000040,
+	IntProperty							= 0x0000000000000080,
+	FloatProperty						= 0x0000000000000100,
+	UInt64Property						= 0x0000000000000200,
+	ClassProperty						= 0x0000000000000400,
+	UInt32Property						= 0x0000000000000800,
+	InterfaceProperty					= 0x0000000000001000,
+	NameProperty						= 0x0000000000002000,
+	StrProperty							= 0x0000000000004000,
+	Property							= 0x0000000000008000,
+	ObjectProperty						= 0x0000000000010000,
+	BoolProperty						= 0x0000000000020000,
+	UInt16Property						= 0x0000000000040000,
+	Function							= 0x0000000000080000,
+	StructProperty						= 0x0000000000100000,
+	ArrayProperty						= 0x0000000000200000,
+	Int64Property						= 0x0000000000400000,
+	DelegateProperty					= 0x0000000000800000,
+	NumericProperty						= 0x0000000001000000,
+	MulticastDelegateProperty			= 0x0000000002000000,
+	ObjectPropertyBase					= 0x0000000004000000,
+	WeakObjectProperty					= 0x0000000008000000,
+	LazyObjectProperty					= 0x0000000010000000,
+	SoftObjectProperty					= 0x0000000020000000,
+	TextProperty						= 0x0000000040000000,
+	Int16Property						= 0x0000000080000000,
+	DoubleProperty						= 0x0000000100000000,
+	SoftClassProperty					= 0x0000000200000000,
+	Package								= 0x0000000400000000,
+	Level								= 0x0000000800000000,
+	Actor								= 0x0000001000000000,
+	PlayerController					= 0x0000002000000000,
+	Pawn								= 0x0000004000000000,
+	SceneComponent						= 0x0000008000000000,
+	PrimitiveComponent					= 0x0000010000000000,
+	SkinnedMeshComponent				= 0x0000020000000000,
+	SkeletalMeshComponent				= 0x0000040000000000,
+	Blueprint							= 0x0000080000000000,
+	DelegateFunction					= 0x0000100000000000,
+	StaticMeshComponent					= 0x0000200000000000,
+	MapProperty							= 0x0000400000000000,
+	SetProperty							= 0x0000800000000000,
+	EnumProperty						= 0x0001000000000000,
+	USparseDelegateFunction				= 0x0002000000000000,
+	MulticastInlineDelegateProperty	    = 0x0004000000000000,
+	MulticastSparseDelegateProperty	    = 0x0008000000000000,
+	FieldPathProperty					= 0x0010000000000000,
+	LargeWorldCoordinatesRealProperty	= 0x0080000000000000,
+	OptionalProperty					= 0x0100000000000000,
+	VValueProperty						= 0x0200000000000000,
+	UVerseVMClass						= 0x0400000000000000,
+	VRestValueProperty					= 0x0800000000000000,
 };
 )";
 
-	/* struct TSoftClassPtr */
+	/* enum class EPropertyFlags */
 	BasicHpp <<
 		R"(
-template<typename UEType>
-class TSoftClassPtr : public FSoftObjectPtr
+enum class EPropertyFlags : uint64
 {
-public:
-	UEType* Get() const
-	{
-		return static_cast<UEType*>(TPersistentObjectPtr::Get());
-	}
-	UEType* operator->() const
-	{
-		return static_cast<UEType*>(TPersistentObjectPtr::Get());
-	}
-};
-)";
+	None								= 0x0000000000000000,
+
+	Edit								= 0x0000000000000001,
+	ConstParm							= 0x0000000000000002,
+	BlueprintVisible					= 0x0000000000000004,
+	ExportObject						= 0x0000000000000008,
+	BlueprintReadOnly					= 0x0000000000000010,
+	Net									= 0x0000000000000020,
+	EditFixedSize						= 0x0000000000000040,
+	Parm								= 0x0000000000000080,
+	OutParm								= 0x0000000000000100,
+	ZeroConstructor						= 0x0000000000000200,
+	ReturnParm							= 0x0000000000000400,
+	DisableEditOnTemplate 				= 0x0000000000000800,
 
+	Transient							= 0x0000000000002000,
+	Config								= 0x0000000000004000,
 
-	/* class FScriptInterface */
-	PredefinedStruct FScriptInterface = PredefinedStruct{
-		.UniqueName = "FScriptInterface", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-	};
+	DisableEditOnInstance				= 0x0000000000010000,
+	EditConst							= 0x0000000000020000,
+	GlobalConfig						= 0x0000000000040000,
+	InstancedReference					= 0x0000000000080000,	
 
-	FScriptInterface.Properties =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "UObject*", .Name = "ObjectPointer", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "void*", .Name = "InterfacePointer", .Offset = 0x8, .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	DuplicateTransient					= 0x0000000000200000,	
+	SubobjectReference					= 0x0000000000400000,	
 
-	FScriptInterface.Functions =
-	{
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "class UObject*", .NameWithParams = "GetObjectRef()", .Body =
-R"({
-	return ObjectPointer;
-}
-)",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-		},
-		PredefinedFunction {
-			.CustomComment = "",
-			.ReturnType = "void*", .NameWithParams = "GetInterfaceRef()", .Body =
-R"({
-	return InterfacePointer;
-}
-)",
-			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
-		},
-	};
+	SaveGame							= 0x0000000001000000,
+	NoClear								= 0x0000000002000000,
+
+	ReferenceParm						= 0x0000000008000000,
+	BlueprintAssignable					= 0x0000000010000000,
+	Deprecated							= 0x0000000020000000,
+	IsPlainOldData						= 0x0000000040000000,
+	RepSkip								= 0x0000000080000000,
+	RepNotify							= 0x0000000100000000, 
+	Interp								= 0x0000000200000000,
+	NonTransactional					= 0x0000000400000000,
+	EditorOnly							= 0x0000000800000000,
+	NoDestructor						= 0x0000001000000000,
 
-	GenerateStruct(&FScriptInterface, BasicHpp, BasicCpp, BasicHpp);
+	AutoWeak							= 0x0000004000000000,
+	ContainsInstancedReference			= 0x0000008000000000,	
+	AssetRegistrySearchable				= 0x0000010000000000,
+	SimpleDisplay						= 0x0000020000000000,
+	AdvancedDisplay						= 0x0000040000000000,
+	Protected							= 0x0000080000000000,
+	BlueprintCallable					= 0x0000100000000000,
+	BlueprintAuthorityOnly				= 0x0000200000000000,
+	TextExportTransient					= 0x0000400000000000,
+	NonPIEDuplicateTransient			= 0x0000800000000000,
+	ExposeOnSpawn						= 0x0001000000000000,
+	PersistentInstance					= 0x0002000000000000,
+	UObjectWrapper						= 0x0004000000000000, 
+	HasGetValueTypeHash					= 0x0008000000000000, 
+	NativeAccessSpecifierPublic			= 0x0010000000000000,	
+	NativeAccessSpecifierProtected		= 0x0020000000000000,
+	NativeAccessSpecifierPrivate		= 0x0040000000000000,	
+	SkipSerialization					= 0x0080000000000000, 
+};
+)";
 
+	/* enum class EClassCastFlags */
+	BasicHpp << R"(
+UE_ENUM_OPERATORS(EObjectFlags);
+UE_ENUM_OPERATORS(EFunctionFlags);
+UE_ENUM_OPERATORS(EClassFlags);
+UE_ENUM_OPERATORS(EClassCastFlags);
+UE_ENUM_OPERATORS(EPropertyFlags);
+)";
 
-	/* class TScriptInterface */
-	PredefinedStruct TScriptInterface = PredefinedStruct{
-		.CustomTemplateText = "template<class InterfaceType>",
-		.UniqueName = "TScriptInterface", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = &FScriptInterface
-	};
 
-	GenerateStruct(&TScriptInterface, BasicHpp, BasicCpp, BasicHpp);
+	/* TObjectRange iterates GObjects chunk by chunk, prefiltering by CastFlags where possible */
+	BasicHpp << R"(
+/*
+* Iterates all objects of type UEType (including subclasses) in a single linear pass over GObjects.
+* 
+* Objects are prefiltered by the CastFlags of UEType::StaticClass(). If UEType introduces a CastFlag of its own the
+* prefilter is exact, otherwise it falls back to UClass::IsSubclassOf for objects that passed the prefilter.
+* 
+* Usage: for (AActor* Actor : TObjectRange<AActor>()) { ... }
+*/
+template<typename UEType>
+class TObjectRange
+{
+private:
+	const class UClass* TargetClass = nullptr;
+	EClassCastFlags RequiredFlags = EClassCastFlags::None;
 
+	bool bFlagsAreExact = false;
+	bool bMatchAll = false;
+	bool bIncludeDefaultObjects = false;
 
-	if (Settings::Internal::bUseFProperty)
+public:
+	class FIterator
 	{
-		/* class FFieldPath */
-		PredefinedStruct FFieldPath = PredefinedStruct{
-			.UniqueName = "FFieldPath", .Size = PropertySizes::FieldPathProperty, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-		};
+	private:
+		const TObjectRange* Range = nullptr;
+		const class TUObjectArray* Array = nullptr;
 
-		FFieldPath.Properties =
-		{
-			PredefinedMember {
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "class FField*", .Name = "ResolvedField", .Offset = 0x0, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			},
-		};
+		FUObjectItem* ChunkItems = nullptr;
+		int32 NumItemsInChunk = 0;
+		int32 NumChunks = 0;
+		int32 ChunkIndex = -1;
+		int32 InChunkIndex = -1;
 
-		/* #ifdef WITH_EDITORONLY_DATA */
-		const bool bIsWithEditorOnlyData = PropertySizes::FieldPathProperty > 0x20;
+		UEType* Current = nullptr;
 
-		if (bIsWithEditorOnlyData)
+	public:
+		FIterator() = default;
+
+		inline FIterator(const TObjectRange* InRange, const class TUObjectArray* InArray)
+			: Range(InRange), Array(InArray), NumChunks(InArray ? InArray->GetNumChunks() : 0)
 		{
-			FFieldPath.Properties.emplace_back
-			(
-				PredefinedMember{
-					.Comment = "NOT AUTO-GENERATED PROPERTY",
-					.Type = "class FFieldClass*", .Name = "InitialFieldClass", .Offset = 0x08, .Size = 0x08, .ArrayDim = 0x1, .Alignment = 0x8,
-					.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-				}
-			);
-			FFieldPath.Properties.emplace_back
-			(
-				PredefinedMember{
-					.Comment = "NOT AUTO-GENERATED PROPERTY",
-					.Type = "int32", .Name = "FieldPathSerialNumber", .Offset = 0x10, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
-					.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-				}
-			);
+			Advance();
 		}
 
-		FFieldPath.Properties.push_back
-		(
-			PredefinedMember{
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "TWeakObjectPtr<class UStruct>", .Name = "ResolvedOwner", .Offset = (bIsWithEditorOnlyData ? 0x14 : 0x8), .Size = 0x8, .ArrayDim = 0x1, .Alignment = 0x4,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			}
-		);
-		FFieldPath.Properties.push_back
-		(
-			PredefinedMember{
-				.Comment = "NOT AUTO-GENERATED PROPERTY",
-				.Type = "TArray<FName>", .Name = "Path", .Offset = (bIsWithEditorOnlyData ? 0x20 : 0x10), .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
-				.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-			}
-		);
+	private:
+		inline void Advance()
+		{
+			while (true)
+			{
+				++InChunkIndex;
 
-		GenerateStruct(&FFieldPath, BasicHpp, BasicCpp, BasicHpp);
+				while (InChunkIndex >= NumItemsInChunk)
+				{
+					if (++ChunkIndex >= NumChunks)
+					{
+						Current = nullptr;
+						return;
+					}
 
-		/* class TFieldPath */
-		PredefinedStruct TFieldPath = PredefinedStruct{
-			.CustomTemplateText = "template<class PropertyType>",
-			.UniqueName = "TFieldPath", .Size = PropertySizes::FieldPathProperty, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = true, .bIsClass = true, .bIsUnion = false, .Super = &FFieldPath
-		};
+					ChunkItems = Array->GetChunkItems(ChunkIndex, NumItemsInChunk);
+					InChunkIndex = 0;
+				}
 
-		GenerateStruct(&TFieldPath, BasicHpp, BasicCpp, BasicHpp);
+				UEType* Object = static_cast<UEType*>(ChunkItems[InChunkIndex].Object);
+
+				if (Object && Range->Matches(Object))
+				{
+					Current = Object;
+					return;
+				}
+			}
+		}
 
+	public:
+		inline UEType* operator*() const { return Current; }
+		inline UEType* operator->() const { return Current; }
 
+		inline FIterator& operator++() { Advance(); return *this; }
 
-		// TOptional
-		BasicHpp << R"(
+		inline bool operator==(const FIterator& Other) const { return Current == Other.Current; }
+		inline bool operator!=(const FIterator& Other) const { return Current != Other.Current; }
+	};
 
-template<typename OptionalType, bool bIsIntrusiveUnsetCheck = false>
-class TOptional
-{
-private:
-	template<int32 TypeSize>
-	struct OptionalWithBool
+public:
+	inline explicit TObjectRange(bool bShouldIncludeDefaultObjects = false)
+		: bIncludeDefaultObjects(bShouldIncludeDefaultObjects)
 	{
-		static_assert(TypeSize > 0x0, "TOptional can not store an empty type!");
+		const auto* StaticClss = UEType::StaticClass();
 
-		uint8 Value[TypeSize];
-		bool bIsSet;
-	};
+		if (!StaticClss)
+			return;
 
-private:
-	using ValueType = std::conditional_t<bIsIntrusiveUnsetCheck, uint8[sizeof(OptionalType)], OptionalWithBool<sizeof(OptionalType)>>;
+		TargetClass = StaticClss;
+		RequiredFlags = StaticClss->CastFlags;
 
-private:
-	alignas(OptionalType) ValueType StoredValue;
+		const auto* SuperClass = static_cast<decltype(StaticClss)>(StaticClss->Super);
+
+		bMatchAll = !SuperClass;
+		bFlagsAreExact = RequiredFlags != EClassCastFlags::None && (!SuperClass || SuperClass->CastFlags != RequiredFlags);
+	}
 
 private:
-	inline uint8* GetValueBytes()
+	inline bool Matches(const UEType* Object) const
 	{
-		if constexpr (!bIsIntrusiveUnsetCheck)
-			return StoredValue.Value;
+		if (!bIncludeDefaultObjects && (Object->Flags & EObjectFlags::ClassDefaultObject))
+			return false;
 
-		return StoredValue;
-	}
+		if (bMatchAll)
+			return true;
 
-	inline const uint8* GetValueBytes() const
-	{
-		if constexpr (!bIsIntrusiveUnsetCheck)
-			return StoredValue.Value;
+		if (RequiredFlags != EClassCastFlags::None)
+		{
+			if (!(Object->Class->CastFlags & RequiredFlags))
+				return false;
 
-		return StoredValue;
+			if (bFlagsAreExact)
+				return true;
+		}
+
+		return Object->Class->IsSubclassOf(TargetClass);
 	}
-public:
 
-	inline OptionalType& GetValueRef()
+public:
+	inline FIterator begin() const
 	{
-		return *reinterpret_cast<OptionalType*>(GetValueBytes());
+		if (!TargetClass)
+			return FIterator();
+
+		return FIterator(this, UEType::GObjects.GetTypedPtr());
 	}
 
-	inline const OptionalType& GetValueRef() const
+	inline FIterator end() const
 	{
-		return *reinterpret_cast<const OptionalType*>(GetValueBytes());
+		return FIterator();
 	}
+};
 
-	inline bool IsSet() const
+/* Calls Callback(UEType*) for every object of type UEType, iteration stops early if the callback returns false */
+template<typename UEType, typename CallbackType>
+inline void ForEachObjectOfClass(CallbackType&& Callback, bool bIncludeDefaultObjects = false)
+{
+	for (UEType* Object : TObjectRange<UEType>(bIncludeDefaultObjects))
 	{
-		if constexpr (!bIsIntrusiveUnsetCheck)
-			return StoredValue.bIsSet;
+		if constexpr (std::is_same_v<std::invoke_result_t<CallbackType&, UEType*>, bool>)
+		{
+			if (!Callback(Object))
+				return;
+		}
+		else
+		{
+			Callback(Object);
+		}
+	}
+}
+)";
 
-		constexpr char ZeroBytes[sizeof(OptionalType)];
 
-		return memcmp(GetValueBytes(), &ZeroBytes, sizeof(OptionalType)) == 0;
-	}
+	/* ObjectLookupCache */
+	BasicHpp << R"(
+/*
+* Cache mapping the names of all objects in GObjects to their indices. Names are compared as FNames, instead of decoding the name of every object.
+*
+* Objects are added incrementally as 'GObjects->Num()' grows. Indices recycled by the engine after they were cached (eg. after a level-transition)
+* are re-indexed whenever a lookup misses, by comparing the FName of every cached index to the one it was cached with.
+*/
+namespace ObjectLookupCache
+{
+	/* Finds an object by its full-name, in the format 'Class Package.Outer.Object' */
+	class UObject* FindObject(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None);
 
-	inline explicit operator bool() const
-	{
-		return IsSet();
-	}
-};
+	/* Finds an object by its name */
+	class UObject* FindObjectFast(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None);
 
+	void Reset();
+}
 )";
-	} /* End 'if (Settings::Internal::bUseFProperty)' */
 
-	const auto ScriptDelegateSize = (FWeakObjectPtrSize + Off::InSDK::Name::FNameSize);
+	BasicCpp << std::format(R"(
+namespace ObjectLookupCache
+{{
+	/* FName of an object represented as a uint64, used to compare names without decoding them */
+	static uint64 GetNameKey(const UObject* Object)
+	{{
+		return (static_cast<uint64>(Object->Name.GetDisplayIndex()) << 32){};
+	}}
+)", !Settings::Internal::bUseOutlineNumberName ? " | static_cast<uint32>(Object->Name.Number)" : "");
 
-	/* FScriptDelegate */
-	PredefinedStruct FScriptDelegate = PredefinedStruct{
-		.UniqueName = "FScriptDelegate", .Size = ScriptDelegateSize, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = false, .bIsUnion = false, .Super = nullptr
-	};
+	BasicCpp << R"(
+	static std::mutex CacheMutex;
 
-	FScriptDelegate.Properties =
-	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "FWeakObjectPtr", .Name = "Object", .Offset = 0x0, .Size = FWeakObjectPtrSize, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "FName", .Name = "FunctionName", .Offset = FWeakObjectPtrSize, .Size = Off::InSDK::Name::FNameSize, .ArrayDim = 0x1, .Alignment = 0x4,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+	/* Keys of all FNames decoding to a string. Multiple FNames can share a string, as UObject::GetName() removes paths (eg. '/Script/Engine' and 'Engine') */
+	static std::unordered_map<std::string, std::vector<uint64>> NameKeysByString;
 
-	GenerateStruct(&FScriptDelegate, BasicHpp, BasicCpp, BasicHpp);
+	/* Indices of all objects with a certain FName, in ascending order. Can contain indices that were recycled since */
+	static std::unordered_map<uint64, std::vector<int32>> ObjectIndicesByNameKey;
 
+	/* Key with which every index was cached, 'InvalidNameKey' for indices without an object */
+	static std::vector<uint64> NameKeyByIndex;
 
-	/* TDelegate */
-	PredefinedStruct TDelegate = PredefinedStruct{
-		.CustomTemplateText = "template<typename FunctionSignature>",
-		.UniqueName = "TDelegate", .Size = PropertySizes::DelegateProperty, .Alignment = 0x4, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-	};
+	static constexpr uint64 InvalidNameKey = ~0ull;
 
-	TDelegate.Properties =
+	static int32 NumCachedObjects = 0;
+
+	static void AddToIndex(const UObject* Object, int32 Index)
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "struct InvalidUseOfTDelegate", .Name = "TemplateParamIsNotAFunctionSignature", .Offset = 0x0, .Size = 0x0, .ArrayDim = 0x1, .Alignment = 0x1,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		const uint64 NameKey = GetNameKey(Object);
 
+		NameKeyByIndex[Index] = NameKey;
 
-	GenerateStruct(&TDelegate, BasicHpp, BasicCpp, BasicHpp);
+		auto [It, bWasInserted] = ObjectIndicesByNameKey.try_emplace(NameKey);
 
-	/* TDelegate<Ret(Args...)> */
-	PredefinedStruct TDelegateSpezialiation = PredefinedStruct{
-		.CustomTemplateText = "template<typename Ret, typename... Args>",
-		.UniqueName = "TDelegate<Ret(Args...)>", .Size = PropertySizes::DelegateProperty, .Alignment = 0x1, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-	};
+		/* Every distinct FName is only decoded once */
+		if (bWasInserted)
+			NameKeysByString[Object->GetName()].push_back(NameKey);
 
-	TDelegateSpezialiation.Properties =
+		std::vector<int32>& Indices = It->second;
+
+		/* Re-indexed slots can be lower than the indices added since, or still be part of the list from before they were recycled */
+		auto InsertPos = std::lower_bound(Indices.begin(), Indices.end(), Index);
+
+		if (InsertPos == Indices.end() || *InsertPos != Index)
+			Indices.insert(InsertPos, Index);
+	}
+
+	static void Update()
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "FScriptDelegate", .Name = "BoundFunction", .Offset = 0x0, .Size = ScriptDelegateSize, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
+		const int32 NumObjects = UObject::GObjects->Num();
+
+		if (NumObjects > NumCachedObjects)
+			NameKeyByIndex.resize(NumObjects, InvalidNameKey);
+
+		for (; NumCachedObjects < NumObjects; NumCachedObjects++)
+		{
+			if (const UObject* Object = UObject::GObjects->GetByIndex(NumCachedObjects))
+				AddToIndex(Object, NumCachedObjects);
+		}
+	}
+
+	/* Re-indexes all cached indices whose object changed since they were cached. Only compares FNames, returns true if any index changed */
+	static bool Revalidate()
+	{
+		bool bAnyChanged = false;
+
+		for (int32 i = 0; i < NumCachedObjects; i++)
+		{
+			const UObject* Object = UObject::GObjects->GetByIndex(i);
+			const uint64 NameKey = Object ? GetNameKey(Object) : InvalidNameKey;
+
+			if (NameKey == NameKeyByIndex[i])
+				continue;
+
+			/* Stale entries in the list of the previous name are skipped by FindByNameKeys */
+			if (Object)
+			{
+				AddToIndex(Object, i);
+			}
+			else
+			{
+				NameKeyByIndex[i] = InvalidNameKey;
+			}
+
+			bAnyChanged = true;
 		}
-	};
 
-	GenerateStruct(&TDelegateSpezialiation, BasicHpp, BasicCpp, BasicHpp);
+		return bAnyChanged;
+	}
 
-	/* TMulticastInlineDelegate */
-	PredefinedStruct TMulticastInlineDelegate = PredefinedStruct{
-		.CustomTemplateText = "template<typename FunctionSignature>",
-		.UniqueName = "TMulticastInlineDelegate", .Size = 0x10, .Alignment = 0x8, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-	};
+	static const std::vector<uint64>* GetNameKeys(const std::string& Name)
+	{
+		auto It = NameKeysByString.find(Name);
 
-	TMulticastInlineDelegate.Properties =
+		return It != NameKeysByString.end() ? &It->second : nullptr;
+	}
+
+	static bool HasAnyNameKey(const UObject* Object, const std::vector<uint64>* NameKeys)
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "struct InvalidUseOfTMulticastInlineDelegate", .Name = "TemplateParamIsNotAFunctionSignature", .Offset = 0x0, .Size = ScriptDelegateSize, .ArrayDim = 0x1, .Alignment = 0x1,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		},
-	};
+		const uint64 ObjectNameKey = GetNameKey(Object);
 
-	GenerateStruct(&TMulticastInlineDelegate, BasicHpp, BasicCpp, BasicHpp);
+		for (uint64 Key : *NameKeys)
+		{
+			if (Key == ObjectNameKey)
+				return true;
+		}
 
-	/* TMulticastInlineDelegate<Ret(Args...)> */
-	PredefinedStruct TMulticastInlineDelegateSpezialiation = PredefinedStruct{
-		.CustomTemplateText = "template<typename Ret, typename... Args>",
-		.UniqueName = "TMulticastInlineDelegate<Ret(Args...)>", .Size = 0x0, .Alignment = 0x1, .bUseExplictAlignment = false, .bIsFinal = false, .bIsClass = true, .bIsUnion = false, .Super = nullptr
-	};
+		return false;
+	}
 
-	TMulticastInlineDelegateSpezialiation.Properties =
+	template<typename PredicateType>
+	static UObject* FindByNameKeys(const std::vector<uint64>* NameKeys, EClassCastFlags RequiredType, PredicateType Predicate)
 	{
-		PredefinedMember {
-			.Comment = "NOT AUTO-GENERATED PROPERTY",
-			.Type = "TArray<FScriptDelegate>", .Name = "InvocationList", .Offset = 0x0, .Size = 0x10, .ArrayDim = 0x1, .Alignment = 0x8,
-			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
-		}
-	};
+		for (uint64 Key : *NameKeys)
+		{
+			auto It = ObjectIndicesByNameKey.find(Key);
 
-	GenerateStruct(&TMulticastInlineDelegateSpezialiation, BasicHpp, BasicCpp, BasicHpp);
+			if (It == ObjectIndicesByNameKey.end())
+				continue;
 
+			for (int32 Index : It->second)
+			{
+				UObject* Object = UObject::GObjects->GetByIndex(Index);
 
-	/* UE_ENUM_OPERATORS - enum flag operations */
-	BasicHpp <<
-		R"(
-#define UE_ENUM_OPERATORS(EEnumClass)																																	\
-																																										\
-inline constexpr EEnumClass operator|(EEnumClass Left, EEnumClass Right)																								\
-{																																										\
-	return (EEnumClass)((std::underlying_type<EEnumClass>::type)(Left) | (std::underlying_type<EEnumClass>::type)(Right));												\
-}																																										\
-																																										\
-inline constexpr EEnumClass& operator|=(EEnumClass& Left, EEnumClass Right)																								\
-{																																										\
-	return (EEnumClass&)((std::underlying_type<EEnumClass>::type&)(Left) |= (std::underlying_type<EEnumClass>::type)(Right));											\
-}																																										\
-																																										\
-inline bool operator&(EEnumClass Left, EEnumClass Right)																												\
-{																																										\
-	return (((std::underlying_type<EEnumClass>::type)(Left) & (std::underlying_type<EEnumClass>::type)(Right)) == (std::underlying_type<EEnumClass>::type)(Right));		\
-}																																										
-)";
+				/* The index was recycled by the engine after it was cached */
+				if (!Object || GetNameKey(Object) != Key)
+					continue;
 
-	/* enum class EObjectFlags */
-	BasicHpp <<
-		R"(
-enum class EObjectFlags : int32
-{
-	NoFlags							= 0x00000000,
+				if (Object->HasTypeFlag(RequiredType) && Predicate(Object))
+					return Object;
+			}
+		}
 
-	Public							= 0x00000001,
-	Standalone						= 0x00000002,
-	MarkAsNative					= 0x00000004,
-	Transactional					= 0x00000008,
-	ClassDefaultObject				= 0x00000010,
-	ArchetypeObject					= 0x00000020,
-	Transient						= 0x00000040,
+		return nullptr;
+	}
 
-	MarkAsRootSet					= 0x00000080,
-	TagGarbageTemp					= 0x00000100,
+	static UObject* FindObjectInCache(const std::string& FullName, EClassCastFlags RequiredType)
+	{
+		const size_t ClassNameEnd = FullName.find(' ');
 
-	NeedInitialization				= 0x00000200,
-	NeedLoad						= 0x00000400,
-	KeepForCooker					= 0x00000800,
-	NeedPostLoad					= 0x00001000,
-	NeedPostLoadSubobjects			= 0x00002000,
-	NewerVersionExists				= 0x00004000,
-	BeginDestroyed					= 0x00008000,
-	FinishDestroyed					= 0x00010000,
+		if (ClassNameEnd == std::string::npos)
+			return nullptr;
 
-	BeingRegenerated				= 0x00020000,
-	DefaultSubObject				= 0x00040000,
-	WasLoaded						= 0x00080000,
-	TextExportTransient				= 0x00100000,
-	LoadCompleted					= 0x00200000,
-	InheritableComponentTemplate	= 0x00400000,
-	DuplicateTransient				= 0x00800000,
-	StrongRefOnFrame				= 0x01000000,
-	NonPIEDuplicateTransient		= 0x02000000,
-	Dynamic							= 0x04000000,
-	WillBeLoaded					= 0x08000000,
-	HasExternalPackage				= 0x10000000,
+		const size_t ObjectNameStart = FullName.rfind('.');
+		const size_t PathStart = ClassNameEnd + 1;
 
-	MirroredGarbage					= 0x40000000,
-	AllocatedInSharedPage			= 0x80000000,
-};
-)";
+		const bool bHasOuters = ObjectNameStart != std::string::npos && ObjectNameStart > ClassNameEnd;
 
+		const std::vector<uint64>* ClassNameKeys = GetNameKeys(FullName.substr(0, ClassNameEnd));
+		const std::vector<uint64>* ObjectNameKeys = GetNameKeys(FullName.substr(bHasOuters ? ObjectNameStart + 1 : PathStart));
 
-	/* enum class EFunctionFlags */
-	BasicHpp <<
-		R"(
-enum class EFunctionFlags : uint32
-{
-	None							= 0x00000000,
+		if (!ClassNameKeys || !ObjectNameKeys)
+			return nullptr;
 
-	Final							= 0x00000001,
-	RequiredAPI						= 0x00000002,
-	BlueprintAuthorityOnly			= 0x00000004, 
-	BlueprintCosmetic				= 0x00000008, 
-	Net								= 0x00000040,  
-	NetReliable						= 0x00000080, 
-	NetRequest						= 0x00000100,	
-	Exec							= 0x00000200,	
-	Native							= 0x00000400,	
-	Event							= 0x00000800,   
-	NetResponse						= 0x00001000,  
-	Static							= 0x00002000,   
-	NetMulticast					= 0x00004000,	
-	UbergraphFunction				= 0x00008000,  
-	MulticastDelegate				= 0x00010000,
-	Public							= 0x00020000,	
-	Private							= 0x00040000,	
-	Protected						= 0x00080000,
-	Delegate						= 0x00100000,	
-	NetServer						= 0x00200000,	
-	HasOutParms						= 0x00400000,	
-	HasDefaults						= 0x00800000,
-	NetClient						= 0x01000000,
-	DLLImport						= 0x02000000,
-	BlueprintCallable				= 0x04000000,
-	BlueprintEvent					= 0x08000000,
-	BlueprintPure					= 0x10000000,	
-	EditorOnly						= 0x20000000,	
-	Const							= 0x40000000,
-	NetValidate						= 0x80000000,
+		/* Name-keys of all outers, outermost first */
+		std::vector<const std::vector<uint64>*> OuterNameKeys;
 
-	AllFlags						= 0xFFFFFFFF,
-};
-)";
+		for (size_t Start = PathStart; bHasOuters && Start <= ObjectNameStart;)
+		{
+			const size_t End = FullName.find('.', Start);
 
-	/* enum class EClassFlags */
-	BasicHpp <<
-		R"(
-enum class EClassFlags : uint32
-{
-	CLASS_None						= 0x00000000u,
-	Abstract						= 0x00000001u,
-	DefaultConfig					= 0x00000002u,
-	Config							= 0x00000004u,
-	Transient						= 0x00000008u,
-	Parsed							= 0x00000010u,
-	MatchedSerializers				= 0x00000020u,
-	ProjectUserConfig				= 0x00000040u,
-	Native							= 0x00000080u,
-	NoExport						= 0x00000100u,
-	NotPlaceable					= 0x00000200u,
-	PerObjectConfig					= 0x00000400u,
-	ReplicationDataIsSetUp			= 0x00000800u,
-	EditInlineNew					= 0x00001000u,
-	CollapseCategories				= 0x00002000u,
-	Interface						= 0x00004000u,
-	CustomConstructor				= 0x00008000u,
-	Const							= 0x00010000u,
-	LayoutChanging					= 0x00020000u,
-	CompiledFromBlueprint			= 0x00040000u,
-	MinimalAPI						= 0x00080000u,
-	RequiredAPI						= 0x00100000u,
-	DefaultToInstanced				= 0x00200000u,
-	TokenStreamAssembled			= 0x00400000u,
-	HasInstancedReference			= 0x00800000u,
-	Hidden							= 0x01000000u,
-	Deprecated						= 0x02000000u,
-	HideDropDown					= 0x04000000u,
-	GlobalUserConfig				= 0x08000000u,
-	Intrinsic						= 0x10000000u,
-	Constructed						= 0x20000000u,
-	ConfigDoNotCheckDefaults		= 0x40000000u,
-	NewerVersionExists				= 0x80000000u,
-};
-)";
+			const std::vector<uint64>* NameKeys = GetNameKeys(FullName.substr(Start, End - Start));
 
-	/* enum class EClassCastFlags */
-	BasicHpp <<
-		R"(
-enum class EClassCastFlags : uint64
-{
-	None = 0x0000000000000000,
+			if (!NameKeys)
+				return nullptr;
 
-	Field								= 0x0000000000000001,
-	Int8Property						= 0x0000000000000002,
-	Enum								= 0x0000000000000004,
-	Struct								= 0x0000000000000008,
-	ScriptStruct						= 0x0000000000000010,
-	Class								= 0x0000000000000020,
-	ByteProperty						= 0x0000000000000040,
-	IntProperty							= 0x0000000000000080,
-	FloatProperty						= 0x0000000000000100,
-	UInt64Property						= 0x0000000000000200,
-	ClassProperty						= 0x0000000000000400,
-	UInt32Property						= 0x0000000000000800,
-	InterfaceProperty					= 0x0000000000001000,
-	NameProperty						= 0x0000000000002000,
-	StrProperty							= 0x0000000000004000,
-	Property							= 0x0000000000008000,
-	ObjectProperty						= 0x0000000000010000,
-	BoolProperty						= 0x0000000000020000,
-	UInt16Property						= 0x0000000000040000,
-	Function							= 0x0000000000080000,
-	StructProperty						= 0x0000000000100000,
-	ArrayProperty						= 0x0000000000200000,
-	Int64Property						= 0x0000000000400000,
-	DelegateProperty					= 0x0000000000800000,
-	NumericProperty						= 0x0000000001000000,
-	MulticastDelegateProperty			= 0x0000000002000000,
-	ObjectPropertyBase					= 0x0000000004000000,
-	WeakObjectProperty					= 0x0000000008000000,
-	LazyObjectProperty					= 0x0000000010000000,
-	SoftObjectProperty					= 0x0000000020000000,
-	TextProperty						= 0x0000000040000000,
-	Int16Property						= 0x0000000080000000,
-	DoubleProperty						= 0x0000000100000000,
-	SoftClassProperty					= 0x0000000200000000,
-	Package								= 0x0000000400000000,
-	Level								= 0x0000000800000000,
-	Actor								= 0x0000001000000000,
-	PlayerController					= 0x0000002000000000,
-	Pawn								= 0x0000004000000000,
-	SceneComponent						= 0x0000008000000000,
-	PrimitiveComponent					= 0x0000010000000000,
-	SkinnedMeshComponent				= 0x0000020000000000,
-	SkeletalMeshComponent				= 0x0000040000000000,
-	Blueprint							= 0x0000080000000000,
-	DelegateFunction					= 0x0000100000000000,
-	StaticMeshComponent					= 0x0000200000000000,
-	MapProperty							= 0x0000400000000000,
-	SetProperty							= 0x0000800000000000,
-	EnumProperty						= 0x0001000000000000,
-	USparseDelegateFunction				= 0x0002000000000000,
-	MulticastInlineDelegateProperty	    = 0x0004000000000000,
-	MulticastSparseDelegateProperty	    = 0x0008000000000000,
-	FieldPathProperty					= 0x0010000000000000,
-	LargeWorldCoordinatesRealProperty	= 0x0080000000000000,
-	OptionalProperty					= 0x0100000000000000,
-	VValueProperty						= 0x0200000000000000,
-	UVerseVMClass						= 0x0400000000000000,
-	VRestValueProperty					= 0x0800000000000000,
-};
-)";
+			OuterNameKeys.push_back(NameKeys);
+			Start = End + 1;
+		}
+
+		return FindByNameKeys(ObjectNameKeys, RequiredType, [&](const UObject* Object) -> bool
+		{
+			if (!Object->Class || !HasAnyNameKey(Object->Class, ClassNameKeys))
+				return false;
+
+			const UObject* Outer = Object->Outer;
 
-	/* enum class EPropertyFlags */
-	BasicHpp <<
-		R"(
-enum class EPropertyFlags : uint64
+			for (auto It = OuterNameKeys.rbegin(); It != OuterNameKeys.rend(); ++It, Outer = Outer->Outer)
+			{
+				if (!Outer || !HasAnyNameKey(Outer, *It))
+					return false;
+			}
+
+			return Outer == nullptr;
+		});
+	}
+
+	static UObject* FindObjectFastInCache(const std::string& Name, EClassCastFlags RequiredType)
+	{
+		const std::vector<uint64>* NameKeys = GetNameKeys(Name);
+
+		if (!NameKeys)
+			return nullptr;
+
+		return FindByNameKeys(NameKeys, RequiredType, [](const UObject* Object) -> bool { return true; });
+	}
+}
+
+class UObject* ObjectLookupCache::FindObject(const std::string& FullName, EClassCastFlags RequiredType)
 {
-	None								= 0x0000000000000000,
+	std::scoped_lock Lock(CacheMutex);
 
-	Edit								= 0x0000000000000001,
-	ConstParm							= 0x0000000000000002,
-	BlueprintVisible					= 0x0000000000000004,
-	ExportObject						= 0x0000000000000008,
-	BlueprintReadOnly					= 0x0000000000000010,
-	Net									= 0x0000000000000020,
-	EditFixedSize						= 0x0000000000000040,
-	Parm								= 0x0000000000000080,
-	OutParm								= 0x0000000000000100,
-	ZeroConstructor						= 0x0000000000000200,
-	ReturnParm							= 0x0000000000000400,
-	DisableEditOnTemplate 				= 0x0000000000000800,
+	Update();
 
-	Transient							= 0x0000000000002000,
-	Config								= 0x0000000000004000,
+	if (UObject* Object = FindObjectInCache(FullName, RequiredType))
+		return Object;
 
-	DisableEditOnInstance				= 0x0000000000010000,
-	EditConst							= 0x0000000000020000,
-	GlobalConfig						= 0x0000000000040000,
-	InstancedReference					= 0x0000000000080000,	
+	/* The object might have been created at an index that was recycled after it was cached */
+	return Revalidate() ? FindObjectInCache(FullName, RequiredType) : nullptr;
+}
 
-	DuplicateTransient					= 0x0000000000200000,	
-	SubobjectReference					= 0x0000000000400000,	
+class UObject* ObjectLookupCache::FindObjectFast(const std::string& Name, EClassCastFlags RequiredType)
+{
+	std::scoped_lock Lock(CacheMutex);
 
-	SaveGame							= 0x0000000001000000,
-	NoClear								= 0x0000000002000000,
+	Update();
 
-	ReferenceParm						= 0x0000000008000000,
-	BlueprintAssignable					= 0x0000000010000000,
-	Deprecated							= 0x0000000020000000,
-	IsPlainOldData						= 0x0000000040000000,
-	RepSkip								= 0x0000000080000000,
-	RepNotify							= 0x0000000100000000, 
-	Interp								= 0x0000000200000000,
-	NonTransactional					= 0x0000000400000000,
-	EditorOnly							= 0x0000000800000000,
-	NoDestructor						= 0x0000001000000000,
+	if (UObject* Object = FindObjectFastInCache(Name, RequiredType))
+		return Object;
+
+	/* The object might have been created at an index that was recycled after it was cached */
+	return Revalidate() ? FindObjectFastInCache(Name, RequiredType) : nullptr;
+}
+
+void ObjectLookupCache::Reset()
+{
+	std::scoped_lock Lock(CacheMutex);
+
+	NameKeysByString.clear();
+	ObjectIndicesByNameKey.clear();
+	NameKeyByIndex.clear();
+	NumCachedObjects = 0;
+}
 
-	AutoWeak							= 0x0000004000000000,
-	ContainsInstancedReference			= 0x0000008000000000,	
-	AssetRegistrySearchable				= 0x0000010000000000,
-	SimpleDisplay						= 0x0000020000000000,
-	AdvancedDisplay						= 0x0000040000000000,
-	Protected							= 0x0000080000000000,
-	BlueprintCallable					= 0x0000100000000000,
-	BlueprintAuthorityOnly				= 0x0000200000000000,
-	TextExportTransient					= 0x0000400000000000,
-	NonPIEDuplicateTransient			= 0x0000800000000000,
-	ExposeOnSpawn						= 0x0001000000000000,
-	PersistentInstance					= 0x0002000000000000,
-	UObjectWrapper						= 0x0004000000000000, 
-	HasGetValueTypeHash					= 0x0008000000000000, 
-	NativeAccessSpecifierPublic			= 0x0010000000000000,	
-	NativeAccessSpecifierProtected		= 0x0020000000000000,
-	NativeAccessSpecifierPrivate		= 0x0040000000000000,	
-	SkipSerialization					= 0x0080000000000000, 
-};
 )";
 
-	/* enum class EClassCastFlags */
+
+	/* ClassHierarchyIndex */
 	BasicHpp << R"(
-UE_ENUM_OPERATORS(EObjectFlags);
-UE_ENUM_OPERATORS(EFunctionFlags);
-UE_ENUM_OPERATORS(EClassFlags);
-UE_ENUM_OPERATORS(EClassCastFlags);
-UE_ENUM_OPERATORS(EPropertyFlags);
+/*
+* Pre-order numbering of the class-tree. Every class is assigned the interval [First, Last] covering the numbers of all of its subclasses,
+* such that checking for a base-class only takes two integer compares.
+*
+* The index is rebuilt when a class that is not part of it yet is queried. Non-class structs fall back to walking the Super-chain.
+*/
+namespace ClassHierarchyIndex
+{
+	bool IsSubclassOf(const class UStruct* Struct, const class UStruct* Base);
+
+	void Rebuild();
+}
+)";
+
+	BasicCpp << R"(
+namespace ClassHierarchyIndex
+{
+	struct FClassInterval
+	{
+		/* Class and Super at the time the index was built, used to detect object-indices recycled by the engine */
+		const UStruct* Class = nullptr;
+		const UStruct* Super = nullptr;
+
+		int32 First = -1;
+		int32 Last = -1;
+	};
+
+	static std::shared_mutex IndexMutex;
+
+	static std::vector<FClassInterval> IntervalsByObjectIndex;
+
+	static int32 NumObjectsAtLastBuild = -1;
+
+	static const FClassInterval* GetInterval(const UStruct* Struct)
+	{
+		if (Struct->Index < 0 || Struct->Index >= static_cast<int32>(IntervalsByObjectIndex.size()))
+			return nullptr;
+
+		const FClassInterval& Interval = IntervalsByObjectIndex[Struct->Index];
+
+		if (Interval.Class != Struct || Interval.Super != Struct->Super || Interval.First == -1)
+			return nullptr;
+
+		return &Interval;
+	}
+
+	static void BuildUnlocked()
+	{
+		const int32 NumObjects = UObject::GObjects->Num();
+
+		IntervalsByObjectIndex.assign(NumObjects, FClassInterval{});
+
+		std::unordered_map<const UStruct*, std::vector<const UStruct*>> SubclassesBySuper;
+		std::vector<const UStruct*> RootClasses;
+
+		for (int32 i = 0; i < NumObjects; i++)
+		{
+			UObject* Object = UObject::GObjects->GetByIndex(i);
+
+			if (!Object || !Object->HasTypeFlag(EClassCastFlags::Class))
+				continue;
+
+			const UStruct* Class = static_cast<const UStruct*>(Object);
+
+			if (Class->Super)
+			{
+				SubclassesBySuper[Class->Super].push_back(Class);
+			}
+			else
+			{
+				RootClasses.push_back(Class);
+			}
+		}
+
+		int32 CurrentNumber = 0;
+
+		/* Iterative depth-first traversal, the class-tree can be too deep to recurse safely in some games */
+		std::vector<std::pair<const UStruct*, size_t /* NextSubclassIdx */>> Stack;
+
+		auto Enter = [&](const UStruct* Class) -> void
+		{
+			IntervalsByObjectIndex[Class->Index] = FClassInterval{ Class, Class->Super, CurrentNumber++, -1 };
+			Stack.emplace_back(Class, 0);
+		};
+
+		for (const UStruct* Root : RootClasses)
+		{
+			Enter(Root);
+
+			while (!Stack.empty())
+			{
+				auto& [Class, NextSubclassIdx] = Stack.back();
+
+				auto It = SubclassesBySuper.find(Class);
+
+				if (It != SubclassesBySuper.end() && NextSubclassIdx < It->second.size())
+				{
+					Enter(It->second[NextSubclassIdx++]);
+					continue;
+				}
+
+				IntervalsByObjectIndex[Class->Index].Last = CurrentNumber - 1;
+				Stack.pop_back();
+			}
+		}
+
+		NumObjectsAtLastBuild = NumObjects;
+	}
+
+	/* Returns 1 if 'Struct' is a subclass of 'Base', 0 if it isn't, and -1 if 'Struct' is not part of the index */
+	static int32 IsSubclassOfIndexed(const UStruct* Struct, const UStruct* Base)
+	{
+		const FClassInterval* StructInterval = GetInterval(Struct);
+
+		if (!StructInterval)
+			return -1;
+
+		/* Every base of an indexed class is part of the index, as the Super-chain of a class never changes */
+		const FClassInterval* BaseInterval = GetInterval(Base);
+
+		if (!BaseInterval)
+			return 0;
+
+		return BaseInterval->First <= StructInterval->First && StructInterval->First <= BaseInterval->Last;
+	}
+}
+
+bool ClassHierarchyIndex::IsSubclassOf(const UStruct* Struct, const UStruct* Base)
+{
+	if (!Struct || !Base)
+		return false;
+
+	{
+		std::shared_lock Lock(IndexMutex);
+
+		const int32 Result = IsSubclassOfIndexed(Struct, Base);
+
+		if (Result != -1)
+			return Result;
+	}
+
+	if (Struct->HasTypeFlag(EClassCastFlags::Class))
+	{
+		std::unique_lock Lock(IndexMutex);
+
+		/* Only rebuild if GObjects changed, classes placed in recycled object-indices are checked through their Super-chain instead */
+		if (NumObjectsAtLastBuild != UObject::GObjects->Num())
+			BuildUnlocked();
+
+		const int32 Result = IsSubclassOfIndexed(Struct, Base);
+
+		if (Result != -1)
+			return Result;
+	}
+
+	for (const UStruct* Current = Struct; Current; Current = Current->Super)
+	{
+		if (Current == Base)
+			return true;
+	}
+
+	return false;
+}
+
+void ClassHierarchyIndex::Rebuild()
+{
+	std::unique_lock Lock(IndexMutex);
+
+	BuildUnlocked();
+}
+
 )";
 
 
@@ -5077,7 +7224,7 @@ using TActorBasedCycleFixup = CyclicDependencyFixupImpl::TCyclicClassFixup<Under
 void CppGenerator::GenerateUnrealContainers(StreamType& UEContainersHeader)
 {
 	WriteFileHead(UEContainersHeader, nullptr, EFileType::UnrealContainers, 
-		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <stdexcept>\n#include <iostream>\n#include \"UtfN.hpp\"");
+		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <stdexcept>\n#include <iostream>\n#include <type_traits>\n#include \"UtfN.hpp\"");
 
 
 	UEContainersHeader << R"(
@@ -5151,6 +7298,92 @@ namespace UC
 
 				return 31 - FloorLog2(Value);
 			}
+
+			/* Hash functions matching the ones of the engine, see 'Templates/TypeHash.h' and 'Misc/Crc.h' */
+			inline uint32 HashCombine(uint32 A, uint32 C)
+			{
+				uint32 B = 0x9e3779b9;
+				A += B;
+
+				A -= B; A -= C; A ^= (C >> 13);
+				B -= C; B -= A; B ^= (A << 8);
+				C -= A; C -= B; C ^= (B >> 13);
+				A -= B; A -= C; A ^= (C >> 12);
+				B -= C; B -= A; B ^= (A << 16);
+				C -= A; C -= B; C ^= (B >> 5);
+				A -= B; A -= C; A ^= (C >> 3);
+				B -= C; B -= A; B ^= (A << 10);
+				C -= A; C -= B; C ^= (B >> 15);
+
+				return C;
+			}
+
+			inline uint32 MurmurFinalize32(uint32 Hash)
+			{
+				Hash ^= Hash >> 16;
+				Hash *= 0x85ebca6b;
+				Hash ^= Hash >> 13;
+				Hash *= 0xc2b2ae35;
+				Hash ^= Hash >> 16;
+
+				return Hash;
+			}
+
+			inline uint32 PointerHash(const void* Key)
+			{
+				/* The lower 4 bits are ignored by the engine, as they are likely zero anyway */
+				const uint64 PtrInt = reinterpret_cast<uint64>(Key) >> 4;
+)";
+
+	/* UE5 replaced the HashCombine in 'PointerHash' with MurmurFinalize32 */
+	UEContainersHeader << (Settings::Internal::bIsUE5OrHigher ? R"(
+				return MurmurFinalize32(static_cast<uint32>(PtrInt));)" : R"(
+				return HashCombine(static_cast<uint32>(PtrInt), 0);)");
+
+	UEContainersHeader << R"(
+			}
+
+			struct FCrc32Table
+			{
+				uint32 Table[256];
+
+				constexpr FCrc32Table()
+					: Table{}
+				{
+					for (uint32 i = 0; i < 256; i++)
+					{
+						/* CRCTable_DEPRECATED is not reflected, it's the MSB-first table of the polynomial 0x04C11DB7 */
+						uint32 Crc = i << 24;
+
+						for (int32 j = 0; j < 8; j++)
+							Crc = (Crc & 0x80000000) ? ((Crc << 1) ^ 0x04C11DB7) : (Crc << 1);
+
+						Table[i] = Crc;
+					}
+				}
+			};
+
+			inline constexpr FCrc32Table Crc32Table = FCrc32Table();
+
+			/* Case-insensitive hash used by the engine for FString keys (FCrc::Strihash_DEPRECATED) */
+			inline uint32 StriHash(const wchar_t* Data)
+			{
+				uint32 Hash = 0;
+
+				while (*Data)
+				{
+					const wchar_t Char = (*Data >= L'a' && *Data <= L'z') ? (*Data - (L'a' - L'A')) : *Data;
+					Data++;
+
+					uint16 Byte = static_cast<uint16>(Char);
+					Hash = ((Hash >> 8) & 0x00FFFFFF) ^ Crc32Table.Table[(Hash ^ Byte) & 0x000000FF];
+
+					Byte = static_cast<uint16>(Char) >> 8;
+					Hash = ((Hash >> 8) & 0x00FFFFFF) ^ Crc32Table.Table[(Hash ^ Byte) & 0x000000FF];
+				}
+
+				return Hash;
+			}
 		}
 
 		template<int32 Size, uint32 Alignment>
@@ -5263,7 +7496,7 @@ namespace UC
 		{
 		private:
 			template<typename SetDataType>
-			friend class TSet;
+			friend class UC::TSet;
 
 		private:
 			SetType Value;
@@ -5273,6 +7506,30 @@ namespace UC
 	}
 
 
+	/*
+	* Equivalents of the engine's 'GetTypeHash' functions, used by TSet and TMap to follow the hash-buckets of the engine.
+	*
+	* Custom key-types can be supported by adding a 'GetTypeHash' overload to the namespace of the type.
+	*/
+	inline uint32 GetTypeHash(const int8   Value) { return Value; }
+	inline uint32 GetTypeHash(const uint8  Value) { return Value; }
+	inline uint32 GetTypeHash(const int16  Value) { return Value; }
+	inline uint32 GetTypeHash(const uint16 Value) { return Value; }
+	inline uint32 GetTypeHash(const int32  Value) { return Value; }
+	inline uint32 GetTypeHash(const uint32 Value) { return Value; }
+	inline uint32 GetTypeHash(const int64  Value) { return static_cast<uint32>(Value) + (static_cast<uint32>(Value >> 32) * 23); }
+	inline uint32 GetTypeHash(const uint64 Value) { return static_cast<uint32>(Value) + (static_cast<uint32>(Value >> 32) * 23); }
+
+	inline uint32 GetTypeHash(const float  Value) { return *reinterpret_cast<const uint32*>(&Value); }
+	inline uint32 GetTypeHash(const double Value) { return GetTypeHash(*reinterpret_cast<const uint64*>(&Value)); }
+
+	template<typename EnumType, typename = std::enable_if_t<std::is_enum_v<EnumType>>>
+	inline uint32 GetTypeHash(const EnumType Value) { return GetTypeHash(static_cast<std::underlying_type_t<EnumType>>(Value)); }
+
+	template<typename PointerType>
+	inline uint32 GetTypeHash(const PointerType* Value) { return ContainerImpl::HelperFunctions::PointerHash(Value); }
+
+
 	template <typename KeyType, typename ValueType>
 	class TPair
 	{
@@ -5506,7 +7763,9 @@ namespace UC
 	public:
 		inline operator       FString()       { return *reinterpret_cast<      FString*>(this); }
 		inline operator const FString() const { return *reinterpret_cast<const FString*>(this); }
-	};)";
+	};
+
+	inline uint32 GetTypeHash(const FString& Str) { return Str ? ContainerImpl::HelperFunctions::StriHash(Str.CStr()) : 0; })";
 
 	UEContainersHeader << R"(
 	template<typename SparseArrayElementType>
@@ -5556,7 +7815,7 @@ namespace UC
 
 	public:
 		inline       SparseArrayElementType& operator[](int32 Index)       { VerifyIndex(Index); return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
-		inline const SparseArrayElementType& operator[](int32 Index) const { VerifyIndex(Index); return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
+		inline const SparseArrayElementType& operator[](int32 Index) const { VerifyIndex(Index); return *reinterpret_cast<const SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
 
 		inline bool operator==(const TSparseArray<SparseArrayElementType>& Other) const { return Data == Other.Data; }
 		inline bool operator!=(const TSparseArray<SparseArrayElementType>& Other) const { return Data != Other.Data; }
@@ -5577,6 +7836,10 @@ namespace UC
 		using SetDataType = ContainerImpl::SetElement<SetElementType>;
 		using HashType = ContainerImpl::TInlineAllocator<1>::ForElementType<int32>;
 
+	private:
+		template<typename KeyElementType, typename ValueElementType>
+		friend class TMap;
+
 	private:
 		TSparseArray<SetDataType> Elements;
 		HashType Hash;
@@ -5598,6 +7861,54 @@ namespace UC
 	private:
 		inline void VerifyIndex(int32 Index) const { if (!IsValidIndex(Index)) throw std::out_of_range("Index was out of range!"); }
 
+		/* Follows the hash-chain of the bucket 'Key' belongs to, the same way the engine does. Returns the index of the element, or -1 if there is none. */
+		template<typename KeyType, typename GetKeyFuncType>
+		inline int32 FindIndexByKey(const KeyType& Key, GetKeyFuncType GetKey) const
+		{
+			if (Num() <= 0 || HashSize <= 0)
+				return -1;
+
+			const int32* Buckets = Hash.GetAllocation();
+
+			for (int32 Index = Buckets[GetTypeHash(Key) & (HashSize - 1)]; IsValidIndex(Index); Index = Elements[Index].HashNextId)
+			{
+				if (GetKey(Elements[Index].Value) == Key)
+					return Index;
+			}
+
+			/* Compare the buckets of a few elements against the ones stored by the engine, to check if 'GetTypeHash' matches the engine's hash-function for this key-type */
+			constexpr int32 MaxNumElementsToVerify = 0x4;
+
+			bool bIsHashFunctionMatching = true;
+
+			for (int32 Index = 0, NumVerified = 0; Index < NumAllocated() && NumVerified < MaxNumElementsToVerify; Index++)
+			{
+				if (!IsValidIndex(Index))
+					continue;
+
+				if ((GetTypeHash(GetKey(Elements[Index].Value)) & (HashSize - 1)) != Elements[Index].HashIndex)
+				{
+					bIsHashFunctionMatching = false;
+					break;
+				}
+
+				NumVerified++;
+			}
+
+			/* The key is not part of the set */
+			if (bIsHashFunctionMatching)
+				return -1;
+
+			/* The hash-function differs from the one the engine uses for this key-type, fall back to comparing every element */
+			for (int32 Index = 0; Index < NumAllocated(); Index++)
+			{
+				if (IsValidIndex(Index) && GetKey(Elements[Index].Value) == Key)
+					return Index;
+			}
+
+			return -1;
+		}
+
 	public:
 		inline int32 NumAllocated() const { return Elements.NumAllocated(); }
 
@@ -5611,6 +7922,14 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		inline int32 FindIndex(const SetElementType& Element) const { return FindIndexByKey(Element, [](const SetElementType& Value) -> const SetElementType& { return Value; }); }
+
+		inline       SetElementType* Find(const SetElementType& Element)       { const int32 Index = FindIndex(Element); return Index != -1 ? &Elements[Index].Value : nullptr; }
+		inline const SetElementType* Find(const SetElementType& Element) const { const int32 Index = FindIndex(Element); return Index != -1 ? &Elements[Index].Value : nullptr; }
+
+		inline bool Contains(const SetElementType& Element) const { return FindIndex(Element) != -1; }
+
 	public:
 		inline       SetElementType& operator[] (int32 Index)       { return Elements[Index].Value; }
 		inline const SetElementType& operator[] (int32 Index) const { return Elements[Index].Value; }
@@ -5649,6 +7968,16 @@ namespace UC
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
 	public:
+		inline int32 FindIndex(const KeyElementType& Key) const { return Elements.FindIndexByKey(Key, [](const ElementType& Pair) -> const KeyElementType& { return Pair.Key(); }); }
+
+		inline       ValueElementType* Find(const KeyElementType& Key)       { const int32 Index = FindIndex(Key); return Index != -1 ? &Elements[Index].Value() : nullptr; }
+		inline const ValueElementType* Find(const KeyElementType& Key) const { const int32 Index = FindIndex(Key); return Index != -1 ? &Elements[Index].Value() : nullptr; }
+
+		inline ValueElementType FindRef(const KeyElementType& Key) const { const ValueElementType* Value = Find(Key); return Value ? *Value : ValueElementType(); }
+
+		inline bool Contains(const KeyElementType& Key) const { return FindIndex(Key) != -1; }
+
+		/* Linear search, for key-types without a 'GetTypeHash' overload */
 		inline decltype(auto) Find(const KeyElementType& Key, bool(*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey))
 		{
 			for (auto It = begin(*this); It != end(*this); ++It)
@@ -1,6 +1,9 @@
 
 #include "Generators/DumpspaceGenerator.h"
 
+#include "../Settings.h"
+#include "Utils.h"
+
 std::string DumpspaceGenerator::GetStructPrefixedName(const StructWrapper& Struct)
 {
 	if (Struct.IsFunction())
@@ -53,13 +56,20 @@ DSGen::EType DumpspaceGenerator::GetMemberEType(const PropertyWrapper& Property)
 
 DSGen::EType DumpspaceGenerator::GetMemberEType(UEProperty Prop)
 {
-	if (Prop.IsA(EClassCastFlags::EnumProperty))
+	return GetMemberEType(TypeManager::GetInfo(Prop));
+}
+
+DSGen::EType DumpspaceGenerator::GetMemberEType(TypeInfoHandle Type)
+{
+	const EClassCastFlags Flags = Type.GetCastFlags();
+
+	if (Flags & EClassCastFlags::EnumProperty)
 	{
 		return DSGen::ET_Enum;
 	}
-	else if (Prop.IsA(EClassCastFlags::ByteProperty))
+	else if (Flags & EClassCastFlags::ByteProperty)
 	{
-		if (Prop.Cast<UEByteProperty>().GetEnum())
+		if (Type.GetReferencedIndex() != -1)
 			return DSGen::ET_Enum;
 	}
 	//else if (Prop.IsA(EClassCastFlags::ClassProperty))
@@ -68,15 +78,15 @@ DSGen::EType DumpspaceGenerator::GetMemberEType(UEProperty Prop)
 	//	if (!Prop.Cast<UEClassProperty>().HasPropertyFlags(EPropertyFlags::UObjectWrapper))
 	//		return DSGen::ET_Class; 
 	//}
-	else if (Prop.IsA(EClassCastFlags::ObjectProperty))
+	else if (Flags & EClassCastFlags::ObjectProperty)
 	{
 		return DSGen::ET_Class;
 	}
-	else if (Prop.IsA(EClassCastFlags::StructProperty))
+	else if (Flags & EClassCastFlags::StructProperty)
 	{
 		return DSGen::ET_Struct;
 	}
-	else if (Prop.IsType(EClassCastFlags::ArrayProperty | EClassCastFlags::MapProperty | EClassCastFlags::SetProperty))
+	else if ((Flags & EClassCastFlags::ArrayProperty) || (Flags & EClassCastFlags::MapProperty) || (Flags & EClassCastFlags::SetProperty))
 	{
 		return DSGen::ET_Class;
 	}
@@ -84,17 +94,13 @@ DSGen::EType DumpspaceGenerator::GetMemberEType(UEProperty Prop)
 	return DSGen::ET_Default;
 }
 
-std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::string& OutExtendedType, std::vector<DSGen::MemberType>& OutSubtypes)
+std::string DumpspaceGenerator::GetMemberTypeStr(TypeInfoHandle Type, std::string& OutExtendedType, std::vector<DSGen::MemberType>& OutSubtypes)
 {
-	UEProperty Member = Property;
-
-	auto [Class, FieldClass] = Member.GetClass();
-
-	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+	const EClassCastFlags Flags = Type.GetCastFlags();
 
 	if (Flags & EClassCastFlags::ByteProperty)
 	{
-		if (UEEnum Enum = Member.Cast<UEByteProperty>().GetEnum())
+		if (UEEnum Enum = Type.GetReferencedObject<UEEnum>())
 			return GetEnumPrefixedName(Enum);
 
 		return "uint8";
@@ -137,9 +143,9 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	}
 	else if (Flags & EClassCastFlags::ClassProperty)
 	{
-		if (Member.HasPropertyFlags(EPropertyFlags::UObjectWrapper))
+		if (Type.HasTypeModifier())
 		{
-			OutSubtypes.emplace_back(GetMemberType(Member.Cast<UEClassProperty>().GetMetaClass()));
+			OutSubtypes.emplace_back(GetMemberType(Type.GetReferencedObject<UEClass>()));
 
 			return "TSubclassOf";
 		}
@@ -162,23 +168,23 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	}
 	else if (Flags & EClassCastFlags::BoolProperty)
 	{
-		return Member.Cast<UEBoolProperty>().IsNativeBool() ? "bool" : "uint8";
+		return Type.HasTypeModifier() ? "bool" : "uint8";
 	}
 	else if (Flags & EClassCastFlags::StructProperty)
 	{
-		const StructWrapper& UnderlayingStruct = Member.Cast<UEStructProperty>().GetUnderlayingStruct();
+		const StructWrapper& UnderlayingStruct = Type.GetReferencedObject<UEStruct>();
 
 		return GetStructPrefixedName(UnderlayingStruct);
 	}
 	else if (Flags & EClassCastFlags::ArrayProperty)
 	{
-		OutSubtypes.push_back(GetMemberType(Member.Cast<UEArrayProperty>().GetInnerProperty()));
+		OutSubtypes.push_back(GetMemberType(Type.GetInnerType()));
 
 		return "TArray";
 	}
 	else if (Flags & EClassCastFlags::WeakObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UEWeakObjectProperty>().GetPropertyClass()) 
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
 		}
@@ -191,7 +197,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	}
 	else if (Flags & EClassCastFlags::LazyObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UELazyObjectProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
 		}
@@ -204,7 +210,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	}
 	else if (Flags & EClassCastFlags::SoftClassProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UESoftClassProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
 		}
@@ -217,7 +223,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	}
 	else if (Flags & EClassCastFlags::SoftObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UESoftObjectProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
 		}
@@ -232,36 +238,34 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	{
 		OutExtendedType = "*";
 
-		if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 			return GetStructPrefixedName(PropertyClass);
 		
 		return "UObject";
 	}
 	else if (Flags & EClassCastFlags::MapProperty)
 	{
-		UEMapProperty MemberAsMapProperty = Member.Cast<UEMapProperty>();
-
-		OutSubtypes.emplace_back(GetMemberType(Member.Cast<UEMapProperty>().GetKeyProperty()));
-		OutSubtypes.emplace_back(GetMemberType(Member.Cast<UEMapProperty>().GetValueProperty()));
+		OutSubtypes.emplace_back(GetMemberType(Type.GetInnerType(0)));
+		OutSubtypes.emplace_back(GetMemberType(Type.GetInnerType(1)));
 
 		return "TMap";
 	}
 	else if (Flags & EClassCastFlags::SetProperty)
 	{
-		OutSubtypes.emplace_back(GetMemberType(Member.Cast<UESetProperty>().GetElementProperty()));
+		OutSubtypes.emplace_back(GetMemberType(Type.GetInnerType()));
 
 		return "TSet";
 	}
 	else if (Flags & EClassCastFlags::EnumProperty)
 	{
-		if (UEEnum Enum = Member.Cast<UEEnumProperty>().GetEnum())
+		if (UEEnum Enum = Type.GetReferencedObject<UEEnum>())
 			return GetEnumPrefixedName(Enum);
 
 		return "NamelessEnumIGuessIdkWhatToPutHereWithRegardsTheGuyFromDumper7";
 	}
 	else if (Flags & EClassCastFlags::InterfaceProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UEInterfaceProperty>().GetPropertyClass())
+		if (UEClass PropertyClass = Type.GetReferencedObject<UEClass>())
 		{
 			OutSubtypes.push_back(GetMemberType(PropertyClass));
 		}
@@ -274,7 +278,7 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	}
 	else if (Flags & EClassCastFlags::FieldPathProperty)
 	{
-		if (UEFFieldClass PropertyClass = Member.Cast<UEFieldPathProperty>().GetFielClass())
+		if (UEFFieldClass PropertyClass = UEFFieldClass(const_cast<void*>(Type.GetReferencedFieldClassAddress())))
 		{
 			OutSubtypes.push_back(ManualCreateMemberType(DSGen::ET_Struct, PropertyClass.GetCppName()));
 		}
@@ -287,16 +291,14 @@ std::string DumpspaceGenerator::GetMemberTypeStr(UEProperty Property, std::strin
 	}
 	else if (Flags & EClassCastFlags::OptionalProperty)
 	{
-		UEProperty ValueProperty = Member.Cast<UEOptionalProperty>().GetValueProperty();
-
-		OutSubtypes.push_back(GetMemberType(ValueProperty));
+		OutSubtypes.push_back(GetMemberType(Type.GetInnerType()));
 
 		return "TOptional";
 	}
 	else
 	{
 		/* When changing this also change 'GetUnknownProperties()' */
-		return (Class ? Class.GetCppName() : FieldClass.GetCppName()) + "_";
+		return Type.GetPropertyClassCppName() + "_";
 	}
 }
 
@@ -321,22 +323,34 @@ DSGen::MemberType DumpspaceGenerator::GetMemberType(const PropertyWrapper& Prope
 		return Type;
 	}
 
-	Type.reference = bIsReference;
-	Type.type = GetMemberEType(Property);
-	Type.typeName = GetMemberTypeStr(Property.GetUnrealProperty(), Type.extendedType, Type.subTypes);
-
-	return Type;
+	return GetMemberType(Property.GetUnrealProperty(), bIsReference);
 }
 
 DSGen::MemberType DumpspaceGenerator::GetMemberType(UEProperty Property, bool bIsReference)
 {
-	DSGen::MemberType Type;
+	return GetMemberType(TypeManager::GetInfo(Property), bIsReference);
+}
 
-	Type.reference = bIsReference;
-	Type.type = GetMemberEType(Property);
-	Type.typeName = GetMemberTypeStr(Property, Type.extendedType, Type.subTypes);
+DSGen::MemberType DumpspaceGenerator::GetMemberType(TypeInfoHandle Type, bool bIsReference)
+{
+	if (CachedMemberTypes.size() < TypeManager::GetNumTypes())
+		CachedMemberTypes.resize(TypeManager::GetNumTypes());
 
-	return Type;
+	/* Every generated type has a non-empty typeName, so an empty one marks a type that wasn't cached yet */
+	if (CachedMemberTypes[Type.GetIndex()].typeName.empty())
+	{
+		DSGen::MemberType NewType;
+		NewType.type = GetMemberEType(Type);
+		NewType.typeName = GetMemberTypeStr(Type, NewType.extendedType, NewType.subTypes);
+
+		/* Don't hold a reference into the cache, generating the subtypes can add new entries to it */
+		CachedMemberTypes[Type.GetIndex()] = std::move(NewType);
+	}
+
+	DSGen::MemberType RetType = CachedMemberTypes[Type.GetIndex()];
+	RetType.reference = bIsReference;
+
+	return RetType;
 }
 
 DSGen::MemberType DumpspaceGenerator::ManualCreateMemberType(DSGen::EType Type, const std::string& TypeName, const std::string& ExtendedType)
@@ -450,55 +464,85 @@ void DumpspaceGenerator::GeneratedStaticOffsets()
 	DSGen::addOffset(Off::InSDK::Name::bIsUsingAppendStringOverToString ? "OFFSET_APPENDSTRING" : "OFFSET_TOSTRING", Off::InSDK::Name::AppendNameToString);
 	DSGen::addOffset("OFFSET_GNAMES", Off::InSDK::NameArray::GNames);
 	DSGen::addOffset("OFFSET_GWORLD", Off::InSDK::World::GWorld);
+	DSGen::addOffset("OFFSET_GENGINE", Off::InSDK::World::GEngine);
 	DSGen::addOffset("OFFSET_PROCESSEVENT", Off::InSDK::ProcessEvent::PEOffset);
 	DSGen::addOffset("INDEX_PROCESSEVENT", Off::InSDK::ProcessEvent::PEIndex);
 }
 
+void DumpspaceGenerator::InitMemberTypeCache()
+{
+	CachedMemberTypes.resize(TypeManager::GetNumTypes());
+
+	for (int32 i = 0; i < TypeManager::GetNumTypes(); i++)
+		GetMemberType(TypeInfoHandle(i));
+}
+
+void DumpspaceGenerator::GeneratePackage(PackageInfoHandle Package, DSGen::BakedFragment& OutFragment)
+{
+	/* Generate classes/structs/enums/functions into the fragment of this package, in the same order as they're written to the files */
+	for (int32 EnumIdx : Package.GetEnums())
+	{
+		DSGen::EnumHolder Enum = GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx));
+		DSGen::bakeEnum(Enum, OutFragment);
+	}
+
+	DependencyManager::OnVisitCallbackType GenerateClassOrStructCallback = [&](int32 Index) -> void
+	{
+		DSGen::ClassHolder StructOrClass = GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index));
+		DSGen::bakeStructOrClass(StructOrClass, OutFragment);
+	};
+
+	if (Package.HasStructs())
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
+
+		Structs.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
+	}
+
+	if (Package.HasClasses())
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
+
+		Classes.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
+	}
+}
+
 void DumpspaceGenerator::Generate()
 {
-	/* Set the output directory of DSGen to "...GenerationPath/GameVersion-GameName/Dumespace" */
-	DSGen::setDirectory(MainFolder);
+	/* Set the output directory of DSGen to "...GenerationPath/GameVersion-GameName/Dumespace" and open the files everything is baked into */
+	DSGen::setDirectory(MainFolder, Settings::DumpspaceGenerator::bCompressOutput);
 
 	/* Add offsets for GObjects, GNames, GWorld, AppendString, PrcessEvent and ProcessEventIndex*/
 	GeneratedStaticOffsets();
 
-	// Generates all packages and writes them to files
+	/* Create all MemberTypes in advance, so the cache is only read from while packages are generated on multiple threads */
+	InitMemberTypeCache();
+
+	std::vector<PackageInfoHandle> Packages;
+
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		if (Package.IsEmpty())
-			continue;
-
-		/*
-		* Generate classes/structs/enums/functions directly into the respective files
-		*
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
-		{
-			DSGen::EnumHolder Enum = GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx));
-			DSGen::bakeEnum(Enum);
-		}
+		if (!Package.IsEmpty())
+			Packages.push_back(Package);
+	}
 
-		DependencyManager::OnVisitCallbackType GenerateClassOrStructCallback = [&](int32 Index) -> void
-		{
-			DSGen::ClassHolder StructOrClass = GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index));
-			DSGen::bakeStructOrClass(StructOrClass);
-		};
+	std::vector<DSGen::BakedFragment> Fragments(Packages.size());
 
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
+	auto GeneratePackageFragment = [&](int32 PackageIdx) -> void
+	{
+		GeneratePackage(Packages[PackageIdx], Fragments[PackageIdx]);
+	};
 
-			Structs.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
-		}
+	/* Write the fragments to the files in the order of the packages, so the output is the same as if they were generated one after another */
+	auto MergePackageFragment = [&](int32 PackageIdx) -> void
+	{
+		DSGen::mergeFragment(Fragments[PackageIdx]);
 
-		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+		Fragments[PackageIdx] = DSGen::BakedFragment();
+	};
 
-			Classes.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
-		}
-	}
+	ParallelHelper::GenerateInOrder(static_cast<int32>(Packages.size()), GeneratePackageFragment, MergePackageFragment);
 
-	DSGen::dump();
-}
\ No newline at end of file
+	if (!DSGen::dump())
+		std::cout << "Dumpspace: Error writing the dumpspace files, they are incomplete!" << std::endl;
+}
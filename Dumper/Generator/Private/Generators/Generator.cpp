@@ -4,9 +4,11 @@
 #include "Managers/EnumManager.h"
 #include "Managers/MemberManager.h"
 #include "Managers/PackageManager.h"
+#include "Managers/TypeManager.h"
 
 #include "HashStringTable.h"
 #include "Utils.h"
+#include "Stats/DumpStats.h"
 
 inline void InitWeakObjectPtrSettings()
 {
@@ -60,10 +62,124 @@ inline void InitLargeWorldCoordinateSettings()
 	//std::cout << std::format("\nDumper-7: bUseLargeWorldCoordinates = {}\n", Settings::Internal::bUseLargeWorldCoordinates) << std::endl;
 }
 
+inline void InitEngineVersionSettings()
+{
+	/* FVector3f was added to CoreUObject with UE5.0, even for games that disabled large world coordinates */
+	UEStruct FVector3fStruct = ObjectArray::FindObjectFast<UEStruct>("Vector3f", EClassCastFlags::Struct);
+
+	Settings::Internal::bIsUE5OrHigher = static_cast<bool>(FVector3fStruct);
+
+	//std::cout << std::format("\nDumper-7: bIsUE5OrHigher = {}\n", Settings::Internal::bIsUE5OrHigher) << std::endl;
+}
+
 inline void InitSettings()
 {
 	InitWeakObjectPtrSettings();
 	InitLargeWorldCoordinateSettings();
+	InitEngineVersionSettings();
+}
+
+
+struct StructLayout
+{
+	int32 Size;
+	int32 Alignment;
+	bool bIsFinal;
+	bool bHasReusedTrailingPadding;
+
+	inline bool operator==(const StructLayout& Other) const = default;
+};
+
+/* Everything about a package that ends up in its generated files, besides the contents of its types */
+struct PackageSnapshot
+{
+	std::string Name;
+
+	std::vector<int32> Types;
+	std::vector<std::pair<int32, bool>> EnumForwardDeclarations;
+
+	/* Structs-, Classes- and Parameters-Dependencies, as tuple<PackageIndex, bShouldIncludeStructs, bShouldIncludeClasses> */
+	std::vector<std::tuple<int32, bool, bool>> Dependencies[3];
+
+	inline bool operator==(const PackageSnapshot& Other) const = default;
+};
+
+/* Everything about a type that other types, or packages, depend on */
+struct TypeSnapshot
+{
+	std::string Name;
+	bool bIsUnique;
+
+	StructLayout Layout;
+	bool bIsPartOfCyclicPackage;
+
+	uint8 EnumUnderlyingTypeSize;
+};
+
+inline StructLayout GetStructLayout(StructInfoHandle Info)
+{
+	return { Info.GetUnalignedSize(), Info.GetAlignment(), Info.IsFinal(), Info.HasReusedTrailingPadding() };
+}
+
+/* Only reads from the managers, the types might have been unloaded already */
+inline PackageSnapshot MakePackageSnapshot(PackageInfoHandle Package)
+{
+	PackageSnapshot Snapshot;
+	Snapshot.Name = Package.GetName();
+
+	auto AddType = [&Snapshot](int32 Index) -> void { Snapshot.Types.push_back(Index); };
+
+	Package.GetSortedStructs().VisitAllNodesWithCallback(AddType);
+	Package.GetSortedClasses().VisitAllNodesWithCallback(AddType);
+
+	Snapshot.Types.insert(Snapshot.Types.end(), Package.GetFunctions().begin(), Package.GetFunctions().end());
+	Snapshot.Types.insert(Snapshot.Types.end(), Package.GetEnums().begin(), Package.GetEnums().end());
+	std::sort(Snapshot.Types.begin(), Snapshot.Types.end());
+
+	Snapshot.EnumForwardDeclarations = Package.GetEnumForwardDeclarations();
+	std::sort(Snapshot.EnumForwardDeclarations.begin(), Snapshot.EnumForwardDeclarations.end());
+
+	const DependencyInfo& Dependencies = Package.GetPackageDependencies();
+	const DependencyListType* DependencyLists[3] = { &Dependencies.StructsDependencies, &Dependencies.ClassesDependencies, &Dependencies.ParametersDependencies };
+
+	for (int i = 0; i < 3; i++)
+	{
+		for (const auto& [Index, Requirements] : *DependencyLists[i])
+			Snapshot.Dependencies[i].emplace_back(Requirements.PackageIdx, Requirements.bShouldIncludeStructs, Requirements.bShouldIncludeClasses);
+
+		std::sort(Snapshot.Dependencies[i].begin(), Snapshot.Dependencies[i].end());
+	}
+
+	return Snapshot;
+}
+
+inline std::unordered_map<int32, PackageSnapshot> MakePackageSnapshots()
+{
+	std::unordered_map<int32, PackageSnapshot> Snapshots;
+
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+		Snapshots.emplace(Package.GetIndex(), MakePackageSnapshot(Package));
+
+	return Snapshots;
+}
+
+inline std::unordered_map<int32, TypeSnapshot> MakeTypeSnapshots()
+{
+	std::unordered_map<int32, TypeSnapshot> Snapshots;
+
+	for (const auto& [StructIndex, Info] : StructManager::GetStructInfos())
+	{
+		const StructInfoHandle Handle(Info);
+		Snapshots.emplace(StructIndex, TypeSnapshot{ Handle.GetName().GetName(), Handle.GetName().IsUnique(), GetStructLayout(Handle), Handle.IsPartOfCyclicPackage(), 0x0 });
+	}
+
+	for (const auto& [EnumIndex, Info] : EnumManager::GetEnumInfos())
+	{
+		const EnumInfoHandle Handle(Info);
+		Snapshots.emplace(EnumIndex, TypeSnapshot{ Handle.GetName().GetName(), Handle.GetName().IsUnique(), StructLayout{}, false, Handle.GetUnderlyingTypeSize() });
+	}
+
+	return Snapshots;
 }
 
 
@@ -82,35 +198,407 @@ void Generator::InitEngineCore()
 	/* Multiversus [Unsupported, weird GObjects-struct] */
 	//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x1B5DEAFD6B4068C); });
 
-	ObjectArray::Init();
-	FName::Init();
-	Off::Init();
-	PropertySizes::Init();
-	Off::InSDK::ProcessEvent::InitPE(); //Must be at this position, relies on offsets initialized in Off::Init()
+	DumpStats::ScopedPhase EngineCorePhase("InitEngineCore");
 
-	Off::InSDK::World::InitGWorld(); //Must be at this position, relies on offsets initialized in Off::Init()
+	DumpStats::MeasurePhase("ObjectArray::Init", [] { ObjectArray::Init(); });
+	DumpStats::MeasurePhase("FName::Init", [] { FName::Init(); });
+	DumpStats::MeasurePhase("Off::Init", [] { Off::Init(); });
+	DumpStats::MeasurePhase("PropertySizes::Init", [] { PropertySizes::Init(); });
+	DumpStats::MeasurePhase("Off::InSDK::ProcessEvent::InitPE", [] { Off::InSDK::ProcessEvent::InitPE(); }); //Must be at this position, relies on offsets initialized in Off::Init()
 
-	Off::InSDK::Text::InitTextOffsets(); //Must be at this position, relies on offsets initialized in Off::InitPE()
+	DumpStats::MeasurePhase("Off::InSDK::World::InitGWorld", [] { Off::InSDK::World::InitGWorld(); }); //Must be at this position, relies on offsets initialized in Off::Init()
 
-	InitSettings();
+	DumpStats::MeasurePhase("Off::InSDK::Text::InitTextOffsets", [] { Off::InSDK::Text::InitTextOffsets(); }); //Must be at this position, relies on offsets initialized in Off::InitPE()
+
+	DumpStats::MeasurePhase("InitSettings", [] { InitSettings(); });
 }
 
 void Generator::InitInternal()
 {
+	DumpStats::ScopedPhase InternalPhase("InitInternal");
+
 	// Initialize PackageManager with all packages, their names, structs, classes enums, functions and dependencies
-	PackageManager::Init();
+	DumpStats::MeasurePhase("PackageManager::Init", [] { PackageManager::Init(); });
 
 	// Initialize StructManager with all structs and their names
-	StructManager::Init();
+	DumpStats::MeasurePhase("StructManager::Init", [] { StructManager::Init(); });
 	
 	// Initialize EnumManager with all enums and their names
-	EnumManager::Init();
+	DumpStats::MeasurePhase("EnumManager::Init", [] { EnumManager::Init(); });
 	
 	// Initialized all Member-Name collisions
-	MemberManager::Init();
+	DumpStats::MeasurePhase("MemberManager::Init", [] { MemberManager::Init(); });
 
 	// Post-Initialize PackageManager after StructManager has been initialized. 'PostInit()' handles Cyclic-Dependencies detection
-	PackageManager::PostInit();
+	DumpStats::MeasurePhase("PackageManager::PostInit", [] { PackageManager::PostInit(); });
+
+	// Initialize TypeManager with the types of all properties. Requires cyclic-dependency information from 'PackageManager::PostInit()'
+	DumpStats::MeasurePhase("TypeManager::Init", [] { TypeManager::Init(); });
+
+	if constexpr (Settings::Generator::bStayResident)
+		InitKnownObjects();
+}
+
+void Generator::InitKnownObjects()
+{
+	const int32 NumObjects = ObjectArray::Num();
+
+	KnownObjects.clear();
+	KnownObjects.resize(NumObjects, KnownObject{ nullptr, false });
+
+	for (int32 i = 0; i < NumObjects; i++)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(i);
+
+		if (!Obj)
+			continue;
+
+		KnownObjects[i].Address = Obj.GetAddress();
+		KnownObjects[i].bIsType = Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Enum);
+	}
+}
+
+bool Generator::InitNewObjects(std::unordered_set<int32>& OutPackagesToRegenerate, std::vector<std::string>& OutRemovedPackages)
+{
+	const int32 NumObjects = ObjectArray::Num();
+	const int32 NumKnownObjects = static_cast<int32>(KnownObjects.size());
+
+	std::vector<int32> NewObjects;
+	std::unordered_set<int32> UnloadedTypes;
+
+	/* New objects are either appended to GObjects, or reuse the index of an object that was destroyed */
+	for (int32 i = 0; i < std::max(NumObjects, NumKnownObjects); i++)
+	{
+		UEObject Obj = i < NumObjects ? ObjectArray::GetByIndex(i) : UEObject(nullptr);
+		void* Address = Obj ? Obj.GetAddress() : nullptr;
+
+		if (i < NumKnownObjects && KnownObjects[i].Address == Address)
+			continue;
+
+		if (i < NumKnownObjects && KnownObjects[i].bIsType)
+			UnloadedTypes.insert(i);
+
+		if (Obj && (Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Enum)))
+			NewObjects.push_back(i);
+	}
+
+	/* The managers refer to types by their index, which might have been reused by another object */
+	if (!UnloadedTypes.empty())
+	{
+		ReinitManagers(UnloadedTypes, OutPackagesToRegenerate, OutRemovedPackages);
+
+		std::cout << std::format("\nDumper-7: {} classes, structs, functions and enums were unloaded and {} were loaded. Regenerating {} package(s), removing {} package(s).\n", UnloadedTypes.size(), NewObjects.size(), OutPackagesToRegenerate.size(), OutRemovedPackages.size()) << std::endl;
+
+		return true;
+	}
+
+	if (NewObjects.empty())
+	{
+		std::cout << "\nDumper-7: No new classes, structs or enums were loaded since the last pass.\n" << std::endl;
+
+		InitKnownObjects();
+		return false;
+	}
+
+	auto GetLayout = [](UEStruct Struct) -> StructLayout
+	{
+		return GetStructLayout(StructManager::GetInfo(Struct));
+	};
+
+	/* Supers of new structs can change, eg. they are no longer final or their trailing padding is reused by the new struct */
+	std::unordered_map<int32, StructLayout> OldSuperLayouts;
+
+	for (int32 Index : NewObjects)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (!Obj.IsA(EClassCastFlags::Struct))
+			continue;
+
+		for (UEStruct Super = Obj.Cast<UEStruct>().GetSuper(); Super; Super = Super.GetSuper())
+		{
+			if (!OldSuperLayouts.contains(Super.GetIndex()) && StructManager::GetStructInfos().contains(Super.GetIndex()))
+				OldSuperLayouts.emplace(Super.GetIndex(), GetLayout(Super));
+		}
+	}
+
+	/* Properties of new structs can increase the underlying type-size of existing enums */
+	std::unordered_map<int32, uint8> OldEnumSizes;
+	OldEnumSizes.reserve(EnumManager::GetEnumInfos().size());
+
+	for (const auto& [EnumIndex, Info] : EnumManager::GetEnumInfos())
+		OldEnumSizes.emplace(EnumIndex, EnumInfoHandle(Info).GetUnderlyingTypeSize());
+
+	/* Same order as in InitInternal(), but PackageManager relies on StructManager for cycles, which is otherwise initialized by 'PackageManager::PostInit()' */
+	StructManager::AddNewObjects(NewObjects);
+	EnumManager::AddNewObjects(NewObjects);
+	MemberManager::AddNewObjects(NewObjects);
+	PackageManager::AddNewObjects(NewObjects, OutPackagesToRegenerate);
+
+	std::unordered_set<int32> NewlyCyclicTypes;
+	TypeManager::AddNewObjects(NewObjects, NewlyCyclicTypes);
+
+	bool bHasNameCollisions = false;
+
+	for (int32 Index : NewObjects)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		OutPackagesToRegenerate.insert(Obj.GetPackageIndex());
+
+		if (Obj.IsA(EClassCastFlags::Function))
+			continue;
+
+		if (Obj.IsA(EClassCastFlags::Struct))
+		{
+			bHasNameCollisions = bHasNameCollisions || !StructManager::GetInfo(Obj.Cast<UEStruct>()).GetName().IsUnique();
+		}
+		else
+		{
+			bHasNameCollisions = bHasNameCollisions || !EnumManager::GetInfo(Obj.Cast<UEEnum>()).GetName().IsUnique();
+		}
+	}
+
+	for (int32 PackageIndex : OutPackagesToRegenerate)
+		bHasNameCollisions = bHasNameCollisions || !PackageManager::GetInfo(PackageIndex).GetNameEntry().IsUniqueInTable();
+
+	std::unordered_set<int32> ChangedSupers;
+
+	for (const auto& [SuperIndex, OldLayout] : OldSuperLayouts)
+	{
+		UEStruct Super = ObjectArray::GetByIndex<UEStruct>(SuperIndex);
+
+		if (GetLayout(Super) != OldLayout)
+			ChangedSupers.insert(SuperIndex);
+	}
+
+	/* Subclasses depend on the layout of their supers, eg. for the padding before their first member */
+	if (!ChangedSupers.empty())
+	{
+		for (const auto& [StructIndex, Info] : StructManager::GetStructInfos())
+		{
+			UEStruct Struct = ObjectArray::GetByIndex<UEStruct>(StructIndex);
+
+			for (UEStruct Current = Struct; Current; Current = Current.GetSuper())
+			{
+				if (!ChangedSupers.contains(Current.GetIndex()))
+					continue;
+
+				OutPackagesToRegenerate.insert(Struct.GetPackageIndex());
+				break;
+			}
+		}
+	}
+
+	/* The underlying type is part of the declaration of an enum and of all of its forward-declarations */
+	std::unordered_set<int32> ResizedEnums;
+
+	for (const auto& [EnumIndex, OldSize] : OldEnumSizes)
+	{
+		if (EnumInfoHandle(EnumManager::GetEnumInfos().at(EnumIndex)).GetUnderlyingTypeSize() == OldSize)
+			continue;
+
+		ResizedEnums.insert(EnumIndex);
+		OutPackagesToRegenerate.insert(ObjectArray::GetByIndex(EnumIndex).GetPackageIndex());
+	}
+
+	if (!ResizedEnums.empty())
+	{
+		for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+		{
+			for (const auto& [EnumIndex, bIsForClasses] : Package.GetEnumForwardDeclarations())
+			{
+				if (!ResizedEnums.contains(EnumIndex))
+					continue;
+
+				OutPackagesToRegenerate.insert(Package.GetIndex());
+				break;
+			}
+		}
+	}
+
+	/* Members and parameters of a type that became cyclic are declared differently, eg. as a forward-declared TStructCycleFixup */
+	if (!NewlyCyclicTypes.empty())
+	{
+		for (auto Obj : ObjectArray())
+		{
+			if (!Obj.IsA(EClassCastFlags::Struct) || OutPackagesToRegenerate.contains(Obj.GetPackageIndex()))
+				continue;
+
+			for (UEProperty Property : Obj.Cast<UEStruct>().GetProperties())
+			{
+				if (!NewlyCyclicTypes.contains(TypeManager::GetInfo(Property).GetIndex()))
+					continue;
+
+				OutPackagesToRegenerate.insert(Obj.GetPackageIndex());
+				break;
+			}
+		}
+	}
+
+	/* Other packages might refer to types whose names are no longer unique, there's no way to know which ones without generating them */
+	if (bHasNameCollisions)
+	{
+		std::cout << "\nDumper-7: Names of new types collide with existing ones, regenerating all packages.\n" << std::endl;
+
+		for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+			OutPackagesToRegenerate.insert(Package.GetIndex());
+	}
+
+	InitKnownObjects();
+
+	std::cout << std::format("\nDumper-7: Found {} new classes, structs, functions and enums. Regenerating {} package(s).\n", NewObjects.size(), OutPackagesToRegenerate.size()) << std::endl;
+
+	return true;
+}
+
+void Generator::ReinitManagers(const std::unordered_set<int32>& UnloadedTypes, std::unordered_set<int32>& OutPackagesToRegenerate, std::vector<std::string>& OutRemovedPackages)
+{
+	const std::unordered_map<int32, PackageSnapshot> OldPackages = MakePackageSnapshots();
+	const std::unordered_map<int32, TypeSnapshot> OldTypes = MakeTypeSnapshots();
+
+	StructManager::Reset();
+	EnumManager::Reset();
+	MemberManager::Reset();
+	PackageManager::Reset();
+	TypeManager::Reset();
+
+	/* Also updates KnownObjects */
+	InitInternal();
+
+	const std::unordered_map<int32, PackageSnapshot> NewPackages = MakePackageSnapshots();
+
+	/* Packages that were removed, or renamed, leave behind files that need to be deleted */
+	for (const auto& [PackageIndex, OldSnapshot] : OldPackages)
+	{
+		auto It = NewPackages.find(PackageIndex);
+
+		if (It == NewPackages.end() || It->second.Name != OldSnapshot.Name)
+			OutRemovedPackages.push_back(OldSnapshot.Name);
+	}
+
+	bool bHaveNamesChanged = false;
+
+	for (const auto& [PackageIndex, NewSnapshot] : NewPackages)
+	{
+		auto It = OldPackages.find(PackageIndex);
+
+		if (It == OldPackages.end() || It->second != NewSnapshot)
+			OutPackagesToRegenerate.insert(PackageIndex);
+
+		bHaveNamesChanged = bHaveNamesChanged || (It != OldPackages.end() && It->second.Name != NewSnapshot.Name);
+	}
+
+	std::unordered_set<int32> ChangedStructs;
+	std::unordered_set<int32> ChangedCyclicStructs;
+
+	for (const auto& [Index, OldType] : OldTypes)
+	{
+		if (UnloadedTypes.contains(Index))
+			continue;
+
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (Obj.IsA(EClassCastFlags::Enum))
+		{
+			const EnumInfoHandle NewInfo = EnumManager::GetInfo(Obj.Cast<UEEnum>());
+
+			bHaveNamesChanged = bHaveNamesChanged || NewInfo.GetName().GetName() != OldType.Name || NewInfo.GetName().IsUnique() != OldType.bIsUnique;
+
+			if (NewInfo.GetUnderlyingTypeSize() == OldType.EnumUnderlyingTypeSize)
+				continue;
+
+			/* The underlying type is part of the declaration of an enum and of all of its forward-declarations */
+			OutPackagesToRegenerate.insert(Obj.GetPackageIndex());
+
+			for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+			{
+				for (const auto& [EnumIndex, bIsForClasses] : Package.GetEnumForwardDeclarations())
+				{
+					if (EnumIndex == Index)
+						OutPackagesToRegenerate.insert(Package.GetIndex());
+				}
+			}
+
+			continue;
+		}
+
+		const StructInfoHandle NewInfo = StructManager::GetInfo(Obj.Cast<UEStruct>());
+
+		bHaveNamesChanged = bHaveNamesChanged || NewInfo.GetName().GetName() != OldType.Name || NewInfo.GetName().IsUnique() != OldType.bIsUnique;
+
+		/* Supers are no longer final, or no longer have their trailing padding reused, when all of their subclasses were unloaded */
+		if (GetStructLayout(NewInfo) != OldType.Layout || NewInfo.IsPartOfCyclicPackage() != OldType.bIsPartOfCyclicPackage)
+			ChangedStructs.insert(Index);
+
+		if (NewInfo.IsPartOfCyclicPackage() != OldType.bIsPartOfCyclicPackage)
+			ChangedCyclicStructs.insert(Index);
+	}
+
+	/* Members and parameters referring to a struct that became, or stopped being, cyclic are declared differently, eg. as a TStructCycleFixup */
+	if (!ChangedCyclicStructs.empty())
+	{
+		auto RefersToChangedStruct = [&](auto&& Self, TypeInfoHandle Type) -> bool
+		{
+			if (!Type.IsValid())
+				return false;
+
+			if ((Type.GetCastFlags() & EClassCastFlags::StructProperty) && ChangedCyclicStructs.contains(Type.GetReferencedIndex()))
+				return true;
+
+			return Self(Self, Type.GetInnerType(0)) || Self(Self, Type.GetInnerType(1));
+		};
+
+		for (auto Obj : ObjectArray())
+		{
+			if (!Obj.IsA(EClassCastFlags::Struct) || OutPackagesToRegenerate.contains(Obj.GetPackageIndex()))
+				continue;
+
+			for (UEProperty Property : Obj.Cast<UEStruct>().GetProperties())
+			{
+				if (!RefersToChangedStruct(RefersToChangedStruct, TypeManager::GetInfo(Property)))
+					continue;
+
+				OutPackagesToRegenerate.insert(Obj.GetPackageIndex());
+				break;
+			}
+		}
+	}
+
+	/* Subclasses depend on the layout of their supers, eg. for the padding before their first member */
+	if (!ChangedStructs.empty())
+	{
+		for (const auto& [StructIndex, Info] : StructManager::GetStructInfos())
+		{
+			UEStruct Struct = ObjectArray::GetByIndex<UEStruct>(StructIndex);
+
+			for (UEStruct Current = Struct; Current; Current = Current.GetSuper())
+			{
+				if (!ChangedStructs.contains(Current.GetIndex()))
+					continue;
+
+				OutPackagesToRegenerate.insert(Struct.GetPackageIndex());
+				break;
+			}
+		}
+	}
+
+	/* Types in any package might refer to a type whose name changed */
+	if (bHaveNamesChanged)
+	{
+		std::cout << "\nDumper-7: Names of types changed through unloaded or new types, regenerating all packages.\n" << std::endl;
+
+		for (const auto& [PackageIndex, NewSnapshot] : NewPackages)
+			OutPackagesToRegenerate.insert(PackageIndex);
+	}
+}
+
+void Generator::WriteDumpStats()
+{
+	if (DumperFolder.empty())
+		return;
+
+	DumpStats::WriteToFile(DumperFolder);
 }
 
 bool Generator::SetupDumperFolder()
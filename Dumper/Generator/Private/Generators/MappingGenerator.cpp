@@ -11,163 +11,192 @@
 
 EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
 {
-	auto [Class, FieldClass] = Property.GetClass();
+	return TypeManager::GetInfo(Property).GetMappingType();
+}
 
-	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+uint64 MappingGenerator::GetFNameKey(FName Name)
+{
+	return (static_cast<uint64>(static_cast<uint32>(Name.GetCompIdx())) << 32) | Name.GetNumber();
+}
 
-	if (Flags & EClassCastFlags::ByteProperty)
-	{
-		return EMappingsTypeFlags::ByteProperty;
-	}
-	else if (Flags & EClassCastFlags::UInt16Property)
-	{
-		return EMappingsTypeFlags::UInt16Property;
-	}
-	else if (Flags & EClassCastFlags::UInt32Property)
-	{
-		return EMappingsTypeFlags::UInt32Property;
-	}
-	else if (Flags & EClassCastFlags::UInt64Property)
-	{
-		return EMappingsTypeFlags::UInt64Property;
-	}
-	else if (Flags & EClassCastFlags::Int8Property)
-	{
-		return EMappingsTypeFlags::Int8Property;
-	}
-	else if (Flags & EClassCastFlags::Int16Property)
-	{
-		return EMappingsTypeFlags::Int16Property;
-	}
-	else if (Flags & EClassCastFlags::IntProperty)
-	{
-		return EMappingsTypeFlags::IntProperty;
-	}
-	else if (Flags & EClassCastFlags::Int64Property)
-	{
-		return EMappingsTypeFlags::Int64Property;
-	}
-	else if (Flags & EClassCastFlags::FloatProperty)
-	{
-		return EMappingsTypeFlags::FloatProperty;
-	}
-	else if (Flags & EClassCastFlags::DoubleProperty)
-	{
-		return EMappingsTypeFlags::DoubleProperty;
-	}
-	else if ((Flags & EClassCastFlags::ObjectProperty) || (Flags & EClassCastFlags::ClassProperty))
-	{
-		return EMappingsTypeFlags::ObjectProperty;
-	}
-	else if (Flags & EClassCastFlags::NameProperty)
-	{
-		return EMappingsTypeFlags::NameProperty;
-	}
-	else if (Flags & EClassCastFlags::StrProperty)
-	{
-		return EMappingsTypeFlags::StrProperty;
-	}
-	else if (Flags & EClassCastFlags::TextProperty)
-	{
-		return EMappingsTypeFlags::TextProperty;
-	}
-	else if (Flags & EClassCastFlags::BoolProperty)
-	{
-		return EMappingsTypeFlags::BoolProperty;
-	}
-	else if (Flags & EClassCastFlags::StructProperty)
-	{
-		return EMappingsTypeFlags::StructProperty;
-	}
-	else if (Flags & EClassCastFlags::ArrayProperty)
-	{
-		return EMappingsTypeFlags::ArrayProperty;
-	}
-	else if (Flags & EClassCastFlags::WeakObjectProperty)
-	{
-		return EMappingsTypeFlags::WeakObjectProperty;
-	}
-	else if (Flags & EClassCastFlags::LazyObjectProperty)
-	{
-		return EMappingsTypeFlags::LazyObjectProperty;
-	}
-	else if ((Flags & EClassCastFlags::SoftObjectProperty) || (Flags & EClassCastFlags::SoftClassProperty))
+FName MappingGenerator::GetObjectFName(UEObject Object)
+{
+	/* FName without an address results in "None", same as the name of an invalid object */
+	return Object ? Object.GetFName() : FName(nullptr);
+}
+
+FName MappingGenerator::GetStructFName(const StructWrapper& Struct)
+{
+	return GetObjectFName(Struct.GetUnrealStruct());
+}
+
+int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::string& Name)
+{
+	auto [It, bInserted] = StringToNameIndex.insert({ Name, static_cast<int32>(NameCounter) });
+
+	/* The name didn't occure yet, write it to the NameTable */
+	if (bInserted)
 	{
-		return EMappingsTypeFlags::SoftObjectProperty;
+		WriteToStream(NameTable, static_cast<uint16>(Name.length()));
+		NameTable.write(Name.c_str(), Name.length());
+		NameCounter++;
 	}
-	else if (Flags & EClassCastFlags::MapProperty)
+
+	return It->second;
+}
+
+void MappingGenerator::AddNameToData(std::stringstream& NameTable, FName Name)
+{
+	if (!Name.GetAddress())
 	{
-		return EMappingsTypeFlags::MapProperty;
+		AddNameToData(NameTable, Name.ToString());
+		return;
 	}
-	else if (Flags & EClassCastFlags::SetProperty)
+
+	const uint64 Key = GetFNameKey(Name);
+
+	/* Only convert FNames to a string the first time they occure */
+	if (FNameToNameIndex.contains(Key))
+		return;
+
+	if constexpr (Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
 	{
-		return EMappingsTypeFlags::SetProperty;
+		FNameToNameIndex[Key] = AddNameToData(NameTable, Name.ToString());
+		return;
 	}
-	else if (Flags & EClassCastFlags::EnumProperty)
+
+	const std::string NameString = Name.ToString();
+
+	WriteToStream(NameTable, static_cast<uint16>(NameString.length()));
+	NameTable.write(NameString.c_str(), NameString.length());
+
+	FNameToNameIndex[Key] = static_cast<int32>(NameCounter++);
+}
+
+int32 MappingGenerator::GetNameIndex(const std::string& Name)
+{
+	return StringToNameIndex.at(Name);
+}
+
+int32 MappingGenerator::GetNameIndex(FName Name)
+{
+	if (!Name.GetAddress())
+		return GetNameIndex(Name.ToString());
+
+	return FNameToNameIndex.at(GetFNameKey(Name));
+}
+
+void MappingGenerator::AddPropertyTypeNames(TypeInfoHandle Type, std::stringstream& NameTable)
+{
+	/* Same order in which 'GeneratePropertyType()' looks up the names */
+	if (!Type.IsValid())
+		return;
+
+	const EMappingsTypeFlags MappingType = Type.GetMappingType();
+
+	if (MappingType == EMappingsTypeFlags::EnumProperty)
 	{
-		return EMappingsTypeFlags::EnumProperty;
+		AddPropertyTypeNames(Type.GetInnerType(), NameTable);
+		AddNameToData(NameTable, GetObjectFName(Type.GetReferencedObject<UEEnum>()));
 	}
-	else if (Flags & EClassCastFlags::InterfaceProperty)
+	else if (MappingType == EMappingsTypeFlags::ByteProperty)
 	{
-		return EMappingsTypeFlags::InterfaceProperty;
+		if (Type.GetReferencedIndex() != -1)
+			AddNameToData(NameTable, GetObjectFName(Type.GetReferencedObject<UEEnum>()));
 	}
-	else if (Flags & EClassCastFlags::FieldPathProperty)
+	else if (MappingType == EMappingsTypeFlags::StructProperty)
 	{
-		return EMappingsTypeFlags::FieldPathProperty;
+		AddNameToData(NameTable, GetObjectFName(Type.GetReferencedObject<UEStruct>()));
 	}
-	else if (Flags & EClassCastFlags::OptionalProperty)
+	else if (MappingType == EMappingsTypeFlags::SetProperty || MappingType == EMappingsTypeFlags::ArrayProperty || MappingType == EMappingsTypeFlags::OptionalProperty)
 	{
-		return EMappingsTypeFlags::OptionalProperty;
+		AddPropertyTypeNames(Type.GetInnerType(), NameTable);
 	}
-	else if (Flags & EClassCastFlags::MulticastDelegateProperty)
+	else if (MappingType == EMappingsTypeFlags::MapProperty)
 	{
-		return EMappingsTypeFlags::MulticastDelegateProperty;
+		AddPropertyTypeNames(Type.GetInnerType(0), NameTable);
+		AddPropertyTypeNames(Type.GetInnerType(1), NameTable);
 	}
-	else if (Flags & EClassCastFlags::DelegateProperty)
+}
+
+void MappingGenerator::AddStructNames(const StructWrapper& Struct, std::stringstream& NameTable)
+{
+	/* Same order in which 'GenerateStruct()' looks up the names */
+	if (!Struct.IsValid())
+		return;
+
+	AddNameToData(NameTable, GetStructFName(Struct));
+
+	StructWrapper Super = Struct.GetSuper();
+
+	if (Super.IsValid())
+		AddNameToData(NameTable, GetStructFName(Super));
+
+	MemberManager Members = Struct.GetMembers();
+
+	for (const PropertyWrapper& Member : Members.IterateMembers())
 	{
-		return EMappingsTypeFlags::DelegateProperty;
+		if (Settings::MappingGenerator::bExcludeEditorOnlyProperties && Member.HasPropertyFlags(EPropertyFlags::EditorOnly))
+			continue;
+
+		if (!Member.IsUnrealProperty())
+			continue;
+
+		AddNameToData(NameTable, Member.GetUnrealProperty().GetFName());
+		AddPropertyTypeNames(TypeManager::GetInfo(Member.GetUnrealProperty()), NameTable);
 	}
-	
-	return EMappingsTypeFlags::Unknown;
 }
 
-int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::string& Name)
+void MappingGenerator::AddEnumNames(const EnumWrapper& Enum, std::stringstream& NameTable)
 {
-	if constexpr (Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
+	/* Same order in which 'GenerateEnum()' looks up the names */
+	AddNameToData(NameTable, GetObjectFName(Enum.GetUnrealEnum()));
+
+	for (EnumCollisionInfo Member : Enum.GetMembers())
+		AddNameToData(NameTable, Member.GetUniqueName());
+}
+
+void MappingGenerator::GenerateNameTable(const std::vector<PackageInfoHandle>& Packages, std::stringstream& NameTable)
+{
+	/* Names are added in the same order in which they were written when enums and structs were still serialized one after another */
+	for (const PackageInfoHandle& Package : Packages)
 	{
-		static std::unordered_map<std::string, int32> NameMap;
-		
-		auto [It, bInserted] = NameMap.insert({ Name, NameCounter });
+		for (int32 EnumIdx : Package.GetEnums())
+			AddEnumNames(ObjectArray::GetByIndex<UEEnum>(EnumIdx), NameTable);
+	}
 
-		/* The name didn't occure yet, write it to the NameTable */
-		if (bInserted)
+	for (const PackageInfoHandle& Package : Packages)
+	{
+		DependencyManager::OnVisitCallbackType AddStructNamesCallback = [&](int32 Index) -> void
 		{
-			WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-			NameTable.write(Name.c_str(), Name.length());
-			return NameCounter++;
-		}
+			AddStructNames(ObjectArray::GetByIndex<UEStruct>(Index), NameTable);
+		};
 
-		return It->second;
-	}
+		if (Package.HasStructs())
+			Package.GetSortedStructs().VisitAllNodesWithCallback(AddStructNamesCallback);
 
-	WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-	NameTable.write(Name.c_str(), Name.length());
+		if (Package.HasClasses())
+			Package.GetSortedClasses().VisitAllNodesWithCallback(AddStructNamesCallback);
+	}
+}
 
-	return NameCounter++;
+void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstream& Data)
+{
+	GeneratePropertyType(TypeManager::GetInfo(Property), Data);
 }
 
-void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GeneratePropertyType(TypeInfoHandle Type, std::stringstream& Data)
 {
-	if (!Property)
+	if (!Type.IsValid())
 	{
 		WriteToStream(Data, static_cast<uint8>(EMappingsTypeFlags::Unknown));
 		return;
 	}
 
-	EMappingsTypeFlags MappingType = GetMappingType(Property);
+	EMappingsTypeFlags MappingType = Type.GetMappingType();
 
 	/* Serialize ByteProperty as an EnumProperty with 'UnderlayingType == uint8' if the inner enum is valid */
-	const bool bIsFakeEnumProperty = MappingType == EMappingsTypeFlags::ByteProperty && Property.Cast<UEByteProperty>().GetEnum();
+	const bool bIsFakeEnumProperty = MappingType == EMappingsTypeFlags::ByteProperty && Type.GetReferencedIndex() != -1;
 
 	WriteToStream(Data, static_cast<uint8>(!bIsFakeEnumProperty ? MappingType : EMappingsTypeFlags::EnumProperty));
 
@@ -177,42 +206,33 @@ void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstre
 
 	if (MappingType == EMappingsTypeFlags::EnumProperty)
 	{
-		GeneratePropertyType(Property.Cast<UEEnumProperty>().GetUnderlayingProperty(), Data, NameTable);
+		GeneratePropertyType(Type.GetInnerType(), Data);
 
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEEnumProperty>().GetEnum().GetName());
+		const int32 EnumNameIdx = GetNameIndex(GetObjectFName(Type.GetReferencedObject<UEEnum>()));
 		WriteToStream(Data, EnumNameIdx);
 	}
 	else if (bIsFakeEnumProperty)
 	{
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEByteProperty>().GetEnum().GetName());
+		const int32 EnumNameIdx = GetNameIndex(GetObjectFName(Type.GetReferencedObject<UEEnum>()));
 		WriteToStream(Data, EnumNameIdx);
 	}
 	else if (MappingType == EMappingsTypeFlags::StructProperty)
 	{
-		const int32 StructNameIdx = AddNameToData(NameTable, Property.Cast<UEStructProperty>().GetUnderlayingStruct().GetName());
+		const int32 StructNameIdx = GetNameIndex(GetObjectFName(Type.GetReferencedObject<UEStruct>()));
 		WriteToStream(Data, StructNameIdx);
 	}
-	else if (MappingType == EMappingsTypeFlags::SetProperty)
-	{
-		GeneratePropertyType(Property.Cast<UESetProperty>().GetElementProperty(), Data, NameTable);
-	}
-	else if (MappingType == EMappingsTypeFlags::ArrayProperty)
-	{
-		GeneratePropertyType(Property.Cast<UEArrayProperty>().GetInnerProperty(), Data, NameTable);
-	}
-	else if (MappingType == EMappingsTypeFlags::OptionalProperty)
+	else if (MappingType == EMappingsTypeFlags::SetProperty || MappingType == EMappingsTypeFlags::ArrayProperty || MappingType == EMappingsTypeFlags::OptionalProperty)
 	{
-		GeneratePropertyType(Property.Cast<UEOptionalProperty>().GetValueProperty(), Data, NameTable);
+		GeneratePropertyType(Type.GetInnerType(), Data);
 	}
 	else if (MappingType == EMappingsTypeFlags::MapProperty)
 	{
-		UEMapProperty AsMapProperty = Property.Cast<UEMapProperty>();
-		GeneratePropertyType(AsMapProperty.GetKeyProperty(), Data, NameTable);
-		GeneratePropertyType(AsMapProperty.GetValueProperty(), Data, NameTable);
+		GeneratePropertyType(Type.GetInnerType(0), Data);
+		GeneratePropertyType(Type.GetInnerType(1), Data);
 	}
 }
 
-void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index)
+void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, int32& Index)
 {
 	if (!Property.IsUnrealProperty())
 	{
@@ -223,28 +243,27 @@ void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std
 	WriteToStream(Data, static_cast<uint16>(Index));
 	WriteToStream(Data, static_cast<uint8>(Property.GetArrayDim()));
 
-	const int32 MemberNameIdx = AddNameToData(NameTable, Property.GetUnrealProperty().GetName());
+	const int32 MemberNameIdx = GetNameIndex(Property.GetUnrealProperty().GetFName());
 	WriteToStream(Data, MemberNameIdx);
 
-	GeneratePropertyType(Property.GetUnrealProperty(), Data, NameTable);
+	GeneratePropertyType(Property.GetUnrealProperty(), Data);
 
 	Index += Property.GetArrayDim();
 }
 
-void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringstream& Data)
 {
 	if (!Struct.IsValid())
 		return;
 
-	const int32 StructNameIndex = AddNameToData(NameTable, Struct.GetRawName());
+	const int32 StructNameIndex = GetNameIndex(GetStructFName(Struct));
 	WriteToStream(Data, StructNameIndex);
 
 	StructWrapper Super = Struct.GetSuper();
 
 	if (Super.IsValid())
 	{
-		/* Most likely adds a duplicate to the name-table. Find a better solution later! */
-		const int32 SuperNameIndex = AddNameToData(NameTable, Super.GetRawName());
+		const int32 SuperNameIndex = GetNameIndex(GetStructFName(Super));
 		WriteToStream(Data, SuperNameIndex);
 	}
 	else
@@ -279,20 +298,20 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
 		if (ExcludeEditorOnlyProps && Member.HasPropertyFlags(EPropertyFlags::EditorOnly))
 			continue;
 
-		GeneratePropertyInfo(Member, Data, NameTable, IndexIncrementedByFunction);
+		GeneratePropertyInfo(Member, Data, IndexIncrementedByFunction);
 	}
 }
 
-void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data)
 {
-	const int32 EnumNameIndex = AddNameToData(NameTable, Enum.GetRawName());
+	const int32 EnumNameIndex = GetNameIndex(GetObjectFName(Enum.GetUnrealEnum()));
 	WriteToStream(Data, EnumNameIndex);
 
 	WriteToStream(Data, static_cast<uint16>(Enum.GetNumMembers()));
 
 	for (EnumCollisionInfo Member : Enum.GetMembers())
 	{
-		const int32 EnumMemberNameIdx = AddNameToData(NameTable, Member.GetUniqueName());
+		const int32 EnumMemberNameIdx = GetNameIndex(Member.GetUniqueName());
 		WriteToStream(Data, EnumMemberNameIdx);
 	}
 }
@@ -307,51 +326,67 @@ std::stringstream MappingGenerator::GenerateFileData()
 	uint32 NumEnums = 0x0;
 	uint32 NumStructsAndClasse = 0x0;
 
-	/* Handle all Enums first */
+	std::vector<PackageInfoHandle> Packages;
+
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		if (Package.IsEmpty())
-			continue;
+		if (!Package.IsEmpty())
+			Packages.push_back(Package);
+	}
 
-		/* Create files and handles namespaces and includes */
-		if (!Package.HasEnums())
-			continue;
+	/* Build the entire name-table first, so every name already has its final index once structs and enums are serialized on multiple threads */
+	GenerateNameTable(Packages, NameData);
+
+	struct PackageData
+	{
+		std::stringstream EnumData;
+		std::stringstream StructData;
+		uint32 NumEnums = 0x0;
+		uint32 NumStructsAndClasses = 0x0;
+	};
+
+	std::vector<PackageData> DataPerPackage(Packages.size());
+
+	auto GeneratePackageData = [&](int32 PackageIdx) -> void
+	{
+		const PackageInfoHandle& Package = Packages[PackageIdx];
+		PackageData& OutData = DataPerPackage[PackageIdx];
 
 		for (int32 EnumIdx : Package.GetEnums())
 		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), EnumData, NameData);
-			NumEnums++;
+			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), OutData.EnumData);
+			OutData.NumEnums++;
 		}
-	}
-	
-	/* Handle all structs and classes in one go. From the mapping-files point of view classes are the exact same as structs. */
-	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
-	{
-		if (Package.IsEmpty())
-			continue;
-
-		/* Create files and handles namespaces and includes */
-		if (!Package.HasClasses() && !Package.HasStructs())
-			continue;
 
+		/* Handle all structs and classes in one go. From the mapping-files point of view classes are the exact same as structs. */
 		DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
 		{
-			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructData, NameData);
-			NumStructsAndClasse++;
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), OutData.StructData);
+			OutData.NumStructsAndClasses++;
 		};
 
 		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+			Package.GetSortedStructs().VisitAllNodesWithCallback(GenerateStructCallback);
 
 		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
-			Classes.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
-	}
+			Package.GetSortedClasses().VisitAllNodesWithCallback(GenerateStructCallback);
+	};
+
+	/* Concatenate the data of all packages in the order of the packages */
+	auto AppendPackageData = [&](int32 PackageIdx) -> void
+	{
+		PackageData& Data = DataPerPackage[PackageIdx];
+
+		WriteToStream(EnumData, Data.EnumData);
+		WriteToStream(StructData, Data.StructData);
+
+		NumEnums += Data.NumEnums;
+		NumStructsAndClasse += Data.NumStructsAndClasses;
+
+		Data = PackageData();
+	};
+
+	ParallelHelper::GenerateInOrder(static_cast<int32>(Packages.size()), GeneratePackageData, AppendPackageData);
 
 	/* Combine all of the stringstreams into one Data block representing the entire payload of the file */
 	std::stringstream ReturnBuffer;
@@ -436,6 +471,8 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
 void MappingGenerator::Generate()
 {
 	NameCounter = 0x0;
+	FNameToNameIndex.clear();
+	StringToNameIndex.clear();
 
 	std::string MappingsFileName = (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName + ".usmap");
 
@@ -447,7 +484,16 @@ void MappingGenerator::Generate()
 	/* Generate the payload of the file, containing all of the names, enums and structs. */
 	std::stringstream FileData = GenerateFileData();
 
+	if (!FileData.good())
+	{
+		std::cout << "\nDumper-7: Failed to serialize the mappings, .usmap file was not written!\n" << std::endl;
+		return;
+	}
+
 	/* Generate the header, and write both header and payload into the file. */
 	GenerateFileHeader(UsmapFile, FileData);
+
+	if (!UsmapFile.good())
+		std::cout << std::format("\nDumper-7: Failed to write '{}'!\n", MappingsFileName) << std::endl;
 }
 
@@ -1,4 +1,5 @@
 #include "HashStringTable.h"
+#include "Stats/DumpStats.h"
 
 
 #pragma warning(suppress: 26495)
@@ -141,13 +142,20 @@ HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, ui
 
     StringBucket& Bucket = Buckets[Hash];
 
+    uint64 NumProbes = 0;
+
     /* Try to find duplications withing 'checked' regions */
     for (auto It = HashBucketIterator::begin(Bucket); It != HashBucketIterator::end(Bucket); ++It)
     {
         const StringEntry& Entry = *It;
 
+        NumProbes++;
+
         if (Entry.Length == Length && Entry.bIsWide == bIsWchar && Strcmp(Str, Entry) == 0)
         {
+            DumpStats::Increment(DumpStats::ECounter::HashStringTableLookups);
+            DumpStats::Increment(DumpStats::ECounter::HashStringTableProbes, NumProbes);
+
             HashStringTableIndex Idx;
             Idx.Unused = 0x0;
             Idx.HashIndex = Hash;
@@ -157,6 +165,9 @@ HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, ui
         }
     }
 
+    DumpStats::Increment(DumpStats::ECounter::HashStringTableLookups);
+    DumpStats::Increment(DumpStats::ECounter::HashStringTableProbes, NumProbes);
+
     return HashStringTableIndex::FromInt(-1);
 }
 
@@ -215,6 +226,12 @@ int32 HashStringTable::GetTotalUsedSize() const
     return TotalMemoryUsed;
 }
 
+void HashStringTable::Clear()
+{
+    for (int i = 0; i < NumBuckets; i++)
+        Buckets[i].Size = 0x0;
+}
+
 void HashStringTable::DebugPrintStats() const
 {
     uint64 TotalMemoryUsed = 0x0;
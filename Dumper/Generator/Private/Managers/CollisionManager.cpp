@@ -299,4 +299,13 @@ std::string CollisionManager::StringifyName(UEStruct Struct, NameInfo Info)
 	}
 
 	return Name;
-}
\ No newline at end of file
+}
+
+void CollisionManager::Clear()
+{
+	MemberNames.Clear();
+	NameInfos.clear();
+	TranslationMap.clear();
+	ClassReservedNames.clear();
+	ReservedNames.clear();
+}
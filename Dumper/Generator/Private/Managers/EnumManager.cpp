@@ -76,130 +76,135 @@ CollisionInfoIterator EnumInfoHandle::GetMemberCollisionInfoIterator() const
 }
 
 
-void EnumManager::InitInternal()
+void EnumManager::InitObject(UEObject Obj)
 {
-	for (auto Obj : ObjectArray())
+	if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+		return;
+
+	if (Obj.IsA(EClassCastFlags::Struct))
 	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
-			continue;
+		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-		if (Obj.IsA(EClassCastFlags::Struct))
+		for (UEProperty Property : ObjAsStruct.GetProperties())
 		{
-			UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+			if (!Property.IsA(EClassCastFlags::EnumProperty) && !Property.IsA(EClassCastFlags::ByteProperty))
+				continue;
 
-			for (UEProperty Property : ObjAsStruct.GetProperties())
-			{
-				if (!Property.IsA(EClassCastFlags::EnumProperty) && !Property.IsA(EClassCastFlags::ByteProperty))
-					continue;
-
-				UEEnum Enum = nullptr;
-				UEProperty UnderlayingProperty = nullptr;
-
-				if (Property.IsA(EClassCastFlags::EnumProperty))
-				{
-					Enum = Property.Cast<UEEnumProperty>().GetEnum();
-					UnderlayingProperty = Property.Cast<UEEnumProperty>().GetUnderlayingProperty();
+			UEEnum Enum = nullptr;
+			UEProperty UnderlayingProperty = nullptr;
 
-					if (!UnderlayingProperty)
-						continue;
-				}
-				else /* ByteProperty */
-				{
-					Enum = Property.Cast<UEByteProperty>().GetEnum();
-					UnderlayingProperty = Property;
-				}
+			if (Property.IsA(EClassCastFlags::EnumProperty))
+			{
+				Enum = Property.Cast<UEEnumProperty>().GetEnum();
+				UnderlayingProperty = Property.Cast<UEEnumProperty>().GetUnderlayingProperty();
 
-				if (!Enum)
+				if (!UnderlayingProperty)
 					continue;
+			}
+			else /* ByteProperty */
+			{
+				Enum = Property.Cast<UEByteProperty>().GetEnum();
+				UnderlayingProperty = Property;
+			}
 
-				EnumInfo& Info = EnumInfoOverrides[Enum.GetIndex()];
+			if (!Enum)
+				continue;
 
-				Info.bWasInstanceFound = true;
-				Info.UnderlyingTypeSize = 0x1;
+			EnumInfo& Info = EnumInfoOverrides[Enum.GetIndex()];
 
-				/* Check if the size of this enums underlaying type is greater than the default size (0x1) */
-				if (Enum)
-				{
-					Info.UnderlyingTypeSize = Property.GetSize();
-					continue;
-				}
+			Info.bWasInstanceFound = true;
+			Info.UnderlyingTypeSize = 0x1;
 
-				if (UnderlayingProperty)
-				{
-					Info.UnderlyingTypeSize = UnderlayingProperty.GetSize();
-					continue;
-				}
+			/* Check if the size of this enums underlaying type is greater than the default size (0x1) */
+			if (Enum)
+			{
+				Info.UnderlyingTypeSize = Property.GetSize();
+				continue;
+			}
+
+			if (UnderlayingProperty)
+			{
+				Info.UnderlyingTypeSize = UnderlayingProperty.GetSize();
+				continue;
 			}
 		}
-		else if (Obj.IsA(EClassCastFlags::Enum))
-		{
-			UEEnum ObjAsEnum = Obj.Cast<UEEnum>();
+	}
+	else if (Obj.IsA(EClassCastFlags::Enum))
+	{
+		UEEnum ObjAsEnum = Obj.Cast<UEEnum>();
 
-			/* Add name to override info */
-			EnumInfo& NewOrExistingInfo = EnumInfoOverrides[Obj.GetIndex()];
-			NewOrExistingInfo.Name = UniqueEnumNameTable.FindOrAdd(ObjAsEnum.GetEnumPrefixedName()).first;
+		/* Add name to override info */
+		EnumInfo& NewOrExistingInfo = EnumInfoOverrides[Obj.GetIndex()];
+		NewOrExistingInfo.Name = UniqueEnumNameTable.FindOrAdd(ObjAsEnum.GetEnumPrefixedName()).first;
 
-			uint64 EnumMaxValue = 0x0;
+		uint64 EnumMaxValue = 0x0;
 
-			/* Initialize enum-member names and their collision infos */
-			std::vector<std::pair<FName, int64>> NameValuePairs = ObjAsEnum.GetNameValuePairs();
-			for (int i = 0; i < NameValuePairs.size(); i++)
-			{
-				auto& [Name, Value] = NameValuePairs[i];
+		/* Initialize enum-member names and their collision infos */
+		std::vector<std::pair<FName, int64>> NameValuePairs = ObjAsEnum.GetNameValuePairs();
+		for (int i = 0; i < NameValuePairs.size(); i++)
+		{
+			auto& [Name, Value] = NameValuePairs[i];
 
-				std::wstring NameWitPrefix = Name.ToWString();
+			std::wstring NameWitPrefix = Name.ToWString();
 
-				if (!NameWitPrefix.ends_with(L"_MAX"))
-					EnumMaxValue = max(EnumMaxValue, Value);
+			if (!NameWitPrefix.ends_with(L"_MAX"))
+				EnumMaxValue = max(EnumMaxValue, Value);
 
-				auto [NameIndex, bWasInserted] = UniqueEnumValueNames.FindOrAdd(MakeNameValid(NameWitPrefix.substr(NameWitPrefix.find_last_of(L"::") + 1)));
+			auto [NameIndex, bWasInserted] = UniqueEnumValueNames.FindOrAdd(MakeNameValid(NameWitPrefix.substr(NameWitPrefix.find_last_of(L"::") + 1)));
 
-				EnumCollisionInfo CurrentEnumValueInfo;
-				CurrentEnumValueInfo.MemberName = NameIndex;
-				CurrentEnumValueInfo.MemberValue = Value;
+			EnumCollisionInfo CurrentEnumValueInfo;
+			CurrentEnumValueInfo.MemberName = NameIndex;
+			CurrentEnumValueInfo.MemberValue = Value;
 
-				if (bWasInserted) [[likely]]
-				{
-					NewOrExistingInfo.MemberInfos.push_back(CurrentEnumValueInfo);
-					continue;
-				}
+			if (bWasInserted) [[likely]]
+			{
+				NewOrExistingInfo.MemberInfos.push_back(CurrentEnumValueInfo);
+				continue;
+			}
 
-				/* A value with this name exists globally, now check if it also exists localy (aka. is duplicated) */
-				for (int j = 0; j < i; j++)
-				{
-					EnumCollisionInfo& CrosscheckedInfo = NewOrExistingInfo.MemberInfos[j];
+			/* A value with this name exists globally, now check if it also exists localy (aka. is duplicated) */
+			for (int j = 0; j < i; j++)
+			{
+				EnumCollisionInfo& CrosscheckedInfo = NewOrExistingInfo.MemberInfos[j];
 
-					if (CrosscheckedInfo.MemberName != NameIndex) [[likely]]
-						continue;
+				if (CrosscheckedInfo.MemberName != NameIndex) [[likely]]
+					continue;
 
-					/* Duplicate was found */
-					CurrentEnumValueInfo.CollisionCount = CrosscheckedInfo.CollisionCount + 1;
-					break;
-				}
+				/* Duplicate was found */
+				CurrentEnumValueInfo.CollisionCount = CrosscheckedInfo.CollisionCount + 1;
+				break;
+			}
 
-				/* Check if this name is illegal */
-				for (HashStringTableIndex IllegalIndex : IllegalNames)
+			/* Check if this name is illegal */
+			for (HashStringTableIndex IllegalIndex : IllegalNames)
+			{
+				if (NameIndex == IllegalIndex) [[unlikely]]
 				{
-					if (NameIndex == IllegalIndex) [[unlikely]]
-					{
-						CurrentEnumValueInfo.CollisionCount++;
-						break;
-					}
+					CurrentEnumValueInfo.CollisionCount++;
+					break;
 				}
-
-				NewOrExistingInfo.MemberInfos.push_back(CurrentEnumValueInfo);
 			}
 
-			/* Initialize the size based on the highest value contained by this enum */
-			if (!NewOrExistingInfo.bWasEnumSizeInitialized && !NewOrExistingInfo.bWasInstanceFound)
-			{
-				EnumInitHelper::SetEnumSizeForValue(NewOrExistingInfo.UnderlyingTypeSize, EnumMaxValue);
-				NewOrExistingInfo.bWasEnumSizeInitialized = true;
-			}
+			NewOrExistingInfo.MemberInfos.push_back(CurrentEnumValueInfo);
+		}
+
+		/* Initialize the size based on the highest value contained by this enum */
+		if (!NewOrExistingInfo.bWasEnumSizeInitialized && !NewOrExistingInfo.bWasInstanceFound)
+		{
+			EnumInitHelper::SetEnumSizeForValue(NewOrExistingInfo.UnderlyingTypeSize, EnumMaxValue);
+			NewOrExistingInfo.bWasEnumSizeInitialized = true;
 		}
 	}
 }
 
+void EnumManager::InitInternal()
+{
+	for (auto Obj : ObjectArray())
+	{
+		InitObject(Obj);
+	}
+}
+
 void EnumManager::InitIllegalNames()
 {
 	IllegalNames.push_back(UniqueEnumValueNames.FindOrAdd("IN").first);
@@ -226,4 +231,23 @@ void EnumManager::Init()
 
 	InitIllegalNames(); // call this first
 	InitInternal();
-}
\ No newline at end of file
+}
+
+void EnumManager::AddNewObjects(const std::vector<int32>& ObjectIndices)
+{
+	/* Enums are initialized in the order of their indices, just like in Init() */
+	for (int32 Index : ObjectIndices)
+	{
+		InitObject(ObjectArray::GetByIndex(Index));
+	}
+}
+
+void EnumManager::Reset()
+{
+	UniqueEnumNameTable.Clear();
+	EnumInfoOverrides.clear();
+	UniqueEnumValueNames.Clear();
+	IllegalNames.clear();
+
+	bIsInitialized = false;
+}
@@ -242,104 +242,114 @@ namespace PackageManagerUtils
 	}
 }
 
-void PackageManager::InitDependencies()
+void PackageManager::InitDependencies(UEObject Obj)
 {
-	// Collects all packages required to compile this file
+	if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+		return;
 
-	for (auto Obj : ObjectArray())
-	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
-			continue;
+	int32 CurrentPackageIdx = Obj.GetPackageIndex();
 
-		int32 CurrentPackageIdx = Obj.GetPackageIndex();
+	const bool bIsStruct = Obj.IsA(EClassCastFlags::Struct);
+	const bool bIsClass = Obj.IsA(EClassCastFlags::Class);
 
-		const bool bIsStruct = Obj.IsA(EClassCastFlags::Struct);
-		const bool bIsClass = Obj.IsA(EClassCastFlags::Class);
+	const bool bIsFunction = Obj.IsA(EClassCastFlags::Function);
+	const bool bIsEnum = Obj.IsA(EClassCastFlags::Enum);
 
-		const bool bIsFunction = Obj.IsA(EClassCastFlags::Function);
-		const bool bIsEnum = Obj.IsA(EClassCastFlags::Enum);
+	if (bIsStruct && !bIsFunction)
+	{
+		PackageInfo& Info = PackageInfos[CurrentPackageIdx];
+		Info.PackageIndex = CurrentPackageIdx;
 
-		if (bIsStruct && !bIsFunction)
-		{
-			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
-			Info.PackageIndex = CurrentPackageIdx;
+		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-			UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+		const int32 StructIdx = ObjAsStruct.GetIndex();
+		const int32 StructPackageIdx = ObjAsStruct.GetPackageIndex();
 
-			const int32 StructIdx = ObjAsStruct.GetIndex();
-			const int32 StructPackageIdx = ObjAsStruct.GetPackageIndex();
+		DependencyListType& PackageDependencyList = bIsClass ? Info.PackageDependencies.ClassesDependencies : Info.PackageDependencies.StructsDependencies;
+		DependencyManager& ClassOrStructDependencyList = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
 
-			DependencyListType& PackageDependencyList = bIsClass ? Info.PackageDependencies.ClassesDependencies : Info.PackageDependencies.StructsDependencies;
-			DependencyManager& ClassOrStructDependencyList = bIsClass ? Info.ClassesSorted : Info.StructsSorted;
+		std::unordered_set<int32> Dependencies = PackageManagerUtils::GetDependencies(ObjAsStruct, StructIdx);
 
-			std::unordered_set<int32> Dependencies = PackageManagerUtils::GetDependencies(ObjAsStruct, StructIdx);
+		ClassOrStructDependencyList.SetExists(StructIdx);
 
-			ClassOrStructDependencyList.SetExists(StructIdx);
+		PackageManagerUtils::SetPackageDependencies(PackageDependencyList, Dependencies, StructPackageIdx, bIsClass);
 
-			PackageManagerUtils::SetPackageDependencies(PackageDependencyList, Dependencies, StructPackageIdx, bIsClass);
+		if (!bIsClass)
+			PackageManagerUtils::AddStructDependencies(ClassOrStructDependencyList, Dependencies, StructIdx, StructPackageIdx);
 
-			if (!bIsClass)
-				PackageManagerUtils::AddStructDependencies(ClassOrStructDependencyList, Dependencies, StructIdx, StructPackageIdx);
+		/* for both struct and class */
+		if (UEStruct Super = ObjAsStruct.GetSuper())
+		{
+			const int32 SuperPackageIdx = Super.GetPackageIndex();
 
-			/* for both struct and class */
-			if (UEStruct Super = ObjAsStruct.GetSuper())
+			if (SuperPackageIdx == StructPackageIdx)
 			{
-				const int32 SuperPackageIdx = Super.GetPackageIndex();
-
-				if (SuperPackageIdx == StructPackageIdx)
-				{
-					/* In-file sorting is only required if the super-class is inside of the same package */
-					ClassOrStructDependencyList.AddDependency(Obj.GetIndex(), Super.GetIndex());
-				}
-				else
-				{
-					/* A package can't depend on itself, super of a structs will always be in _"structs" file, same for classes and "_classes" files */
-					RequirementInfo& ReqInfo = PackageDependencyList[SuperPackageIdx];
-					BooleanOrEqual(ReqInfo.bShouldIncludeStructs, !bIsClass);
-					BooleanOrEqual(ReqInfo.bShouldIncludeClasses, bIsClass);
-				}
+				/* In-file sorting is only required if the super-class is inside of the same package */
+				ClassOrStructDependencyList.AddDependency(Obj.GetIndex(), Super.GetIndex());
 			}
-
-			if (!bIsClass)
-				continue;
-			
-			/* Add class-functions to package */
-			for (UEFunction Func : ObjAsStruct.GetFunctions())
+			else
 			{
-				Info.Functions.push_back(Func.GetIndex());
+				/* A package can't depend on itself, super of a structs will always be in _"structs" file, same for classes and "_classes" files */
+				RequirementInfo& ReqInfo = PackageDependencyList[SuperPackageIdx];
+				BooleanOrEqual(ReqInfo.bShouldIncludeStructs, !bIsClass);
+				BooleanOrEqual(ReqInfo.bShouldIncludeClasses, bIsClass);
+			}
+		}
 
-				std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(Func, Func.GetIndex());
+		if (!bIsClass)
+			return;
+		
+		/* Add class-functions to package */
+		for (UEFunction Func : ObjAsStruct.GetFunctions())
+		{
+			Info.Functions.push_back(Func.GetIndex());
 
-				BooleanOrEqual(Info.bHasParams, Func.HasMembers());
+			std::unordered_set<int32> ParamDependencies = PackageManagerUtils::GetDependencies(Func, Func.GetIndex());
 
-				const int32 FuncPackageIndex = Func.GetPackageIndex();
+			BooleanOrEqual(Info.bHasParams, Func.HasMembers());
 
-				/* Add dependencies to ParamDependencies and add enums only to class dependencies (forwarddeclaration of enum classes defaults to int) */
-				PackageManagerUtils::SetPackageDependencies(Info.PackageDependencies.ParametersDependencies, ParamDependencies, FuncPackageIndex, true);
-				PackageManagerUtils::AddEnumPackageDependencies(Info.PackageDependencies.ClassesDependencies, ParamDependencies, FuncPackageIndex, true);
-			}
-		}
-		else if (bIsEnum)
-		{
-			PackageInfo& Info = PackageInfos[CurrentPackageIdx];
-			Info.PackageIndex = CurrentPackageIdx;
+			const int32 FuncPackageIndex = Func.GetPackageIndex();
 
-			Info.Enums.push_back(Obj.GetIndex());
+			/* Add dependencies to ParamDependencies and add enums only to class dependencies (forwarddeclaration of enum classes defaults to int) */
+			PackageManagerUtils::SetPackageDependencies(Info.PackageDependencies.ParametersDependencies, ParamDependencies, FuncPackageIndex, true);
+			PackageManagerUtils::AddEnumPackageDependencies(Info.PackageDependencies.ClassesDependencies, ParamDependencies, FuncPackageIndex, true);
 		}
 	}
+	else if (bIsEnum)
+	{
+		PackageInfo& Info = PackageInfos[CurrentPackageIdx];
+		Info.PackageIndex = CurrentPackageIdx;
+
+		Info.Enums.push_back(Obj.GetIndex());
+	}
 }
 
-void PackageManager::InitNames()
+void PackageManager::InitDependencies()
 {
-	for (auto& [PackageIdx, Info] : PackageInfos)
+	// Collects all packages required to compile this file
+
+	for (auto Obj : ObjectArray())
 	{
-		std::string PackageName = ObjectArray::GetByIndex(PackageIdx).GetValidName();
+		InitDependencies(Obj);
+	}
+}
+
+void PackageManager::InitName(int32 PackageIdx, PackageInfo& Info)
+{
+	std::string PackageName = ObjectArray::GetByIndex(PackageIdx).GetValidName();
 
-		auto [Name, bWasInserted] = UniquePackageNameTable.FindOrAdd(PackageName);
-		Info.Name = Name;
+	auto [Name, bWasInserted] = UniquePackageNameTable.FindOrAdd(PackageName);
+	Info.Name = Name;
 
-		if (!bWasInserted) [[unlikely]]
-			Info.CollisionCount = UniquePackageNameTable[Name].GetCollisionCount().CollisionCount;
+	if (!bWasInserted) [[unlikely]]
+		Info.CollisionCount = UniquePackageNameTable[Name].GetCollisionCount().CollisionCount;
+}
+
+void PackageManager::InitNames()
+{
+	for (auto& [PackageIdx, Info] : PackageInfos)
+	{
+		InitName(PackageIdx, Info);
 	}
 }
 
@@ -435,7 +445,7 @@ void PackageManager::HelperInitEnumFwdDeclarationsForPackage(int32 PackageForFwd
 }
 
 /* Safe to use StructManager, initialization is guaranteed to have been finished */
-void PackageManager::HandleCycles()
+void PackageManager::HandleCycles(std::unordered_set<int32>* OutModifiedPackages)
 {
 	struct CycleInfo
 	{
@@ -551,6 +561,13 @@ void PackageManager::HandleCycles()
 		const PackageInfoHandle CurrentPackageInfo = GetInfo(Cycle.CurrentPackage);
 		const PackageInfoHandle PreviousPackageInfo = GetInfo(Cycle.PreviousPacakge);
 
+		/* Structs of either package might have been marked as cyclic */
+		if (OutModifiedPackages)
+		{
+			OutModifiedPackages->insert(Cycle.CurrentPackage);
+			OutModifiedPackages->insert(Cycle.PreviousPacakge);
+		}
+
 		/* Add enum forward declarations to the package from which we remove the dependency, as enums are not considered by those dependencies */
 		HelperInitEnumFwdDeclarationsForPackage(Cycle.CurrentPackage, Cycle.PreviousPacakge, Cycle.bAreStructsCyclic);
 
@@ -599,6 +616,40 @@ void PackageManager::PostInit()
 	HandleCycles();
 }
 
+void PackageManager::AddNewObjects(const std::vector<int32>& ObjectIndices, std::unordered_set<int32>& OutModifiedPackages)
+{
+	std::vector<int32> NewPackages;
+
+	for (int32 Index : ObjectIndices)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		const int32 PackageIdx = Obj.GetPackageIndex();
+		const bool bIsNewPackage = !PackageInfos.contains(PackageIdx);
+
+		InitDependencies(Obj);
+
+		if (bIsNewPackage && PackageInfos.contains(PackageIdx))
+			NewPackages.push_back(PackageIdx);
+	}
+
+	for (int32 PackageIdx : NewPackages)
+		InitName(PackageIdx, PackageInfos.at(PackageIdx));
+
+	/* Cycles found before were already removed from the dependency-graph, so only cycles caused by the new objects are handled here */
+	HandleCycles(&OutModifiedPackages);
+}
+
+void PackageManager::Reset()
+{
+	UniquePackageNameTable.Clear();
+	PackageInfos.clear();
+	CurrentIterationHitCount = 0x0;
+
+	bIsInitialized = false;
+	bIsPostInitialized = false;
+}
+
 void PackageManager::IterateSingleDependencyImplementation(SingleDependencyIterationParamsInternal& Params, bool bCheckForCycle)
 {
 	if (!Params.bShouldHandlePackage)
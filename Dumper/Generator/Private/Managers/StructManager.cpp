@@ -53,180 +53,195 @@ bool StructInfoHandle::IsPartOfCyclicPackage() const
 	return Info->bIsPartOfCyclicPackage;
 }
 
-void StructManager::InitAlignmentsAndNames()
+void StructManager::InitAlignmentAndName(UEObject Obj, const UEClass InterfaceClass)
 {
 	constexpr int32 DefaultClassAlignment = 0x8;
 
-	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+	UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-	for (auto Obj : ObjectArray())
+	// Add name to override info
+	StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
+	NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(Obj.GetCppName(), !Obj.IsA(EClassCastFlags::Function)).first;
+
+	// Interfaces inherit from UObject by default, but as a workaround to no virtual-inheritance we make them empty
+	if (ObjAsStruct.HasType(InterfaceClass))
 	{
-		if (!Obj.IsA(EClassCastFlags::Struct) /* || Obj.IsA(EClassCastFlags::Function)*/)
-			continue;
+		NewOrExistingInfo.Alignment = 0x1;
+		NewOrExistingInfo.bHasReusedTrailingPadding = false;
+		NewOrExistingInfo.bIsFinal = true;
+		NewOrExistingInfo.Size = 0x0;
 
-		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+		return;
+	}
 
-		// Add name to override info
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
-		NewOrExistingInfo.Name = UniqueNameTable.FindOrAdd(Obj.GetCppName(), !Obj.IsA(EClassCastFlags::Function)).first;
+	int32 MinAlignment = ObjAsStruct.GetMinAlignment();
+	int32 HighestMemberAlignment = 0x1; // starting at 0x1 when checking **all**, not just struct-properties
 
-		// Interfaces inherit from UObject by default, but as a workaround to no virtual-inheritance we make them empty
-		if (ObjAsStruct.HasType(InterfaceClass))
-		{
-			NewOrExistingInfo.Alignment = 0x1;
-			NewOrExistingInfo.bHasReusedTrailingPadding = false;
-			NewOrExistingInfo.bIsFinal = true;
-			NewOrExistingInfo.Size = 0x0;
+	// Find member with the highest alignment
+	for (UEProperty Property : ObjAsStruct.GetProperties())
+	{
+		int32 CurrentPropertyAlignment = Property.GetAlignment();
 
-			continue;
-		}
+		if (CurrentPropertyAlignment > HighestMemberAlignment)
+			HighestMemberAlignment = CurrentPropertyAlignment;
+	}
 
-		int32 MinAlignment = ObjAsStruct.GetMinAlignment();
-		int32 HighestMemberAlignment = 0x1; // starting at 0x1 when checking **all**, not just struct-properties
+	/* On some strange games there are BlueprintGeneratedClass UClasses which don't inherit from UObject. */
+	const bool bHasSuperClass = static_cast<bool>(ObjAsStruct.GetSuper());
 
-		// Find member with the highest alignment
-		for (UEProperty Property : ObjAsStruct.GetProperties())
-		{
-			int32 CurrentPropertyAlignment = Property.GetAlignment();
+	// if Class alignment is below pointer-alignment (0x8), use pointer-alignment instead, else use whichever, MinAlignment or HighestAlignment, is bigger
+	if (ObjAsStruct.IsA(EClassCastFlags::Class) && bHasSuperClass && HighestMemberAlignment < DefaultClassAlignment)
+	{
+		NewOrExistingInfo.bUseExplicitAlignment = false;
+		NewOrExistingInfo.Alignment = DefaultClassAlignment;
+	}
+	else
+	{
+		NewOrExistingInfo.bUseExplicitAlignment = MinAlignment > HighestMemberAlignment;
+		NewOrExistingInfo.Alignment = max(MinAlignment, HighestMemberAlignment);
+	}
+}
 
-			if (CurrentPropertyAlignment > HighestMemberAlignment)
-				HighestMemberAlignment = CurrentPropertyAlignment;
-		}
+void StructManager::InitSuperAlignments(UEObject Obj)
+{
+	UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-		/* On some strange games there are BlueprintGeneratedClass UClasses which don't inherit from UObject. */
-		const bool bHasSuperClass = static_cast<bool>(ObjAsStruct.GetSuper());
+	constexpr int MaxNumSuperClasses = 0x30;
 
-		// if Class alignment is below pointer-alignment (0x8), use pointer-alignment instead, else use whichever, MinAlignment or HighestAlignment, is bigger
-		if (ObjAsStruct.IsA(EClassCastFlags::Class) && bHasSuperClass && HighestMemberAlignment < DefaultClassAlignment)
-		{
-			NewOrExistingInfo.bUseExplicitAlignment = false;
-			NewOrExistingInfo.Alignment = DefaultClassAlignment;
-		}
-		else
-		{
-			NewOrExistingInfo.bUseExplicitAlignment = MinAlignment > HighestMemberAlignment;
-			NewOrExistingInfo.Alignment = max(MinAlignment, HighestMemberAlignment);
-		}
-	}
+	std::array<UEStruct, MaxNumSuperClasses> StructStack;
+	int32 NumElementsInStructStack = 0x0;
 
-	for (auto Obj : ObjectArray())
+	// Get a top to bottom list of a struct and all of its supers
+	for (UEStruct S = ObjAsStruct; S; S = S.GetSuper())
 	{
-		if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function) || Obj.Cast<UEStruct>().HasType(InterfaceClass))
-			continue;
-
-		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+		StructStack[NumElementsInStructStack] = S;
+		NumElementsInStructStack++;
+	}
 
-		constexpr int MaxNumSuperClasses = 0x30;
+	int32 CurrentHighestAlignment = 0x0;
 
-		std::array<UEStruct, MaxNumSuperClasses> StructStack;
-		int32 NumElementsInStructStack = 0x0;
+	for (int i = NumElementsInStructStack - 1; i >= 0; i--)
+	{
+		StructInfo& Info = StructInfoOverrides[StructStack[i].GetIndex()];
 
-		// Get a top to bottom list of a struct and all of its supers
-		for (UEStruct S = ObjAsStruct; S; S = S.GetSuper())
+		if (CurrentHighestAlignment < Info.Alignment)
 		{
-			StructStack[NumElementsInStructStack] = S;
-			NumElementsInStructStack++;
+			CurrentHighestAlignment = Info.Alignment;
 		}
-
-		int32 CurrentHighestAlignment = 0x0;
-
-		for (int i = NumElementsInStructStack - 1; i >= 0; i--)
+		else
 		{
-			StructInfo& Info = StructInfoOverrides[StructStack[i].GetIndex()];
-
-			if (CurrentHighestAlignment < Info.Alignment)
-			{
-				CurrentHighestAlignment = Info.Alignment;
-			}
-			else
-			{
-				// We use the super classes' alignment, no need to explicitely set it
-				Info.bUseExplicitAlignment = false; 
-				Info.Alignment = CurrentHighestAlignment;
-			}
+			// We use the super classes' alignment, no need to explicitely set it
+			Info.bUseExplicitAlignment = false; 
+			Info.Alignment = CurrentHighestAlignment;
 		}
 	}
 }
 
-void StructManager::InitSizesAndIsFinal()
+void StructManager::InitSizeAndIsFinal(UEObject Obj)
 {
-	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+	UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
 
-	for (auto Obj : ObjectArray())
-	{
-		if (!Obj.IsA(EClassCastFlags::Struct) || Obj.Cast<UEStruct>().HasType(InterfaceClass))
-			continue;
+	StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
 
-		UEStruct ObjAsStruct = Obj.Cast<UEStruct>();
+	// Initialize struct-size if it wasn't set already
+	if (NewOrExistingInfo.Size > ObjAsStruct.GetStructSize())
+		NewOrExistingInfo.Size = ObjAsStruct.GetStructSize();
 
-		StructInfo& NewOrExistingInfo = StructInfoOverrides[Obj.GetIndex()];
+	UEStruct Super = ObjAsStruct.GetSuper();
 
-		// Initialize struct-size if it wasn't set already
-		if (NewOrExistingInfo.Size > ObjAsStruct.GetStructSize())
-			NewOrExistingInfo.Size = ObjAsStruct.GetStructSize();
+	if (NewOrExistingInfo.Size == 0x0 && Super != nullptr)
+		NewOrExistingInfo.Size = Super.GetStructSize();
 
-		UEStruct Super = ObjAsStruct.GetSuper();
+	int32 LastMemberEnd = 0x0;
+	int32 LowestOffset = INT_MAX;
 
-		if (NewOrExistingInfo.Size == 0x0 && Super != nullptr)
-			NewOrExistingInfo.Size = Super.GetStructSize();
+	// Find member with the lowest offset
+	for (UEProperty Property : ObjAsStruct.GetProperties())
+	{
+		const int32 PropertyOffset = Property.GetOffset();
+		const int32 PropertySize = Property.GetSize();
 
-		int32 LastMemberEnd = 0x0;
-		int32 LowestOffset = INT_MAX;
+		if (PropertyOffset < LowestOffset)
+			LowestOffset = PropertyOffset;
 
-		// Find member with the lowest offset
-		for (UEProperty Property : ObjAsStruct.GetProperties())
-		{
-			const int32 PropertyOffset = Property.GetOffset();
-			const int32 PropertySize = Property.GetSize();
+		if ((PropertyOffset + PropertySize) > LastMemberEnd)
+			LastMemberEnd = PropertyOffset + PropertySize;
+	}
 
-			if (PropertyOffset < LowestOffset)
-				LowestOffset = PropertyOffset;
+	/* No need to check any other structs, as finding the LastMemberEnd only involves this struct */
+	NewOrExistingInfo.LastMemberEnd = LastMemberEnd;
 
-			if ((PropertyOffset + PropertySize) > LastMemberEnd)
-				LastMemberEnd = PropertyOffset + PropertySize;
+	if (!Super || Obj.IsA(EClassCastFlags::Function))
+		return;
+
+	/*
+	* Loop all super-structs and set their struct-size to the lowest offset we found. Sets this size on the direct Super and all higher *empty* supers
+	* 
+	* breaks out of the loop after encountering a super-struct which is not empty (aka. has member-variables)
+	*/
+	for (UEStruct S = Super; S; S = S.GetSuper())
+	{
+		auto It = StructInfoOverrides.find(S.GetIndex());
+
+		if (It == StructInfoOverrides.end())
+		{
+			std::cout << "\n\n\nDumper-7: Error, struct wasn't found in 'StructInfoOverrides'! Exiting...\n\n\n" << std::endl;
+			Sleep(10000);
+			exit(1);
 		}
 
-		/* No need to check any other structs, as finding the LastMemberEnd only involves this struct */
-		NewOrExistingInfo.LastMemberEnd = LastMemberEnd;
+		StructInfo& Info = It->second;
 
-		if (!Super || Obj.IsA(EClassCastFlags::Function))
-			continue;
+		// Struct is not final, as it is another structs' super
+		Info.bIsFinal = false;
+
+		const int32 SizeToCheck = Info.Size == INT_MAX ? S.GetStructSize() : Info.Size;
 
-		/*
-		* Loop all super-structs and set their struct-size to the lowest offset we found. Sets this size on the direct Super and all higher *empty* supers
-		* 
-		* breaks out of the loop after encountering a super-struct which is not empty (aka. has member-variables)
-		*/
-		for (UEStruct S = Super; S; S = S.GetSuper())
+		// Only change lowest offset if it's lower than the already found lowest offset (by default: struct-size)
+		if (Align(SizeToCheck, Info.Alignment) > LowestOffset)
 		{
-			auto It = StructInfoOverrides.find(S.GetIndex());
+			if (Info.Size > LowestOffset)
+				Info.Size = LowestOffset;
 
-			if (It == StructInfoOverrides.end())
-			{
-				std::cout << "\n\n\nDumper-7: Error, struct wasn't found in 'StructInfoOverrides'! Exiting...\n\n\n" << std::endl;
-				Sleep(10000);
-				exit(1);
-			}
+			Info.bHasReusedTrailingPadding = true;
+		}
 
-			StructInfo& Info = It->second;
+		if (S.HasMembers())
+			break;
+	}
+}
 
-			// Struct is not final, as it is another structs' super
-			Info.bIsFinal = false;
+void StructManager::InitAlignmentsAndNames()
+{
+	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
 
-			const int32 SizeToCheck = Info.Size == INT_MAX ? S.GetStructSize() : Info.Size;
+	for (auto Obj : ObjectArray())
+	{
+		if (!Obj.IsA(EClassCastFlags::Struct) /* || Obj.IsA(EClassCastFlags::Function)*/)
+			continue;
 
-			// Only change lowest offset if it's lower than the already found lowest offset (by default: struct-size)
-			if (Align(SizeToCheck, Info.Alignment) > LowestOffset)
-			{
-				if (Info.Size > LowestOffset)
-					Info.Size = LowestOffset;
+		InitAlignmentAndName(Obj, InterfaceClass);
+	}
 
-				Info.bHasReusedTrailingPadding = true;
-			}
+	for (auto Obj : ObjectArray())
+	{
+		if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function) || Obj.Cast<UEStruct>().HasType(InterfaceClass))
+			continue;
 
-			if (S.HasMembers())
-				break;
-		}
+		InitSuperAlignments(Obj);
+	}
+}
+
+void StructManager::InitSizesAndIsFinal()
+{
+	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+
+	for (auto Obj : ObjectArray())
+	{
+		if (!Obj.IsA(EClassCastFlags::Struct) || Obj.Cast<UEStruct>().HasType(InterfaceClass))
+			continue;
+
+		InitSizeAndIsFinal(Obj);
 	}
 }
 
@@ -253,3 +268,42 @@ void StructManager::Init()
 	if (const UEObject UStructClass = ObjectArray::FindClassFast("struct"))
 		StructInfoOverrides.find(UStructClass.GetIndex())->second.Name = UniqueNameTable.FindOrAdd(std::string("UStruct"), false).first;
 }
+
+void StructManager::AddNewObjects(const std::vector<int32>& ObjectIndices)
+{
+	const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
+
+	/* Same passes as in Init(), but only for the new structs. Infos of their supers are updated as well. */
+	for (int32 Index : ObjectIndices)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (Obj.IsA(EClassCastFlags::Struct))
+			InitAlignmentAndName(Obj, InterfaceClass);
+	}
+
+	for (int32 Index : ObjectIndices)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (Obj.IsA(EClassCastFlags::Struct) && !Obj.IsA(EClassCastFlags::Function) && !Obj.Cast<UEStruct>().HasType(InterfaceClass))
+			InitSuperAlignments(Obj);
+	}
+
+	for (int32 Index : ObjectIndices)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (Obj.IsA(EClassCastFlags::Struct) && !Obj.Cast<UEStruct>().HasType(InterfaceClass))
+			InitSizeAndIsFinal(Obj);
+	}
+}
+
+void StructManager::Reset()
+{
+	UniqueNameTable.Clear();
+	StructInfoOverrides.clear();
+	CyclicStructsAndPackages.clear();
+
+	bIsInitialized = false;
+}
@@ -0,0 +1,395 @@
+
+#include "Managers/TypeManager.h"
+#include "Managers/StructManager.h"
+
+#include "../Settings.h"
+
+
+TypeInfoHandle::TypeInfoHandle(int32 Index)
+	: TypeIndex(Index)
+{
+}
+
+bool TypeInfoHandle::IsValid() const
+{
+	return TypeIndex != -1;
+}
+
+int32 TypeInfoHandle::GetIndex() const
+{
+	return TypeIndex;
+}
+
+const void* TypeInfoHandle::GetPropertyClassAddress() const
+{
+	return TypeManager::TypeInfos[TypeIndex].PropertyClass;
+}
+
+EClassCastFlags TypeInfoHandle::GetCastFlags() const
+{
+	return TypeManager::TypeInfos[TypeIndex].CastFlags;
+}
+
+EMappingsTypeFlags TypeInfoHandle::GetMappingType() const
+{
+	return TypeManager::TypeInfos[TypeIndex].MappingType;
+}
+
+int32 TypeInfoHandle::GetReferencedIndex() const
+{
+	return TypeManager::TypeInfos[TypeIndex].ReferencedIndex;
+}
+
+const void* TypeInfoHandle::GetReferencedFieldClassAddress() const
+{
+	return TypeManager::TypeInfos[TypeIndex].ReferencedFieldClass;
+}
+
+TypeInfoHandle TypeInfoHandle::GetInnerType(int32 InnerIndex) const
+{
+	return TypeInfoHandle(TypeManager::TypeInfos[TypeIndex].InnerTypes[InnerIndex]);
+}
+
+bool TypeInfoHandle::HasTypeModifier() const
+{
+	return TypeManager::TypeInfos[TypeIndex].bHasTypeModifier;
+}
+
+bool TypeInfoHandle::MayBeCyclic() const
+{
+	return TypeManager::TypeInfos[TypeIndex].bMayBeCyclic;
+}
+
+std::string TypeInfoHandle::GetPropertyClassCppName() const
+{
+	void* PropertyClass = const_cast<void*>(GetPropertyClassAddress());
+
+	if (Settings::Internal::bUseFProperty)
+		return UEFFieldClass(PropertyClass).GetCppName();
+
+	return UEClass(PropertyClass).GetCppName();
+}
+
+
+size_t TypeManager::TypeKeyHasher::operator()(const TypeKey& Key) const
+{
+	/* Same as boost::hash_combine */
+	auto HashCombine = [](size_t& Seed, size_t Value) -> void
+	{
+		Seed ^= Value + 0x9E3779B97F4A7C15ull + (Seed << 6) + (Seed >> 2);
+	};
+
+	size_t Hash = std::hash<const void*>()(Key.PropertyClass);
+	HashCombine(Hash, std::hash<const void*>()(Key.ReferencedFieldClass));
+	HashCombine(Hash, std::hash<int32>()(Key.ReferencedIndex));
+	HashCombine(Hash, std::hash<int32>()(Key.InnerTypes[0]));
+	HashCombine(Hash, std::hash<int32>()(Key.InnerTypes[1]));
+	HashCombine(Hash, Key.bHasTypeModifier);
+
+	return Hash;
+}
+
+EMappingsTypeFlags TypeManager::GetMappingTypeFromFlags(EClassCastFlags Flags)
+{
+	if (Flags & EClassCastFlags::ByteProperty)
+	{
+		return EMappingsTypeFlags::ByteProperty;
+	}
+	else if (Flags & EClassCastFlags::UInt16Property)
+	{
+		return EMappingsTypeFlags::UInt16Property;
+	}
+	else if (Flags & EClassCastFlags::UInt32Property)
+	{
+		return EMappingsTypeFlags::UInt32Property;
+	}
+	else if (Flags & EClassCastFlags::UInt64Property)
+	{
+		return EMappingsTypeFlags::UInt64Property;
+	}
+	else if (Flags & EClassCastFlags::Int8Property)
+	{
+		return EMappingsTypeFlags::Int8Property;
+	}
+	else if (Flags & EClassCastFlags::Int16Property)
+	{
+		return EMappingsTypeFlags::Int16Property;
+	}
+	else if (Flags & EClassCastFlags::IntProperty)
+	{
+		return EMappingsTypeFlags::IntProperty;
+	}
+	else if (Flags & EClassCastFlags::Int64Property)
+	{
+		return EMappingsTypeFlags::Int64Property;
+	}
+	else if (Flags & EClassCastFlags::FloatProperty)
+	{
+		return EMappingsTypeFlags::FloatProperty;
+	}
+	else if (Flags & EClassCastFlags::DoubleProperty)
+	{
+		return EMappingsTypeFlags::DoubleProperty;
+	}
+	else if ((Flags & EClassCastFlags::ObjectProperty) || (Flags & EClassCastFlags::ClassProperty))
+	{
+		return EMappingsTypeFlags::ObjectProperty;
+	}
+	else if (Flags & EClassCastFlags::NameProperty)
+	{
+		return EMappingsTypeFlags::NameProperty;
+	}
+	else if (Flags & EClassCastFlags::StrProperty)
+	{
+		return EMappingsTypeFlags::StrProperty;
+	}
+	else if (Flags & EClassCastFlags::TextProperty)
+	{
+		return EMappingsTypeFlags::TextProperty;
+	}
+	else if (Flags & EClassCastFlags::BoolProperty)
+	{
+		return EMappingsTypeFlags::BoolProperty;
+	}
+	else if (Flags & EClassCastFlags::StructProperty)
+	{
+		return EMappingsTypeFlags::StructProperty;
+	}
+	else if (Flags & EClassCastFlags::ArrayProperty)
+	{
+		return EMappingsTypeFlags::ArrayProperty;
+	}
+	else if (Flags & EClassCastFlags::WeakObjectProperty)
+	{
+		return EMappingsTypeFlags::WeakObjectProperty;
+	}
+	else if (Flags & EClassCastFlags::LazyObjectProperty)
+	{
+		return EMappingsTypeFlags::LazyObjectProperty;
+	}
+	else if ((Flags & EClassCastFlags::SoftObjectProperty) || (Flags & EClassCastFlags::SoftClassProperty))
+	{
+		return EMappingsTypeFlags::SoftObjectProperty;
+	}
+	else if (Flags & EClassCastFlags::MapProperty)
+	{
+		return EMappingsTypeFlags::MapProperty;
+	}
+	else if (Flags & EClassCastFlags::SetProperty)
+	{
+		return EMappingsTypeFlags::SetProperty;
+	}
+	else if (Flags & EClassCastFlags::EnumProperty)
+	{
+		return EMappingsTypeFlags::EnumProperty;
+	}
+	else if (Flags & EClassCastFlags::InterfaceProperty)
+	{
+		return EMappingsTypeFlags::InterfaceProperty;
+	}
+	else if (Flags & EClassCastFlags::FieldPathProperty)
+	{
+		return EMappingsTypeFlags::FieldPathProperty;
+	}
+	else if (Flags & EClassCastFlags::OptionalProperty)
+	{
+		return EMappingsTypeFlags::OptionalProperty;
+	}
+	else if (Flags & EClassCastFlags::MulticastDelegateProperty)
+	{
+		return EMappingsTypeFlags::MulticastDelegateProperty;
+	}
+	else if (Flags & EClassCastFlags::DelegateProperty)
+	{
+		return EMappingsTypeFlags::DelegateProperty;
+	}
+
+	return EMappingsTypeFlags::Unknown;
+}
+
+TypeManager::TypeKey TypeManager::MakeTypeKey(UEProperty Property)
+{
+	static auto GetIndexOrInvalid = [](UEObject Obj) -> int32 { return Obj ? Obj.GetIndex() : -1; };
+	static auto GetTypeOrInvalid = [](UEProperty Prop) -> int32 { return Prop ? FindOrAddType(Prop) : -1; };
+
+	auto [Class, FieldClass] = Property.GetClass();
+
+	const EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
+
+	TypeKey Key = {};
+	Key.PropertyClass = Class ? Class.GetAddress() : FieldClass.GetAddress();
+	Key.ReferencedFieldClass = nullptr;
+	Key.ReferencedIndex = -1;
+	Key.InnerTypes[0] = -1;
+	Key.InnerTypes[1] = -1;
+	Key.bHasTypeModifier = false;
+
+	/* Collects all information any generator could possibly require to create the type-name. Order of checks is the same as in CppGenerator. */
+	if (Flags & EClassCastFlags::ByteProperty)
+	{
+		Key.ReferencedIndex = GetIndexOrInvalid(Property.Cast<UEByteProperty>().GetEnum());
+	}
+	else if (Flags & EClassCastFlags::ClassProperty)
+	{
+		Key.bHasTypeModifier = Property.HasPropertyFlags(EPropertyFlags::UObjectWrapper);
+
+		if (Key.bHasTypeModifier)
+			Key.ReferencedIndex = GetIndexOrInvalid(Property.Cast<UEClassProperty>().GetMetaClass());
+	}
+	else if (Flags & EClassCastFlags::BoolProperty)
+	{
+		Key.bHasTypeModifier = Property.Cast<UEBoolProperty>().IsNativeBool();
+	}
+	else if (Flags & EClassCastFlags::StructProperty)
+	{
+		Key.ReferencedIndex = GetIndexOrInvalid(Property.Cast<UEStructProperty>().GetUnderlayingStruct());
+	}
+	else if (Flags & EClassCastFlags::ArrayProperty)
+	{
+		Key.InnerTypes[0] = GetTypeOrInvalid(Property.Cast<UEArrayProperty>().GetInnerProperty());
+	}
+	else if ((Flags & EClassCastFlags::WeakObjectProperty) || (Flags & EClassCastFlags::LazyObjectProperty) || (Flags & EClassCastFlags::SoftClassProperty)
+		|| (Flags & EClassCastFlags::SoftObjectProperty) || (Flags & EClassCastFlags::ObjectProperty) || (Flags & EClassCastFlags::InterfaceProperty))
+	{
+		Key.ReferencedIndex = GetIndexOrInvalid(Property.Cast<UEObjectProperty>().GetPropertyClass());
+	}
+	else if (Flags & EClassCastFlags::MapProperty)
+	{
+		UEMapProperty AsMapProperty = Property.Cast<UEMapProperty>();
+
+		Key.InnerTypes[0] = GetTypeOrInvalid(AsMapProperty.GetKeyProperty());
+		Key.InnerTypes[1] = GetTypeOrInvalid(AsMapProperty.GetValueProperty());
+	}
+	else if (Flags & EClassCastFlags::SetProperty)
+	{
+		Key.InnerTypes[0] = GetTypeOrInvalid(Property.Cast<UESetProperty>().GetElementProperty());
+	}
+	else if (Flags & EClassCastFlags::EnumProperty)
+	{
+		UEEnumProperty AsEnumProperty = Property.Cast<UEEnumProperty>();
+
+		Key.ReferencedIndex = GetIndexOrInvalid(AsEnumProperty.GetEnum());
+		Key.InnerTypes[0] = GetTypeOrInvalid(AsEnumProperty.GetUnderlayingProperty());
+	}
+	else if (Flags & EClassCastFlags::DelegateProperty)
+	{
+		Key.ReferencedIndex = GetIndexOrInvalid(Property.Cast<UEDelegateProperty>().GetSignatureFunction());
+	}
+	else if (Flags & EClassCastFlags::MulticastInlineDelegateProperty)
+	{
+		Key.ReferencedIndex = GetIndexOrInvalid(Property.Cast<UEMulticastInlineDelegateProperty>().GetSignatureFunction());
+	}
+	else if (Flags & EClassCastFlags::FieldPathProperty)
+	{
+		Key.ReferencedFieldClass = Property.Cast<UEFieldPathProperty>().GetFielClass().GetAddress();
+	}
+	else if (Flags & EClassCastFlags::OptionalProperty)
+	{
+		UEProperty ValueProperty = Property.Cast<UEOptionalProperty>().GetValueProperty();
+
+		Key.InnerTypes[0] = GetTypeOrInvalid(ValueProperty);
+
+		/* Check if there is an additional 'bool' flag in the TOptional to check if the value is set */
+		Key.bHasTypeModifier = ValueProperty && Property.GetSize() > ValueProperty.GetSize();
+	}
+
+	return Key;
+}
+
+int32 TypeManager::FindOrAddType(UEProperty Property)
+{
+	/* Inner types are added, if they didn't exist yet, while the key is created */
+	const TypeKey Key = MakeTypeKey(Property);
+
+	/* Only look the type up if it exists already, as generators may call this concurrently after 'Init()' */
+	if (auto It = TypeLookup.find(Key); It != TypeLookup.end()) [[likely]]
+		return It->second;
+
+	auto [It, bInserted] = TypeLookup.try_emplace(Key, static_cast<int32>(TypeInfos.size()));
+
+	TypeInfo& NewInfo = TypeInfos.emplace_back();
+	NewInfo.PropertyClass = Key.PropertyClass;
+	NewInfo.CastFlags = Property.GetCastFlags();
+	NewInfo.MappingType = GetMappingTypeFromFlags(NewInfo.CastFlags);
+	NewInfo.ReferencedIndex = Key.ReferencedIndex;
+	NewInfo.ReferencedFieldClass = Key.ReferencedFieldClass;
+	NewInfo.InnerTypes[0] = Key.InnerTypes[0];
+	NewInfo.InnerTypes[1] = Key.InnerTypes[1];
+	NewInfo.bHasTypeModifier = Key.bHasTypeModifier;
+
+	if ((NewInfo.CastFlags & EClassCastFlags::StructProperty) && NewInfo.ReferencedIndex != -1)
+		NewInfo.bMayBeCyclic = StructManager::GetInfo(ObjectArray::GetByIndex<UEStruct>(NewInfo.ReferencedIndex)).IsPartOfCyclicPackage();
+
+	for (const int32 InnerIndex : NewInfo.InnerTypes)
+	{
+		if (InnerIndex != -1 && TypeInfos[InnerIndex].bMayBeCyclic)
+			NewInfo.bMayBeCyclic = true;
+	}
+
+	return It->second;
+}
+
+void TypeManager::Init()
+{
+	if (bIsInitialized)
+		return;
+
+	bIsInitialized = true;
+
+	TypeInfos.reserve(0x4000);
+	TypeLookup.reserve(0x4000);
+
+	/* Add all types used by any member, or parameter, in advance. Afterwards generators only ever read from the type-table. */
+	for (UEObject Obj : ObjectArray())
+	{
+		if (!Obj.IsA(EClassCastFlags::Struct))
+			continue;
+
+		for (UEProperty Property : Obj.Cast<UEStruct>().GetProperties())
+			FindOrAddType(Property);
+	}
+}
+
+void TypeManager::AddNewObjects(const std::vector<int32>& ObjectIndices, std::unordered_set<int32>& OutNewlyCyclicTypes)
+{
+	for (int32 Index : ObjectIndices)
+	{
+		UEObject Obj = ObjectArray::GetByIndex(Index);
+
+		if (!Obj.IsA(EClassCastFlags::Struct))
+			continue;
+
+		for (UEProperty Property : Obj.Cast<UEStruct>().GetProperties())
+			FindOrAddType(Property);
+	}
+
+	/* New objects can make existing packages cyclic, so existing types referencing structs in those packages may be cyclic now as well */
+	for (int32 i = 0; i < static_cast<int32>(TypeInfos.size()); i++)
+	{
+		TypeInfo& Info = TypeInfos[i];
+
+		if (Info.bMayBeCyclic)
+			continue;
+
+		if ((Info.CastFlags & EClassCastFlags::StructProperty) && Info.ReferencedIndex != -1)
+			Info.bMayBeCyclic = StructManager::GetInfo(ObjectArray::GetByIndex<UEStruct>(Info.ReferencedIndex)).IsPartOfCyclicPackage();
+
+		/* Inner types are always added before the types containing them, so they were already updated */
+		for (const int32 InnerIndex : Info.InnerTypes)
+		{
+			if (InnerIndex != -1 && TypeInfos[InnerIndex].bMayBeCyclic)
+				Info.bMayBeCyclic = true;
+		}
+
+		if (Info.bMayBeCyclic)
+			OutNewlyCyclicTypes.insert(i);
+	}
+}
+
+void TypeManager::Reset()
+{
+	TypeInfos.clear();
+	TypeLookup.clear();
+
+	bIsInitialized = false;
+}
@@ -10,6 +10,7 @@
 #include "Wrappers/MemberWrappers.h"
 #include "Wrappers/EnumWrapper.h"
 #include "Managers/PackageManager.h"
+#include "Managers/TypeManager.h"
 
 #include "HashStringTable.h"
 #include "Generator.h"
@@ -48,6 +49,18 @@ private:
         std::vector<ParamInfo> UnrealFuncParams; // for unreal-functions only
     };
 
+    /* Content of a package that is generated, only differs from the PackageInfo if the SDK is tree-shaken */
+    struct PackageContent
+    {
+        bool bHasStructs = false;
+        bool bHasClasses = false;
+        bool bHasEnums = false;
+        bool bHasFunctions = false;
+        bool bHasParameterStructs = false;
+
+        inline bool IsEmpty() const { return !bHasStructs && !bHasClasses && !bHasEnums && !bHasFunctions && !bHasParameterStructs; }
+    };
+
     enum class EFileType
     {
         Classes,
@@ -55,6 +68,9 @@ private:
         Parameters,
         Functions,
 
+        StructHeader,
+        EnumHeader,
+
         NameCollisionsInl,
 
         BasicHpp,
@@ -67,6 +83,14 @@ private:
         SdkHpp,
 
         DebugAssertions,
+        Reflection,
+
+        SdkModule,
+        PrecompiledHeader,
+
+        UnityBuild,
+
+        Assertions,
     };
 
 private:
@@ -84,6 +108,18 @@ public:
 private:
     static inline std::vector<PredefinedStruct> PredefinedStructs;
 
+    /* Type-strings of all types in TypeManager, indexed by TypeIndex. Only contains strings generated without a package to check for cycles. */
+    static inline std::vector<std::string> CachedTypeStrings;
+
+    /* Indices of all structs, classes and enums reachable from 'Settings::CppGenerator::SDKRoots'. Empty if the SDK isn't tree-shaken. */
+    static inline std::unordered_set<int32> ReachableObjects;
+
+    /* Generated content of every package, only populated if the SDK is tree-shaken */
+    static inline std::unordered_map<int32, PackageContent> ReachablePackageContents;
+
+    /* Indices of all structs whose headers are (transitively) included by the header of a struct, used for per-class headers only. Only contains complete closures */
+    static inline std::unordered_map<int32, std::unordered_set<int32>> StructIncludeClosures;
+
 private:
     static std::string MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment);
     static std::string MakeMemberStringWithoutName(const std::string& Type);
@@ -95,7 +131,8 @@ private:
     static FunctionInfo GenerateFunctionInfo(const FunctionWrapper& Func);
 
     // return: In-header function declarations and inline functions
-    static std::string GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile);
+    // FunctionTableName/FunctionTableIndex: Per-class 'TFunctionTable' used to look up the UFunction, the UFunction is looked up by name if there is none
+    static std::string GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile, const std::string& FunctionTableName = "", int32 FunctionTableIndex = -1);
     static std::string GenerateFunctions(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile);
 
     static void GenerateStruct(const StructWrapper& Struct, StreamType& StructFile, StreamType& FunctionFile, StreamType& ParamFile, int32 PackageIndex = -1, const std::string& StructNameOverride = std::string());
@@ -107,6 +144,10 @@ private: /* utility functions */
     static std::string GetMemberTypeString(UEProperty Member, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false);
     static std::string GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex = -1);
 
+    /* Returns the cached type-string of this type, if there is one. The string is only generated once per type. */
+    static std::string GetTypeString(TypeInfoHandle Type, int32 PackageIndex = -1);
+    static std::string GenerateTypeString(TypeInfoHandle Type, int32 PackageIndex);
+
     static std::string GetFunctionSignature(UEFunction Func);
 
     static std::string GetStructPrefixedName(const StructWrapper& Struct);
@@ -117,6 +158,31 @@ private: /* utility functions */
 
     static std::unordered_map<std::string, UEProperty> GetUnknownProperties();
 
+private: /* tree-shaking */
+    static bool IsTreeShaking();
+
+    /* Collects all structs, classes and enums reachable from 'Settings::CppGenerator::SDKRoots' */
+    static void InitReachableObjects();
+
+    /* Whether a struct, class or enum is generated, always true if the SDK isn't tree-shaken */
+    static bool IsReachable(int32 ObjectIndex);
+
+    static PackageContent GetPackageContent(PackageInfoHandle Package);
+
+private: /* per-class headers */
+    /* Path of the header of a struct/class, or of the enums of a package, relative to 'Subfolder'. eg. "Engine/AActor.hpp" or "Engine/Enums.hpp" */
+    static std::string GetStructHeaderPath(const StructWrapper& Struct);
+    static std::string GetEnumHeaderPath(int32 PackageIndex);
+
+    /* Super and structs used by value, these need to be complete types for this struct to be declared */
+    static std::vector<int32> GetDirectStructDependencies(UEStruct Struct);
+    static const std::unordered_set<int32>& GetStructIncludeClosure(int32 StructIndex);
+
+    /* Transitive reduction of the direct dependencies, headers already included by another dependency are omitted */
+    static std::vector<int32> GetMinimalStructIncludes(UEStruct Struct);
+
+    static void GenerateStructHeader(const StructWrapper& Struct, StreamType& FunctionFile, StreamType& ParamFile, int32 PackageIndex);
+
 private:
     static void GenerateEnumFwdDeclarations(StreamType& ClassOrStructFile, PackageInfoHandle Package, bool bIsClassFile);
 
@@ -124,11 +190,29 @@ private:
     static void GenerateNameCollisionsInl(StreamType& NameCollisionsFile);
     static void GeneratePropertyFixupFile(StreamType& PropertyFixup);
     static void GenerateDebugAssertions(StreamType& AssertionStream);
+    static void GenerateStructAssertions(const StructWrapper& Struct, StreamType& AssertionStream, bool bAssertSize = true, bool bAssertMembers = true);
+    static void GeneratePackageAssertions(PackageInfoHandle Package, const PackageContent& Content);
+    static void GenerateReflectionHeader(StreamType& ReflectionHeader);
     static void WriteFileHead(StreamType& File, PackageInfoHandle Package, EFileType Type, const std::string& CustomFileComment = "", const std::string& CustomIncludes = "");
     static void WriteFileEnd(StreamType& File, EFileType Type);
 
     static void GenerateSDKHeader(StreamType& SdkHpp);
 
+    /* Creates SDK.ixx and SDK_PCH.hpp, both are built on top of SDK.hpp */
+    static void GenerateModuleAndPCHFiles(StreamType& SdkModule, StreamType& PrecompiledHeader);
+
+    /* Groups the "PackageName_functions.cpp" files into 'Settings::CppGenerator::NumUnityBuildFiles' translation units, a package always stays in the same group */
+    static void GenerateUnityBuildFiles();
+
+    /* Generates SDK.hpp, NameCollisions.inl and the optional Assertions.inl and Reflection.hpp, which all need to be updated if any package changes */
+    static void GenerateAllPackagesFiles();
+
+    /* Generates all files of a single package, eg. "Engine_classes.hpp" */
+    static void GeneratePackage(PackageInfoHandle Package);
+
+    /* Deletes all files generated for the package 'PackageName' by GeneratePackage() */
+    static void RemovePackageFiles(const std::string& PackageName);
+
     static void GenerateBasicFiles(StreamType& BasicH, StreamType& BasicCpp);
 
     /*
@@ -149,6 +233,13 @@ private:
 public:
     static void Generate();
 
+    /* 
+    * Regenerates the given packages, and files covering all packages, after the managers were updated. Other files are left untouched.
+    * 
+    * Files of 'RemovedPackages' are deleted, the names are those the packages were previously generated with.
+    */
+    static void GenerateDelta(const std::unordered_set<int32>& PackagesToRegenerate, const std::vector<std::string>& RemovedPackages);
+
     static void InitPredefinedMembers();
     static void InitPredefinedFunctions();
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "Managers/StructManager.h"
 #include "Managers/PackageManager.h"
+#include "Managers/TypeManager.h"
 
 #include "Wrappers/EnumWrapper.h"
 #include "Wrappers/StructWrapper.h"
@@ -30,6 +31,10 @@ public:
     static inline fs::path MainFolder;
     static inline fs::path Subfolder;
 
+private:
+    /* MemberTypes of all types in TypeManager, indexed by TypeIndex. 'reference' is set per use and not part of the cached value. */
+    static inline std::vector<DSGen::MemberType> CachedMemberTypes;
+
 private:
     static std::string GetStructPrefixedName(const StructWrapper& Struct);
     static std::string GetEnumPrefixedName(const EnumWrapper& Enum);
@@ -40,10 +45,12 @@ private:
 private:
     static DSGen::EType GetMemberEType(const PropertyWrapper& Property);
     static DSGen::EType GetMemberEType(UEProperty Property);
-    static std::string GetMemberTypeStr(UEProperty Property, std::string& OutExtendedType, std::vector<DSGen::MemberType>& OutSubtypes);
+    static DSGen::EType GetMemberEType(TypeInfoHandle Type);
+    static std::string GetMemberTypeStr(TypeInfoHandle Type, std::string& OutExtendedType, std::vector<DSGen::MemberType>& OutSubtypes);
     static DSGen::MemberType GetMemberType(const StructWrapper& Struct);
     static DSGen::MemberType GetMemberType(UEProperty Property, bool bIsReference = false);
     static DSGen::MemberType GetMemberType(const PropertyWrapper& Property, bool bIsReference = false);
+    static DSGen::MemberType GetMemberType(TypeInfoHandle Type, bool bIsReference = false);
     static DSGen::MemberType ManualCreateMemberType(DSGen::EType Type, const std::string& TypeName, const std::string& ExtendedType = "");
     static void AddMemberToStruct(DSGen::ClassHolder& Struct, const PropertyWrapper& Property);
 
@@ -57,6 +64,11 @@ private:
 
     static void GeneratedStaticOffsets();
 
+    static void InitMemberTypeCache();
+
+    /* Generates all enums, structs, classes and functions of a package into a fragment. May be called from multiple threads at once. */
+    static void GeneratePackage(PackageInfoHandle Package, DSGen::BakedFragment& OutFragment);
+
 public:
     static void Generate();
 
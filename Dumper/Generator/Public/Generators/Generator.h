@@ -1,11 +1,13 @@
 #pragma once
 
 #include <filesystem>
+#include <unordered_set>
 
 #include "Unreal/ObjectArray.h"
 #include "Managers/DependencyManager.h"
 #include "Managers/MemberManager.h"
 #include "HashStringTable.h"
+#include "Stats/DumpStats.h"
 
 
 namespace fs = std::filesystem;
@@ -39,20 +41,45 @@ class Generator
 private:
     friend class GeneratorTest;
 
+private:
+    struct KnownObject
+    {
+        void* Address;
+        bool bIsType;
+    };
+
 private:
     static inline fs::path DumperFolder;
     static inline bool bDumpedGObjects = false;
 
+    /* Objects the managers were initialized with, indexed by object-index. Used to find objects loaded since the last pass in resident mode. */
+    static inline std::vector<KnownObject> KnownObjects;
+
 public:
     static void InitEngineCore();
     static void InitInternal();
 
+    /* Writes "DumpStats.json" next to "GObjects-Dump.txt" */
+    static void WriteDumpStats();
+
 private:
     static bool SetupDumperFolder();
 
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder);
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder, std::string& SubfolderName, fs::path& OutSubFolder);
 
+    static void InitKnownObjects();
+
+    /* 
+    * Adds structs, classes and enums loaded since the last pass to all managers. Returns false if there is nothing to regenerate.
+    * 
+    * Names of packages whose files are no longer valid, as the package was removed or renamed, are added to 'OutRemovedPackages'.
+    */
+    static bool InitNewObjects(std::unordered_set<int32>& OutPackagesToRegenerate, std::vector<std::string>& OutRemovedPackages);
+
+    /* Rebuilds all managers from scratch after types known to them were unloaded, compares the packages and types before and after to find the ones to regenerate */
+    static void ReinitManagers(const std::unordered_set<int32>& UnloadedTypes, std::unordered_set<int32>& OutPackagesToRegenerate, std::vector<std::string>& OutRemovedPackages);
+
 public:
     template<GeneratorImplementation GeneratorType>
     static void Generate() 
@@ -64,6 +91,8 @@ public:
 
             if (!bDumpedGObjects)
             {
+                DumpStats::ScopedPhase DumpObjectsPhase("DumpObjects");
+
                 bDumpedGObjects = true;
                 ObjectArray::DumpObjects(DumperFolder);
 
@@ -75,6 +104,8 @@ public:
         if (!SetupFolders(GeneratorType::MainFolderName, GeneratorType::MainFolder, GeneratorType::SubfolderName, GeneratorType::Subfolder))
             return;
 
+        DumpStats::ScopedPhase GeneratePhase("Generate " + GeneratorType::MainFolderName);
+
         GeneratorType::InitPredefinedMembers();
         GeneratorType::InitPredefinedFunctions();
 
@@ -82,4 +113,20 @@ public:
 
         GeneratorType::Generate();
     };
+
+    /* Only regenerates packages changed by objects loaded since the last pass, the generator-folder is updated in place */
+    /* Generators without a 'GenerateDelta' (Mappings, IDAMappings, Dumpspace) keep the output of the initial dump */
+    template<GeneratorImplementation GeneratorType>
+    static void GenerateDelta()
+    {
+        std::unordered_set<int32> PackagesToRegenerate;
+        std::vector<std::string> RemovedPackages;
+
+        if (!InitNewObjects(PackagesToRegenerate, RemovedPackages))
+            return;
+
+        MemberManager::SetPredefinedMemberLookupPtr(&GeneratorType::PredefinedMembers);
+
+        GeneratorType::GenerateDelta(PackagesToRegenerate, RemovedPackages);
+    }
 };
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <fstream>
+#include <unordered_map>
 
 #include "Unreal/ObjectArray.h"
 #include "Wrappers/MemberWrappers.h"
 #include "Wrappers/EnumWrapper.h"
 
+#include "Managers/TypeManager.h"
+#include "Managers/PackageManager.h"
+
 
 /*
 * USMAP-Header:
@@ -90,6 +94,12 @@ private:
 private:
     static inline uint64 NameCounter = 0x0;
 
+    /* Index of every name in the name-table by the FName it was created from, key is [CompIdx, Number]. Only read from once all names were added. */
+    static inline std::unordered_map<uint64, int32> FNameToNameIndex;
+
+    /* Index of every name in the name-table by its string. Used for names which aren't FNames, and for different FNames resulting in the same string. */
+    static inline std::unordered_map<std::string, int32> StringToNameIndex;
+
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
 
@@ -109,20 +119,42 @@ private:
     template<typename InStreamType>
     static void WriteToStream(InStreamType& InStream, const std::stringstream& Data)
     {
-        InStream << Data.rdbuf();
+        /* Inserting an empty rdbuf() sets the failbit of 'InStream', which silently drops all following writes */
+        const std::string_view DataView = Data.view();
+
+        InStream.write(DataView.data(), DataView.size());
     }
 
 private:
     /* Utility Functions */
     static EMappingsTypeFlags GetMappingType(UEProperty Property);
+    static uint64 GetFNameKey(FName Name);
+
+    static FName GetObjectFName(UEObject Object);
+    static FName GetStructFName(const StructWrapper& Struct);
+
+private:
+    /* Adding names, only done on one thread before any structs or enums are serialized */
     static int32 AddNameToData(std::stringstream& NameTable, const std::string& Name);
+    static void AddNameToData(std::stringstream& NameTable, FName Name);
+
+    static void AddPropertyTypeNames(TypeInfoHandle Type, std::stringstream& NameTable);
+    static void AddStructNames(const StructWrapper& Struct, std::stringstream& NameTable);
+    static void AddEnumNames(const EnumWrapper& Enum, std::stringstream& NameTable);
+
+    static void GenerateNameTable(const std::vector<PackageInfoHandle>& Packages, std::stringstream& NameTable);
+
+    /* Looking up the index of names that were added, safe to be called from multiple threads */
+    static int32 GetNameIndex(const std::string& Name);
+    static int32 GetNameIndex(FName Name);
 
 private:
-    static void GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable);
-    static void GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index);
+    static void GeneratePropertyType(UEProperty Property, std::stringstream& Data);
+    static void GeneratePropertyType(TypeInfoHandle Type, std::stringstream& Data);
+    static void GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, int32& Index);
 
-    static void GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable);
-    static void GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable);
+    static void GenerateStruct(const StructWrapper& Struct, std::stringstream& Data);
+    static void GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data);
 
     static std::stringstream GenerateFileData();
     static void GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data);
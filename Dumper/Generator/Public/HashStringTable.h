@@ -301,6 +301,9 @@ public:
 
     int32 GetTotalUsedSize() const;
 
+    /* Removes all strings, the memory of all buckets is kept for reuse */
+    void Clear();
+
 public:
     void DebugPrintStats() const;
 };
\ No newline at end of file
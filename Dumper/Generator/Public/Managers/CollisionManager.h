@@ -137,12 +137,18 @@ public:
 
 	std::string StringifyName(UEStruct Struct, NameInfo Info);
 
+	/* Removes all names, including reserved ones */
+	void Clear();
+
 public:
 	template<typename UEType>
 	inline NameInfo GetNameCollisionInfoUnchecked(UEStruct Struct, UEType Member)
 	{
 		CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
-		uint64 NameInfoIndex = TranslationMap[KeyFunctions::GetKeyForCollisionInfo(Struct, Member)];
+
+		/* Lookup without insertion, this may be called from multiple threads at once */
+		const auto It = TranslationMap.find(KeyFunctions::GetKeyForCollisionInfo(Struct, Member));
+		const uint64 NameInfoIndex = It != TranslationMap.end() ? It->second : 0x0;
 
 		return InfosForStruct.at(NameInfoIndex);
 	}
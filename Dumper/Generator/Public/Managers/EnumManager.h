@@ -111,12 +111,21 @@ private:
 	static inline bool bIsInitialized = false;
 
 private:
+	/* Initializes the info of an enum, or the underlaying-type size of enums used by the properties of a struct */
+	static void InitObject(UEObject Obj);
+
 	static void InitInternal();
 	static void InitIllegalNames();
 
 public:
 	static void Init();
 
+	/* Adds enums, and structs using enums, loaded after Init() */
+	static void AddNewObjects(const std::vector<int32>& ObjectIndices);
+
+	/* Drops all infos, such that Init() builds them from scratch. Used when types known to this manager were unloaded */
+	static void Reset();
+
 private:
 	static inline const StringEntry& GetEnumName(const EnumInfo& Info)
 	{
@@ -186,6 +186,8 @@ private:
 	/* CollisionManager containing information on colliding member-/function-names */
 	static inline CollisionManager MemberNames;
 
+	static inline bool bIsInitialized = false;
+
 private:
 	const std::shared_ptr<StructWrapper> Struct;
 
@@ -286,12 +288,10 @@ public:
 
 	static inline void Init()
 	{
-		static bool bInitialized = false;
-
-		if (bInitialized)
+		if (bIsInitialized)
 			return;
 
-		bInitialized = true;
+		bIsInitialized = true;
 
 		/* Adds special names first, to avoid name-collisions with predefined members */
 		InitReservedNames();
@@ -311,6 +311,28 @@ public:
 		MemberNames.AddStructToNameContainer(Struct, (!Struct.IsA(EClassCastFlags::Class) && !Struct.IsA(EClassCastFlags::Function)));
 	}
 
+	/* Adds member-name collisions of structs loaded after Init() */
+	static inline void AddNewObjects(const std::vector<int32>& ObjectIndices)
+	{
+		for (int32 Index : ObjectIndices)
+		{
+			UEObject Obj = ObjectArray::GetByIndex(Index);
+
+			if (!Obj.IsA(EClassCastFlags::Struct) || Obj.IsA(EClassCastFlags::Function))
+				continue;
+
+			AddStructToNameContainer(Obj.Cast<UEStruct>());
+		}
+	}
+
+	/* Drops all names, such that Init() builds them from scratch. Used when structs known to this manager were unloaded */
+	static inline void Reset()
+	{
+		MemberNames.Clear();
+
+		bIsInitialized = false;
+	}
+
 	template<typename UEType>
 	static inline NameInfo GetNameCollisionInfo(UEStruct Struct, UEType Member)
 	{
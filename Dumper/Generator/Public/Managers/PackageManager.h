@@ -227,9 +227,12 @@ private:
 	static inline bool bIsPostInitialized = false;
 
 private:
+	static void InitDependencies(UEObject Obj);
 	static void InitDependencies();
+	static void InitName(int32 PackageIdx, PackageInfo& Info);
 	static void InitNames();
-	static void HandleCycles();
+	/* Packages whose dependencies were changed by the removal of a cycle are added to 'OutModifiedPackages', if not nullptr */
+	static void HandleCycles(std::unordered_set<int32>* OutModifiedPackages = nullptr);
 
 private:
 	static void HelperMarkStructDependenciesOfPackage(UEStruct Struct, int32 OwnPackageIdx, int32 RequiredPackageIdx, bool bIsClass);
@@ -243,6 +246,16 @@ public:
 	static void Init();
 	static void PostInit();
 
+	/*
+	* Adds objects loaded after PostInit(), eg. Blueprint classes of a streamed in level. StructManager::AddNewObjects() must be called before.
+	* 
+	* Cycles caused by the new objects can mark structs of existing packages as cyclic, those packages are added to 'OutModifiedPackages'.
+	*/
+	static void AddNewObjects(const std::vector<int32>& ObjectIndices, std::unordered_set<int32>& OutModifiedPackages);
+
+	/* Drops all infos, such that Init() builds them from scratch. Used when types known to this manager were unloaded */
+	static void Reset();
+
 private:
 	static inline const StringEntry& GetPackageName(const PackageInfo& Info)
 	{
@@ -97,12 +97,22 @@ private:
 	static inline bool bIsInitialized = false;
 
 private:
+	static void InitAlignmentAndName(UEObject Obj, const UEClass InterfaceClass);
+	static void InitSuperAlignments(UEObject Obj);
+	static void InitSizeAndIsFinal(UEObject Obj);
+
 	static void InitAlignmentsAndNames();
 	static void InitSizesAndIsFinal();
 
 public:
 	static void Init();
 
+	/* Adds structs loaded after Init(), eg. Blueprint classes of a streamed in level, without re-initializing existing structs */
+	static void AddNewObjects(const std::vector<int32>& ObjectIndices);
+
+	/* Drops all infos, such that Init() builds them from scratch. Used when types known to this manager were unloaded */
+	static void Reset();
+
 private:
 	static inline const StringEntry& GetName(const StructInfo& Info)
 	{
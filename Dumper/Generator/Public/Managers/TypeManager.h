@@ -0,0 +1,162 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Unreal/ObjectArray.h"
+
+
+/*
+* Interned description of the type of a property.
+*
+* All properties referring to the same type, eg. 'TArray<TMap<FName, class UFoo*>>', share a single TypeInfo. Generators use the index of the
+* TypeInfo to cache the string-representation of a type once, instead of rebuilding it for every single occurence of the type.
+*/
+struct TypeInfo
+{
+private:
+	friend class TypeInfoHandle;
+	friend class TypeManager;
+
+private:
+	/* Address of the UClass, or FFieldClass, of the property. Unique for every kind of property, used for the names of unknown properties */
+	const void* PropertyClass = nullptr;
+
+	/* CastFlags of 'PropertyClass' */
+	EClassCastFlags CastFlags = EClassCastFlags::None;
+
+	/* Generator-independent type of this property, as it would be written to a .usmap file */
+	EMappingsTypeFlags MappingType = EMappingsTypeFlags::Unknown;
+
+	/* Index of the enum, struct, class or signature-function referenced by this type, -1 if there is none */
+	int32 ReferencedIndex = -1;
+
+	/* FFieldClass referenced by a FieldPathProperty, nullptr for all other types */
+	const void* ReferencedFieldClass = nullptr;
+
+	/* Indices of the inner types of this type, -1 if there is none. Array/Set/Optional/EnumUnderlayingType -> [0], Map -> [0] = Key, [1] = Value */
+	int32 InnerTypes[2] = { -1, -1 };
+
+	/* BoolProperty: IsNativeBool, ClassProperty: UObjectWrapper (TSubclassOf), OptionalProperty: has an additional 'IsSet' flag */
+	bool bHasTypeModifier = false;
+
+	/* Whether this type, or any of its inner types, refers to a struct that is part of a package with cyclic dependencies */
+	bool bMayBeCyclic = false;
+};
+
+class TypeInfoHandle
+{
+private:
+	int32 TypeIndex;
+
+public:
+	TypeInfoHandle() = default;
+	explicit TypeInfoHandle(int32 Index);
+
+public:
+	bool IsValid() const;
+
+	int32 GetIndex() const;
+
+	const void* GetPropertyClassAddress() const;
+	EClassCastFlags GetCastFlags() const;
+	EMappingsTypeFlags GetMappingType() const;
+
+	int32 GetReferencedIndex() const;
+	const void* GetReferencedFieldClassAddress() const;
+
+	TypeInfoHandle GetInnerType(int32 InnerIndex = 0) const;
+
+	bool HasTypeModifier() const;
+	bool MayBeCyclic() const;
+
+	/* Name of the UClass, or FFieldClass, of this type. Used for unknown properties */
+	std::string GetPropertyClassCppName() const;
+
+	template<typename UEType>
+	UEType GetReferencedObject() const;
+};
+
+class TypeManager
+{
+private:
+	friend class TypeInfoHandle;
+
+private:
+	struct TypeKey
+	{
+		const void* PropertyClass;
+		const void* ReferencedFieldClass;
+		int32 ReferencedIndex;
+		int32 InnerTypes[2];
+		bool bHasTypeModifier;
+
+		inline bool operator==(const TypeKey& Other) const
+		{
+			return PropertyClass == Other.PropertyClass && ReferencedFieldClass == Other.ReferencedFieldClass && ReferencedIndex == Other.ReferencedIndex
+				&& InnerTypes[0] == Other.InnerTypes[0] && InnerTypes[1] == Other.InnerTypes[1] && bHasTypeModifier == Other.bHasTypeModifier;
+		}
+	};
+
+	struct TypeKeyHasher
+	{
+		size_t operator()(const TypeKey& Key) const;
+	};
+
+public:
+	using TypeInfoListType = std::vector<TypeInfo>;
+	using TypeLookupMapType = std::unordered_map<TypeKey, int32 /* TypeIndex */, TypeKeyHasher>;
+
+private:
+	/* List of all distinct types of properties, indexed by TypeIndex */
+	static inline TypeInfoListType TypeInfos;
+
+	/* Map used to intern types, such that every distinct type only exists once within 'TypeInfos' */
+	static inline TypeLookupMapType TypeLookup;
+
+	static inline bool bIsInitialized = false;
+
+private:
+	static EMappingsTypeFlags GetMappingTypeFromFlags(EClassCastFlags Flags);
+
+	static TypeKey MakeTypeKey(UEProperty Property);
+
+	static int32 FindOrAddType(UEProperty Property);
+
+public:
+	/* Must be called after PackageManager::PostInit(), as it relies on information on cyclic structs */
+	static void Init();
+
+	/* Adds the types of members, and parameters, of structs loaded after Init(). Existing types that became cyclic are added to 'OutNewlyCyclicTypes' */
+	static void AddNewObjects(const std::vector<int32>& ObjectIndices, std::unordered_set<int32>& OutNewlyCyclicTypes);
+
+	/* Drops all infos, such that Init() builds them from scratch. Used when types known to this manager were unloaded */
+	static void Reset();
+
+public:
+	static inline int32 GetNumTypes()
+	{
+		return static_cast<int32>(TypeInfos.size());
+	}
+
+	static inline TypeInfoHandle GetInfo(UEProperty Property)
+	{
+		if (!Property)
+			return TypeInfoHandle(-1);
+
+		return TypeInfoHandle(FindOrAddType(Property));
+	}
+};
+
+
+template<typename UEType>
+inline UEType TypeInfoHandle::GetReferencedObject() const
+{
+	const int32 ReferencedIndex = GetReferencedIndex();
+
+	if (ReferencedIndex == -1)
+		return UEType(nullptr);
+
+	return ObjectArray::GetByIndex<UEType>(ReferencedIndex);
+}
@@ -0,0 +1,442 @@
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <climits>
+#include <sys/uio.h>
+#endif
+
+#include "MemoryReader.h"
+
+
+bool MemoryReader::ReadScatter(std::vector<MemoryReadRequest>& Requests)
+{
+	bool bReadAll = true;
+
+	for (MemoryReadRequest& Request : Requests)
+	{
+		Request.bSucceeded = ReadRaw(Request.Address, Request.Buffer, Request.Size);
+		bReadAll = bReadAll && Request.bSucceeded;
+	}
+
+	return bReadAll;
+}
+
+MemoryReaderStatistics MemoryReader::GetStatistics() const
+{
+	return MemoryReaderStatistics();
+}
+
+
+RemoteMemoryReader::RemoteMemoryReader(uint32_t ProcessId, size_t MaxPages)
+	: MaxCachedPages(std::max<size_t>(MaxPages, MaxPagesPerRemoteRead))
+{
+#ifdef _WIN32
+	ProcessHandle = reinterpret_cast<uintptr_t>(OpenProcess(PROCESS_VM_READ | PROCESS_QUERY_LIMITED_INFORMATION, FALSE, ProcessId));
+#else
+	ProcessHandle = ProcessId;
+#endif
+
+	PageLookup.reserve(MaxCachedPages);
+}
+
+RemoteMemoryReader::~RemoteMemoryReader()
+{
+#ifdef _WIN32
+	if (ProcessHandle)
+		CloseHandle(reinterpret_cast<HANDLE>(ProcessHandle));
+#endif
+}
+
+bool RemoteMemoryReader::IsValid() const
+{
+	return ProcessHandle != 0;
+}
+
+size_t RemoteMemoryReader::ReadRemote(MemoryReadRequest* Requests, size_t NumRequests) const
+{
+	size_t NumRemoteCalls = 0;
+
+#ifdef _WIN32
+	for (size_t i = 0; i < NumRequests; i++)
+	{
+		SIZE_T BytesRead = 0;
+		const BOOL bResult = ReadProcessMemory(reinterpret_cast<HANDLE>(ProcessHandle), reinterpret_cast<LPCVOID>(Requests[i].Address), Requests[i].Buffer, Requests[i].Size, &BytesRead);
+
+		Requests[i].bSucceeded = bResult && BytesRead == Requests[i].Size;
+		NumRemoteCalls++;
+	}
+#else
+	std::vector<iovec> LocalVecs;
+	std::vector<iovec> RemoteVecs;
+
+	size_t StartIndex = 0;
+
+	while (StartIndex < NumRequests)
+	{
+		const size_t NumInBatch = std::min<size_t>(NumRequests - StartIndex, IOV_MAX);
+
+		LocalVecs.resize(NumInBatch);
+		RemoteVecs.resize(NumInBatch);
+
+		for (size_t i = 0; i < NumInBatch; i++)
+		{
+			const MemoryReadRequest& Request = Requests[StartIndex + i];
+
+			LocalVecs[i] = { Request.Buffer, Request.Size };
+			RemoteVecs[i] = { reinterpret_cast<void*>(Request.Address), Request.Size };
+		}
+
+		const ssize_t BytesRead = process_vm_readv(static_cast<pid_t>(ProcessHandle), LocalVecs.data(), NumInBatch, RemoteVecs.data(), NumInBatch, 0);
+		NumRemoteCalls++;
+
+		/* Reads stop at the first request that isn't fully readable, requests following it are part of the next batch */
+		size_t RemainingBytes = BytesRead > 0 ? static_cast<size_t>(BytesRead) : 0;
+		size_t NumHandled = 0;
+
+		while (NumHandled < NumInBatch && RemainingBytes >= Requests[StartIndex + NumHandled].Size)
+		{
+			RemainingBytes -= Requests[StartIndex + NumHandled].Size;
+			Requests[StartIndex + NumHandled].bSucceeded = true;
+			NumHandled++;
+		}
+
+		if (NumHandled < NumInBatch)
+		{
+			Requests[StartIndex + NumHandled].bSucceeded = false;
+			NumHandled++;
+		}
+
+		StartIndex += NumHandled;
+	}
+#endif
+
+	return NumRemoteCalls;
+}
+
+bool RemoteMemoryReader::ReadUncached(uintptr_t Address, void* Buffer, size_t Size)
+{
+	MemoryReadRequest Request = { Address, Buffer, Size };
+	const size_t NumRemoteCalls = ReadRemote(&Request, 1);
+
+	if (!Request.bSucceeded)
+		memset(Buffer, 0, Size);
+
+	std::scoped_lock Lock(CacheMutex);
+	Statistics.NumRemoteCalls += NumRemoteCalls;
+
+	return Request.bSucceeded;
+}
+
+const RemoteMemoryReader::CachedPage* RemoteMemoryReader::FindPage(uintptr_t PageAddress)
+{
+	auto It = PageLookup.find(PageAddress);
+
+	if (It == PageLookup.end())
+		return nullptr;
+
+	/* Move to front, without invalidating the iterator stored in PageLookup */
+	if (It->second != Pages.begin())
+		Pages.splice(Pages.begin(), Pages, It->second);
+
+	return &*It->second;
+}
+
+void RemoteMemoryReader::AddPage(uintptr_t PageAddress, bool bIsReadable, const uint8_t* Data)
+{
+	auto It = PageLookup.find(PageAddress);
+
+	if (It == PageLookup.end())
+	{
+		if (Pages.size() >= MaxCachedPages)
+		{
+			PageLookup.erase(Pages.back().PageAddress);
+
+			/* Reuse the least recently used page instead of freeing and allocating */
+			Pages.splice(Pages.begin(), Pages, std::prev(Pages.end()));
+		}
+		else
+		{
+			Pages.emplace_front();
+		}
+
+		It = PageLookup.emplace(PageAddress, Pages.begin()).first;
+	}
+	else
+	{
+		Pages.splice(Pages.begin(), Pages, It->second);
+	}
+
+	CachedPage& Page = *It->second;
+	Page.PageAddress = PageAddress;
+	Page.bIsReadable = bIsReadable;
+
+	if (bIsReadable)
+		memcpy(Page.Data, Data, PageSize);
+}
+
+void RemoteMemoryReader::FetchPages(const std::vector<uintptr_t>& SortedPageAddresses)
+{
+	if (SortedPageAddresses.empty())
+		return;
+
+	/* Page at index 'i' of 'SortedPageAddresses' is read to 'Staging + (i * PageSize)', adjacent pages are adjacent in 'Staging' as well */
+	std::vector<uint8_t> Staging(SortedPageAddresses.size() * PageSize);
+	std::vector<MemoryReadRequest> Runs;
+
+	for (size_t i = 0; i < SortedPageAddresses.size(); i++)
+	{
+		const uintptr_t PageAddress = SortedPageAddresses[i];
+
+		if (!Runs.empty() && (Runs.back().Address + Runs.back().Size) == PageAddress && Runs.back().Size < (MaxPagesPerRemoteRead * PageSize))
+		{
+			Runs.back().Size += PageSize;
+			continue;
+		}
+
+		Runs.push_back({ PageAddress, Staging.data() + (i * PageSize), PageSize });
+	}
+
+	size_t NumRemoteCalls = ReadRemote(Runs.data(), Runs.size());
+
+	/* A run fails as a whole if any of its pages isn't readable, find out which pages can be read */
+	std::vector<MemoryReadRequest> SinglePages;
+
+	for (const MemoryReadRequest& Run : Runs)
+	{
+		if (Run.bSucceeded || Run.Size == PageSize)
+			continue;
+
+		for (size_t Offset = 0; Offset < Run.Size; Offset += PageSize)
+			SinglePages.push_back({ Run.Address + Offset, static_cast<uint8_t*>(Run.Buffer) + Offset, PageSize });
+	}
+
+	NumRemoteCalls += ReadRemote(SinglePages.data(), SinglePages.size());
+
+	std::scoped_lock Lock(CacheMutex);
+
+	Statistics.NumPageMisses += SortedPageAddresses.size();
+	Statistics.NumRemoteCalls += NumRemoteCalls;
+
+	for (const MemoryReadRequest& Run : Runs)
+	{
+		if (!Run.bSucceeded && Run.Size != PageSize)
+			continue;
+
+		for (size_t Offset = 0; Offset < Run.Size; Offset += PageSize)
+			AddPage(Run.Address + Offset, Run.bSucceeded, static_cast<const uint8_t*>(Run.Buffer) + Offset);
+	}
+
+	for (const MemoryReadRequest& Page : SinglePages)
+		AddPage(Page.Address, Page.bSucceeded, static_cast<const uint8_t*>(Page.Buffer));
+}
+
+bool RemoteMemoryReader::CopyFromPages(uintptr_t Address, void* Buffer, size_t Size)
+{
+	uint8_t* Dest = static_cast<uint8_t*>(Buffer);
+
+	while (Size > 0)
+	{
+		const uintptr_t PageAddress = Address & ~(PageSize - 1);
+		const size_t OffsetInPage = Address - PageAddress;
+		const size_t NumBytes = std::min<size_t>(Size, PageSize - OffsetInPage);
+
+		auto It = PageLookup.find(PageAddress);
+
+		if (It == PageLookup.end() || !It->second->bIsReadable)
+			return false;
+
+		memcpy(Dest, It->second->Data + OffsetInPage, NumBytes);
+
+		Dest += NumBytes;
+		Address += NumBytes;
+		Size -= NumBytes;
+	}
+
+	return true;
+}
+
+void RemoteMemoryReader::GetPagesInRange(uintptr_t Address, size_t Size, std::vector<uintptr_t>& OutPages)
+{
+	if (Size == 0)
+		return;
+
+	const uintptr_t FirstPage = Address & ~(PageSize - 1);
+	const uintptr_t LastPage = (Address + Size - 1) & ~(PageSize - 1);
+
+	for (uintptr_t Page = FirstPage; Page <= LastPage && Page >= FirstPage; Page += PageSize)
+		OutPages.push_back(Page);
+}
+
+bool RemoteMemoryReader::ReadRaw(uintptr_t Address, void* Buffer, size_t Size)
+{
+	if (Size == 0)
+		return true;
+
+	const uintptr_t FirstPage = Address & ~(PageSize - 1);
+
+	/* Fast path, almost all reads are of single members and don't cross page-boundaries */
+	if (((Address + Size - 1) & ~(PageSize - 1)) == FirstPage)
+	{
+		{
+			std::scoped_lock Lock(CacheMutex);
+
+			if (const CachedPage* Page = FindPage(FirstPage))
+			{
+				Statistics.NumPageHits++;
+
+				if (!Page->bIsReadable)
+				{
+					memset(Buffer, 0, Size);
+					return false;
+				}
+
+				memcpy(Buffer, Page->Data + (Address - FirstPage), Size);
+				return true;
+			}
+		}
+
+		/* Copied from the fetched data, the page might already be evicted again by other threads */
+		std::unique_ptr<uint8_t[]> PageData = std::make_unique<uint8_t[]>(PageSize);
+		MemoryReadRequest Request = { FirstPage, PageData.get(), PageSize };
+
+		const size_t NumRemoteCalls = ReadRemote(&Request, 1);
+
+		{
+			std::scoped_lock Lock(CacheMutex);
+
+			Statistics.NumPageMisses++;
+			Statistics.NumRemoteCalls += NumRemoteCalls;
+
+			AddPage(FirstPage, Request.bSucceeded, PageData.get());
+		}
+
+		if (!Request.bSucceeded)
+		{
+			memset(Buffer, 0, Size);
+			return false;
+		}
+
+		memcpy(Buffer, PageData.get() + (Address - FirstPage), Size);
+		return true;
+	}
+
+	std::vector<uintptr_t> PagesInRange;
+	GetPagesInRange(Address, Size, PagesInRange);
+
+	/* Reads bigger than the cache would evict their own pages */
+	if (PagesInRange.size() > MaxCachedPages)
+		return ReadUncached(Address, Buffer, Size);
+
+	for (int32_t Attempt = 0; Attempt < MaxFetchAttempts; Attempt++)
+	{
+		std::vector<uintptr_t> MissingPages;
+
+		{
+			std::scoped_lock Lock(CacheMutex);
+
+			for (uintptr_t PageAddress : PagesInRange)
+			{
+				if (!FindPage(PageAddress))
+				{
+					MissingPages.push_back(PageAddress);
+				}
+				else if (Attempt == 0)
+				{
+					Statistics.NumPageHits++;
+				}
+			}
+
+			if (MissingPages.empty())
+			{
+				if (CopyFromPages(Address, Buffer, Size))
+					return true;
+
+				memset(Buffer, 0, Size);
+				return false;
+			}
+		}
+
+		FetchPages(MissingPages);
+	}
+
+	/* Other threads kept evicting the pages of this range before they could be copied */
+	return ReadUncached(Address, Buffer, Size);
+}
+
+bool RemoteMemoryReader::ReadScatter(std::vector<MemoryReadRequest>& Requests)
+{
+	std::vector<uintptr_t> AllPages;
+
+	for (const MemoryReadRequest& Request : Requests)
+		GetPagesInRange(Request.Address, Request.Size, AllPages);
+
+	std::sort(AllPages.begin(), AllPages.end());
+	AllPages.erase(std::unique(AllPages.begin(), AllPages.end()), AllPages.end());
+
+	/* Fetching all pages at once would evict pages of earlier requests before they were copied */
+	if (AllPages.size() > MaxCachedPages)
+		return MemoryReader::ReadScatter(Requests);
+
+	for (int32_t Attempt = 0; Attempt < MaxFetchAttempts; Attempt++)
+	{
+		std::vector<uintptr_t> MissingPages;
+
+		{
+			std::scoped_lock Lock(CacheMutex);
+
+			for (uintptr_t PageAddress : AllPages)
+			{
+				if (!FindPage(PageAddress))
+				{
+					MissingPages.push_back(PageAddress);
+				}
+				else if (Attempt == 0)
+				{
+					Statistics.NumPageHits++;
+				}
+			}
+
+			if (MissingPages.empty())
+			{
+				bool bReadAll = true;
+
+				for (MemoryReadRequest& Request : Requests)
+				{
+					Request.bSucceeded = CopyFromPages(Request.Address, Request.Buffer, Request.Size);
+
+					if (!Request.bSucceeded)
+						memset(Request.Buffer, 0, Request.Size);
+
+					bReadAll = bReadAll && Request.bSucceeded;
+				}
+
+				return bReadAll;
+			}
+		}
+
+		/* The cache isn't locked while the target process is read, other threads keep using it */
+		FetchPages(MissingPages);
+	}
+
+	/* ReadRaw() handles every request on its own */
+	return MemoryReader::ReadScatter(Requests);
+}
+
+MemoryReaderStatistics RemoteMemoryReader::GetStatistics() const
+{
+	std::scoped_lock Lock(CacheMutex);
+
+	return Statistics;
+}
+
+void RemoteMemoryReader::Invalidate()
+{
+	std::scoped_lock Lock(CacheMutex);
+
+	Pages.clear();
+	PageLookup.clear();
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+
+struct MemoryReadRequest
+{
+	uintptr_t Address;
+	void* Buffer;
+	size_t Size;
+
+	/* Set by the reader */
+	bool bSucceeded = false;
+};
+
+struct MemoryReaderStatistics
+{
+	/* Number of pages that were already cached when they were accessed */
+	uint64_t NumPageHits = 0;
+
+	/* Number of pages that had to be read from the target process */
+	uint64_t NumPageMisses = 0;
+
+	/* Number of ReadProcessMemory/process_vm_readv calls */
+	uint64_t NumRemoteCalls = 0;
+
+	inline double GetPageHitRate() const
+	{
+		const uint64_t NumAccesses = NumPageHits + NumPageMisses;
+
+		return NumAccesses != 0 ? static_cast<double>(NumPageHits) / NumAccesses : 0.0;
+	}
+};
+
+class MemoryReader
+{
+public:
+	virtual ~MemoryReader() = default;
+
+public:
+	/* Copies 'Size' bytes at 'Address' into 'Buffer'. Returns false, and zeros 'Buffer', if any part of the range isn't readable */
+	virtual bool ReadRaw(uintptr_t Address, void* Buffer, size_t Size) = 0;
+
+	/* Reads all requests at once, readers may coalesce requests to adjacent memory. Returns true if all requests succeeded */
+	virtual bool ReadScatter(std::vector<MemoryReadRequest>& Requests);
+
+	virtual MemoryReaderStatistics GetStatistics() const;
+};
+
+/*
+* Reads memory of another process through ReadProcessMemory (Windows) or process_vm_readv (Linux).
+*
+* Memory is read, and cached, in whole pages. Cached pages are evicted least-recently-used once 'MaxCachedPages' is exceeded.
+* Missing pages that are adjacent are read with a single call, unreadable pages are cached too, so probing invalid pointers stays cheap.
+* 
+* All public functions are thread-safe, the cache is shared by all threads generating the SDK. 'CacheMutex' only guards lookups and
+* insertions, the target process is read unlocked, so threads hitting the cache aren't blocked by other threads' misses.
+*/
+class RemoteMemoryReader final : public MemoryReader
+{
+public:
+	static constexpr uintptr_t PageSize = 0x1000;
+
+	/* Contiguous pages read from the target process with a single request */
+	static constexpr size_t MaxPagesPerRemoteRead = 0x40;
+
+	/* Fetched pages may be evicted by other threads before they are copied, after this many attempts the range is read uncached */
+	static constexpr int32_t MaxFetchAttempts = 0x2;
+
+private:
+	struct CachedPage
+	{
+		uintptr_t PageAddress;
+		bool bIsReadable;
+		uint8_t Data[PageSize];
+	};
+
+	using PageListType = std::list<CachedPage>;
+
+private:
+	/* Process HANDLE on Windows, pid on Linux */
+	uintptr_t ProcessHandle = 0;
+
+	size_t MaxCachedPages;
+
+	/* Most recently used pages are at the front */
+	PageListType Pages;
+	std::unordered_map<uintptr_t, PageListType::iterator> PageLookup;
+
+	MemoryReaderStatistics Statistics;
+
+	/* Guards 'Pages', 'PageLookup' and 'Statistics', never held while reading the target process */
+	mutable std::mutex CacheMutex;
+
+public:
+	RemoteMemoryReader(uint32_t ProcessId, size_t MaxCachedPages = 0x4000 /* 64MiB */);
+	~RemoteMemoryReader();
+
+	RemoteMemoryReader(const RemoteMemoryReader&) = delete;
+	RemoteMemoryReader& operator=(const RemoteMemoryReader&) = delete;
+
+public:
+	bool IsValid() const;
+
+	bool ReadRaw(uintptr_t Address, void* Buffer, size_t Size) override;
+	bool ReadScatter(std::vector<MemoryReadRequest>& Requests) override;
+
+	MemoryReaderStatistics GetStatistics() const override;
+
+	/* Drops all cached pages, required whenever the target process might have changed the memory that is being read */
+	void Invalidate();
+
+private:
+	/* Reads all requests from the target process without caching. Requests are marked as succeeded individually. Returns the number of remote calls */
+	size_t ReadRemote(MemoryReadRequest* Requests, size_t NumRequests) const;
+
+	/* Reads the range directly into 'Buffer', bypassing the cache */
+	bool ReadUncached(uintptr_t Address, void* Buffer, size_t Size);
+
+	/* Finds a cached page and marks it as most recently used, returns nullptr on misses. Requires 'CacheMutex' */
+	const CachedPage* FindPage(uintptr_t PageAddress);
+
+	/* Reads all pages in 'SortedPageAddresses' from the target process and adds them to the cache. Locks 'CacheMutex' only to add the pages */
+	void FetchPages(const std::vector<uintptr_t>& SortedPageAddresses);
+
+	/* Requires 'CacheMutex' */
+	void AddPage(uintptr_t PageAddress, bool bIsReadable, const uint8_t* Data);
+
+	/* Copies the range from cached pages, returns false if any page is missing or unreadable. Requires 'CacheMutex' */
+	bool CopyFromPages(uintptr_t Address, void* Buffer, size_t Size);
+
+	/* Appends the addresses of all pages overlapping the range to 'OutPages', in ascending order */
+	static void GetPagesInRange(uintptr_t Address, size_t Size, std::vector<uintptr_t>& OutPages);
+};
+
+/*
+* Abstraction for reads of game-memory.
+*
+* Without a reader (default) Dumper-7 runs injected and reads are plain dereferences.
+* Currently only the UObject/FField accessors (UnrealObjects.cpp) and ObjectArray read through the reader. FName::AppendString,
+* ProcessEvent, the OffsetFinder and TArray contents still dereference memory of the own process, so a reader can't be used
+* to dump another process yet.
+*/
+class Memory
+{
+private:
+	static inline std::unique_ptr<MemoryReader> Reader = nullptr;
+
+public:
+	static inline void SetReader(std::unique_ptr<MemoryReader>&& NewReader)
+	{
+		Reader = std::move(NewReader);
+	}
+
+	static inline MemoryReader* GetReader()
+	{
+		return Reader.get();
+	}
+
+	static inline bool IsRemote()
+	{
+		return Reader != nullptr;
+	}
+
+public:
+	template<typename T>
+	static inline T Read(const void* Address)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Memory::Read requires a trivially copyable type!");
+
+		if (!Reader) [[likely]]
+			return *static_cast<const T*>(Address);
+
+		T Value;
+		Reader->ReadRaw(reinterpret_cast<uintptr_t>(Address), &Value, sizeof(T));
+
+		return Value;
+	}
+
+	template<typename T>
+	static inline T Read(uintptr_t Address)
+	{
+		return Read<T>(reinterpret_cast<const void*>(Address));
+	}
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Unreal/Enums.h"
 
@@ -20,6 +21,11 @@ namespace Settings
 		inline std::string GameVersion = "";
 
 		inline constexpr const char* SDKGenerationPath = "C:/Dumper-7";
+
+		/* Keeps all generator-state after the SDK was generated. Press F5 to update the CppSDK with classes, structs and enums loaded since (eg. by a level-load). */
+		/* Only the packages affected by new types are rewritten. If types were unloaded all managers are rebuilt and only the packages that changed are rewritten. */
+		/* Mappings, IDAMappings and Dumpspace files are not updated by F5, they always describe the initial dump. */
+		inline constexpr bool bStayResident = false;
 	}
 
 	namespace CppGenerator
@@ -58,11 +64,47 @@ R"(
 
 		/* This will allow the user to manually initialize global variable addresses in the SDK (eg. GObjects, GNames, AppendString). */
 		constexpr bool bAddManualOverrideOptions = true;
+
+		/* Makes UObject::FindObject/FindObjectFast look up objects through 'ObjectLookupCache' in the SDK, comparing FNames instead of iterating GObjects and comparing strings. */
+		/* Object-indices recycled by the engine after they were cached (eg. after a level-transition) are only found again after calling 'ObjectLookupCache::Reset()'. */
+		constexpr bool bUseObjectLookupCache = false;
+
+		/* Makes UStruct::IsSubclassOf (and with it UObject::IsA) check classes through 'ClassHierarchyIndex' in the SDK, using two integer compares instead of walking the Super-chain. */
+		constexpr bool bUseClassHierarchyIndex = false;
+
+		/* Makes FName::ToStringView cache every name it can't reference in-place (wide names, numbered names, names decoded through AppendString), such that the returned view stays valid. */
+		constexpr bool bUseFNameDecodeCache = false;
+
+		/* Makes the wrappers of native UFunctions call 'UFunction::ExecFunction' on a FFrame built by the SDK, instead of going through ProcessEvent. RPCs and events still use ProcessEvent. */
+		/* The FFrame layout depends on the engine version, set 'bFFrameHasPropertyContainer' for games on UE5.1 or higher, which added 'FFrame::MostRecentPropertyContainer'. */
+		constexpr bool bUseNativeThunkCalls = false;
+		constexpr bool bFFrameHasPropertyContainer = false;
+
+		/* Generates 'Reflection.hpp', containing a constexpr perfect-hash table of member-name -> offset, size and type for every struct/class of the SDK. */
+		/* Allows for lookups of members by name through 'Reflection::GetPropertyPtr' without iterating the engines' reflection data. */
+		constexpr bool bGenerateReflectionHeader = false;
+
+		/* Generates 'SDK.ixx', a C++20 module interface unit exporting the entire SDK ('import SDK;'), and 'SDK_PCH.hpp', a header to precompile the SDK with. */
+		/* Both parse the SDK once per build, instead of once per translation unit including SDK.hpp. */
+		/* Experimental: 'SDK.ixx' exports all of SDK.hpp, including 'using namespace UC;' and its static_asserts, which not all compilers accept in an export-block. */
+		constexpr bool bGenerateModuleAndPCH = false;
+
+		/* Names of classes, structs, enums (eg. "Actor", "Vector") or packages (eg. "Engine") to tree-shake the SDK from. Only their supers, member- and parameter-types are generated. */
+		/* CoreUObject and classes used by the SDK itself are always generated. No roots -> the entire SDK is generated. */
+		inline std::vector<std::string> SDKRoots = {};
+
+		/* Generates one header per class/struct (eg. "SDK/Engine/AActor.hpp") including only the headers of its super and of structs it uses by value. */
+		/* The "PackageName_classes.hpp" and "PackageName_structs.hpp" files then only include these headers. */
+		constexpr bool bGeneratePerClassHeaders = false;
+
+		/* Number of "UnityBuild_N.cpp" files to group all "PackageName_functions.cpp" files into, by a hash of the package name. 0 -> no unity-build files. */
+		/* If used, compile the unity-build files instead of the individual "PackageName_functions.cpp" files. */
+		constexpr int32 NumUnityBuildFiles = 0;
 	}
 
 	namespace MappingGenerator
 	{
-		/* Whether the MappingGenerator should check if a name was written to the nametable before. Exists to reduce mapping size. */
+		/* Whether different FNames resulting in the same string should share one entry in the nametable. Each FName is only ever written once. Exists to reduce mapping size. */
 		constexpr bool bShouldCheckForDuplicatedNames = true;
 
 		/* Whether EditorOnly should be excluded from the mapping file. */
@@ -72,6 +114,12 @@ R"(
 		constexpr EUsmapCompressionMethod CompressionMethod = EUsmapCompressionMethod::ZStandard;
 	}
 
+	namespace DumpspaceGenerator
+	{
+		/* Whether the Dumpspace files should be compressed using ZStandard. Compressed files are written as '*.json.zst'. */
+		constexpr bool bCompressOutput = false;
+	}
+
 	/* Partially implemented  */
 	namespace Debug
 	{
@@ -83,9 +131,15 @@ R"(
 		/* Adds static_assert for member-offsets */
 		inline constexpr bool bGenerateInlineAssertionsForStructMembers = true;
 
+		/* Moves the inline assertions out of the headers into one "PackageName_assertions.cpp" file per package. Compile these to verify the layout once, instead of in every file including the SDK. */
+		inline constexpr bool bMoveInlineAssertionsToPackageFiles = false;
+
 
 		/* Prints debug information during Mapping-Generation */
 		inline constexpr bool bShouldPrintMappingDebugData = false;
+
+		/* Writes timings of all initialization- and generation-phases, as well as counters, to "DumpStats.json" next to "GObjects-Dump.txt" */
+		inline constexpr bool bWriteDumpStats = false;
 	}
 
 	//* * * * * * * * * * * * * * * * * * * * *// 
@@ -123,5 +177,8 @@ R"(
 
 		/* Whether this games' engine version uses double for FVector, instead of float. Aka, whether the engine version is UE5.0 or higher. */
 		inline bool bUseLargeWorldCoordinates = false;
+
+		/* Whether this games' engine version is UE5.0 or higher, independent of large world coordinates being enabled */
+		inline bool bIsUE5OrHigher = false;
 	}
 }
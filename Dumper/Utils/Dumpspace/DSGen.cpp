@@ -1,16 +1,202 @@
 #include "DSGen.h"
 
-#include <fstream>
+#include <iostream>
+
+#include "../Compression/zstd.h"
+
+namespace
+{
+	constexpr auto dumpspaceVersion = 10202;
+}
+
+DSGen::FileWriter::FileWriter() = default;
+
+DSGen::FileWriter::~FileWriter()
+{
+	ZSTD_freeCCtx(compressionContext);
+}
+
+void DSGen::FileWriter::flush(bool isFinal)
+{
+	// once anything failed the file is incomplete, nothing more is written
+	if (hasFailed)
+	{
+		buffer.clear();
+		return;
+	}
+
+	if (!compressionContext)
+	{
+		file.write(buffer.data(), buffer.size());
+		hasFailed = !file.good();
+
+		buffer.clear();
+		return;
+	}
+
+	ZSTD_inBuffer input = { buffer.data(), buffer.size(), 0 };
+	const ZSTD_EndDirective mode = isFinal ? ZSTD_e_end : ZSTD_e_continue;
+
+	bool isFinished = false;
+	while (!isFinished)
+	{
+		ZSTD_outBuffer output = { compressedBuffer.data(), compressedBuffer.size(), 0 };
+		const size_t remaining = ZSTD_compressStream2(compressionContext, &output, &input, mode);
+
+		if (ZSTD_isError(remaining))
+		{
+			std::cout << "Dumpspace: Compression failed: " << ZSTD_getErrorName(remaining) << std::endl;
+			hasFailed = true;
+			break;
+		}
+
+		file.write(compressedBuffer.data(), output.pos);
+
+		if (!file.good())
+		{
+			hasFailed = true;
+			break;
+		}
+
+		// when finishing the frame zstd needs to be called until everything was flushed, otherwise until the input was consumed
+		isFinished = isFinal ? remaining == 0 : input.pos == input.size;
+	}
+
+	buffer.clear();
+}
+
+void DSGen::FileWriter::open(const std::filesystem::path& path, bool compress)
+{
+	file.open(path, std::ios::binary | std::ios::trunc);
+	buffer.reserve(flushThreshold + 0x10000);
+	isFirstElement = true;
+	hasFailed = !file.is_open();
+
+	if (compress)
+	{
+		compressionContext = ZSTD_createCCtx();
+		compressedBuffer.resize(ZSTD_CStreamOutSize());
+
+		hasFailed = hasFailed || !compressionContext;
+	}
+}
+
+bool DSGen::FileWriter::isOpen() const
+{
+	return file.is_open();
+}
+
+std::string& DSGen::FileWriter::beginElement()
+{
+	if (!isFirstElement)
+		buffer += ',';
+
+	isFirstElement = false;
+
+	return buffer;
+}
+
+void DSGen::FileWriter::endElement()
+{
+	if (buffer.size() >= flushThreshold)
+		flush(false);
+}
+
+void DSGen::FileWriter::write(const std::string& str)
+{
+	buffer += str;
+
+	if (buffer.size() >= flushThreshold)
+		flush(false);
+}
+
+bool DSGen::FileWriter::close()
+{
+	if (!isOpen())
+		return !hasFailed;
+
+	flush(true);
+	file.close();
+
+	// closing flushes the stream, which can fail as well
+	hasFailed = hasFailed || file.fail();
+
+	ZSTD_freeCCtx(compressionContext);
+	compressionContext = nullptr;
+
+	return !hasFailed;
+}
 
 DSGen::DSGen()
 {
 }
 
-void DSGen::setDirectory(const std::filesystem::path& directory)
+std::filesystem::path DSGen::getFilePath(const std::string& fileName)
+{
+	return directory / (compressOutput ? fileName + ".zst" : fileName);
+}
+
+void DSGen::writeString(std::string& out, const std::string& str)
+{
+	// almost all names are printable ascii and can be written as they are, everything else is escaped by nlohmann
+	// to make sure the output is the exact same as if the whole file was dumped by nlohmann
+	for (const char c : str)
+	{
+		const unsigned char uc = static_cast<unsigned char>(c);
+
+		if (uc < 0x20 || uc >= 0x7F || c == '"' || c == '\\')
+		{
+			out += nlohmann::json(str).dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
+			return;
+		}
+	}
+
+	out += '"';
+	out += str;
+	out += '"';
+}
+
+void DSGen::writeMemberType(std::string& out, const MemberType& memberType)
+{
+	// same layout as MemberType::jsonify: [typeName, shortType, extendedType, [subTypes...]]
+	out += '[';
+	writeString(out, memberType.typeName);
+	out += ',';
+	writeString(out, getTypeShort(memberType.type));
+	out += ',';
+	writeString(out, memberType.extendedType);
+	out += ",[";
+
+	for (size_t i = 0; i < memberType.subTypes.size(); i++)
+	{
+		if (i > 0)
+			out += ',';
+
+		writeMemberType(out, memberType.subTypes[i]);
+	}
+
+	out += "]]";
+}
+
+void DSGen::setDirectory(const std::filesystem::path& directory, bool compress)
 {
 	DSGen::directory = directory;
+	DSGen::compressOutput = compress;
 
 	dumpTimeStamp = std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+	auto openFile = [](FileWriter& writer, const std::string& fileName)
+	{
+		writer.open(getFilePath(fileName), compressOutput);
+
+		// "data" is the first key, as nlohmann sorts keys alphabetically
+		writer.write("{\"data\":[");
+	};
+
+	openFile(classes, "ClassesInfo.json");
+	openFile(functions, "FunctionsInfo.json");
+	openFile(structs, "StructsInfo.json");
+	openFile(enums, "EnumsInfo.json");
 }
 
 void DSGen::addOffset(const std::string& name, uintptr_t offset)
@@ -107,111 +293,213 @@ void DSGen::createFunction(ClassHolder& owningClass, const std::string& function
 	owningClass.functions.push_back(f);
 }
 
-void DSGen::bakeStructOrClass(ClassHolder& classHolder)
+void DSGen::serializeStructOrClass(const ClassHolder& classHolder, std::string& out)
 {
-	nlohmann::json jClass;
-
-	nlohmann::json membersArray = nlohmann::json::array();
+	// {"className":[{"__InheritInfo":[...]},{"__MDKClassSize":size},{"memberName":[memberType,offset,size,arrayDim(,bitOffset)]},...]}
+	out += '{';
+	writeString(out, classHolder.className);
+	out += ":[{\"__InheritInfo\":[";
 
-	nlohmann::json inheritInfo = nlohmann::json::array();
-	for (auto super : classHolder.interitedTypes)
-		inheritInfo.push_back(super);
+	for (size_t i = 0; i < classHolder.interitedTypes.size(); i++)
+	{
+		if (i > 0)
+			out += ',';
 
-	nlohmann::json InheritInfo;
-	InheritInfo["__InheritInfo"] = inheritInfo;
-	membersArray.push_back(InheritInfo);
+		writeString(out, classHolder.interitedTypes[i]);
+	}
 
-	nlohmann::json gSize;
-	gSize["__MDKClassSize"] = classHolder.classSize;
-	membersArray.push_back(gSize);
+	out += "]},{\"__MDKClassSize\":";
+	out += std::to_string(classHolder.classSize);
+	out += '}';
 
-	for(auto& member : classHolder.members)
+	for (const auto& member : classHolder.members)
 	{
-		nlohmann::json jmember;
-
+		out += ",{";
+		writeString(out, member.memberName);
+		out += ":[";
+		writeMemberType(out, member.memberType);
+		out += ',';
+		out += std::to_string(member.offset);
+		out += ',';
+		out += std::to_string(member.size);
+		out += ',';
+		out += std::to_string(member.arrayDim);
 
 		if (member.bitOffset > -1)
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim, member.bitOffset);
-		else
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim);
-		membersArray.push_back(jmember);
+		{
+			out += ',';
+			out += std::to_string(member.bitOffset);
+		}
+
+		out += "]}";
 	}
-	nlohmann::json j;
 
-	j[classHolder.className] = membersArray;
+	out += "]}";
+}
 
-	if (classHolder.classType == ET_Class)
-		classes.push_back(j);
-	else
-		structs.push_back(j);
+void DSGen::serializeFunctions(const ClassHolder& classHolder, std::string& out)
+{
+	// {"className":[{"functionName":[returnType,[[paramType,"&",paramName],...],functionOffset,"functionFlags"]},...]}
+	out += '{';
+	writeString(out, classHolder.className);
+	out += ":[";
 
-	if(!classHolder.functions.empty())
+	for (size_t i = 0; i < classHolder.functions.size(); i++)
 	{
-		nlohmann::json classFunctions = nlohmann::json::array();
-		for (auto& func : classHolder.functions)
+		const FunctionHolder& func = classHolder.functions[i];
+
+		if (i > 0)
+			out += ',';
+
+		out += '{';
+		writeString(out, func.functionName);
+		out += ":[";
+		writeMemberType(out, func.returnType);
+		out += ",[";
+
+		for (size_t j = 0; j < func.functionParams.size(); j++)
 		{
-			nlohmann::json functionParams = nlohmann::json::array();
+			const auto& param = func.functionParams[j];
 
-			for (const auto& param : func.functionParams)
-				functionParams.push_back(std::make_tuple(param.first.jsonify(), param.first.reference ? "&" : "", param.second));
+			if (j > 0)
+				out += ',';
 
-			nlohmann::json j1;
-			j1[func.functionName] = std::make_tuple(func.returnType.jsonify(), functionParams, func.functionOffset, func.functionFlags);
-			classFunctions.push_back(j1);
+			out += '[';
+			writeMemberType(out, param.first);
+			out += param.first.reference ? ",\"&\"," : ",\"\",";
+			writeString(out, param.second);
+			out += ']';
 		}
-		nlohmann::json f;
 
-		f[classHolder.className] = classFunctions;
+		out += "],";
+		out += std::to_string(func.functionOffset);
+		out += ',';
+		writeString(out, func.functionFlags);
+		out += "]}";
+	}
+
+	out += "]}";
+}
+
+void DSGen::serializeEnum(const EnumHolder& enumHolder, std::string& out)
+{
+	// {"enumName":[[{"memberName":value},...],"enumType"]}
+	out += '{';
+	writeString(out, enumHolder.enumName);
+	out += ":[[";
 
-		functions.push_back(f);
+	for (size_t i = 0; i < enumHolder.enumMembers.size(); i++)
+	{
+		if (i > 0)
+			out += ',';
+
+		out += '{';
+		writeString(out, enumHolder.enumMembers[i].first);
+		out += ':';
+		out += std::to_string(enumHolder.enumMembers[i].second);
+		out += '}';
 	}
 
+	out += "],";
+	writeString(out, enumHolder.enumType);
+	out += "]}";
+}
+
+void DSGen::bakeStructOrClass(ClassHolder& classHolder)
+{
+	FileWriter& writer = classHolder.classType == ET_Class ? classes : structs;
+
+	serializeStructOrClass(classHolder, writer.beginElement());
+	writer.endElement();
+
+	if (classHolder.functions.empty())
+		return;
+
+	serializeFunctions(classHolder, functions.beginElement());
+	functions.endElement();
+}
+
+void DSGen::bakeStructOrClass(ClassHolder& classHolder, BakedFragment& fragment)
+{
+	std::string& out = classHolder.classType == ET_Class ? fragment.classes : fragment.structs;
+
+	if (!out.empty())
+		out += ',';
+
+	serializeStructOrClass(classHolder, out);
+
+	if (classHolder.functions.empty())
+		return;
+
+	if (!fragment.functions.empty())
+		fragment.functions += ',';
+
+	serializeFunctions(classHolder, fragment.functions);
 }
 
 void DSGen::bakeEnum(EnumHolder& enumHolder)
 {
-	nlohmann::json members = nlohmann::json::array();
-	for(const auto& member : enumHolder.enumMembers)
+	serializeEnum(enumHolder, enums.beginElement());
+	enums.endElement();
+}
+
+void DSGen::bakeEnum(EnumHolder& enumHolder, BakedFragment& fragment)
+{
+	if (!fragment.enums.empty())
+		fragment.enums += ',';
+
+	serializeEnum(enumHolder, fragment.enums);
+}
+
+void DSGen::mergeFragment(const BakedFragment& fragment)
+{
+	auto mergeInto = [](FileWriter& writer, const std::string& elements)
 	{
-		nlohmann::json m;
-		m[member.first] = member.second;
-		members.push_back(m);
-	}
-	nlohmann::json j;
-	j[enumHolder.enumName] = std::make_tuple(members, enumHolder.enumType);
-	enums.push_back(j);
+		if (elements.empty())
+			return;
+
+		writer.beginElement() += elements;
+		writer.endElement();
+	};
+
+	mergeInto(classes, fragment.classes);
+	mergeInto(structs, fragment.structs);
+	mergeInto(functions, fragment.functions);
+	mergeInto(enums, fragment.enums);
 }
 
-void DSGen::dump()
+bool DSGen::dump()
 {
 	if (directory.empty())
 		throw std::exception("Please initialize a directory first!");
 
-	constexpr auto version = 10202;
+	// the remaining keys following "data", in alphabetical order
+	std::string footer = "],\"updated_at\":";
+	writeString(footer, dumpTimeStamp);
+	footer += ",\"version\":" + std::to_string(dumpspaceVersion) + "}";
+
+	bool hasWrittenAll = true;
 
-	auto saveToDisk = [&](const nlohmann::json& json, const std::string& fileName, bool offsetFile = false)
+	for (FileWriter* writer : { &classes, &functions, &structs, &enums })
 	{
-		nlohmann::json j;
-		j["updated_at"] = dumpTimeStamp;
-		j["data"] = json;
-		j["version"] = version;
-
-		if(offsetFile){
-			nlohmann::json credit;
-			credit["dumper_used"] = "Dumper-7";
-			credit["dumper_link"] = "https://github.com/Encryqed/Dumper-7";
-			j["credit"] = credit;
-		}
+		writer->write(footer);
+		hasWrittenAll = writer->close() && hasWrittenAll;
+	}
 
-		std::ofstream file(directory / fileName);
-		file << j.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
-	};
+	// the offsets are few enough to still be dumped as a whole
+	nlohmann::json j;
+	j["updated_at"] = dumpTimeStamp;
+	j["data"] = nlohmann::json(offsets);
+	j["version"] = dumpspaceVersion;
 
-	saveToDisk(nlohmann::json(nlohmann::json(offsets)), "OffsetsInfo.json", true);
-	saveToDisk(nlohmann::json(classes), "ClassesInfo.json");
-	saveToDisk(nlohmann::json(functions), "FunctionsInfo.json");
-	saveToDisk(nlohmann::json(structs), "StructsInfo.json");
-	saveToDisk(nlohmann::json(enums), "EnumsInfo.json");
+	nlohmann::json credit;
+	credit["dumper_used"] = "Dumper-7";
+	credit["dumper_link"] = "https://github.com/Encryqed/Dumper-7";
+	j["credit"] = credit;
 
+	FileWriter offsetsFile;
+	offsetsFile.open(getFilePath("OffsetsInfo.json"), compressOutput);
+	offsetsFile.write(j.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace));
 
+	return offsetsFile.close() && hasWrittenAll;
 }
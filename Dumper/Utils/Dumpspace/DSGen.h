@@ -1,9 +1,12 @@
 #pragma once
 
 #include <string>
+#include <fstream>
 #include <filesystem>
 #include "../Json/json.hpp"
 
+struct ZSTD_CCtx_s;
+
 class DSGen
 {
 public:
@@ -118,29 +121,95 @@ public:
 		std::vector<std::pair<std::string, int>> enumMembers; //enum members, their name and representative number (abc = 5)
 	};
 
+	// BakedFragment holds the serialized classes, structs, functions and enums of a part of the dump, e.g a single package.
+	// Fragments can be baked into from any thread and are written to the files with mergeFragment, in whichever order the caller merges them.
+	struct BakedFragment
+	{
+		std::string classes; // comma seperated elements of the "data" array of ClassesInfo.json
+		std::string structs; // comma seperated elements of the "data" array of StructsInfo.json
+		std::string functions; // comma seperated elements of the "data" array of FunctionsInfo.json
+		std::string enums; // comma seperated elements of the "data" array of EnumsInfo.json
+	};
+
+
+
+private:
+	// Buffered output for a single dumpspace file. Baked classes, structs, functions and enums are serialized straight into the file,
+	// so the memory usage stays the same no matter how many types a game has. Optionally compresses the output with zstd.
+	class FileWriter
+	{
+	private:
+		// Size at which the buffer is written to the file
+		static constexpr size_t flushThreshold = 0x100000;
+
+		std::ofstream file;
+		std::string buffer;
+		std::string compressedBuffer;
+		ZSTD_CCtx_s* compressionContext = nullptr;
+		bool isFirstElement = true;
 
+		// set if the file couldn't be opened, written or compressed, the file is incomplete then
+		bool hasFailed = false;
+
+	public:
+		FileWriter();
+		~FileWriter();
+
+		FileWriter(const FileWriter&) = delete;
+		FileWriter& operator=(const FileWriter&) = delete;
+
+	private:
+		void flush(bool isFinal);
+
+	public:
+		void open(const std::filesystem::path& path, bool compress);
+		bool isOpen() const;
+
+		// returns the buffer to serialize a new element of the "data" array into, with the seperating ',' already written
+		std::string& beginElement();
+		void endElement();
+
+		void write(const std::string& str);
+
+		// returns false if the file couldn't be written completely
+		bool close();
+	};
 
 private:
 	static inline std::string dumpTimeStamp{};
 
 	static inline std::filesystem::path directory{};
 
+	static inline bool compressOutput = false;
+
 	static inline std::vector<std::tuple<std::string, uintptr_t>> offsets{};
 
-	static inline nlohmann::json classes = nlohmann::json::array();
-	static inline nlohmann::json structs = nlohmann::json::array();
-	static inline nlohmann::json functions = nlohmann::json::array();
-	static inline nlohmann::json enums = nlohmann::json::array();
+	static inline FileWriter classes;
+	static inline FileWriter structs;
+	static inline FileWriter functions;
+	static inline FileWriter enums;
+
+private:
+	static std::filesystem::path getFilePath(const std::string& fileName);
+
+	static void writeString(std::string& out, const std::string& str);
+	static void writeMemberType(std::string& out, const MemberType& memberType);
+
+	static void serializeStructOrClass(const ClassHolder& classHolder, std::string& out);
+	static void serializeFunctions(const ClassHolder& classHolder, std::string& out);
+	static void serializeEnum(const EnumHolder& enumHolder, std::string& out);
 
 public:
 	//redundant constructor
 	DSGen();
 
 	/**
-	 * \brief sets the directory path. The dumpspace files will be under directory/dumpspace
+	 * \brief sets the directory path and opens the dumpspace files. The dumpspace files will be under directory/dumpspace.
+	 * Must be called before anything is baked.
 	 * \param directory valid directory
+	 * \param compress whether the files should be zstd compressed, the files will then end in .json.zst
 	 */
-	static void setDirectory(const std::filesystem::path& directory);
+	static void setDirectory(const std::filesystem::path& directory, bool compress = false);
 
 	/**
 	 * \brief 
@@ -259,20 +328,41 @@ public:
 	);
 
 	/**
-	 * \brief bakes a ClassHolder which gets later dumped
+	 * \brief bakes a ClassHolder, writing it to the classes or structs file and its functions to the functions file
 	 * \param classHolder the classHolder that should get baked
 	 */
 	static void bakeStructOrClass(ClassHolder& classHolder);
 
 	/**
-	 * \brief bakes a EnumHolder which gets later dumped
+	 * \brief bakes a EnumHolder, writing it to the enums file
 	 * \param enumHolder the enumHolder that should get baked
 	 */
 	static void bakeEnum(EnumHolder& enumHolder);
 
+	/**
+	 * \brief bakes a ClassHolder into a fragment instead of the files. Fragments can be baked into from any thread.
+	 * \param classHolder the classHolder that should get baked
+	 * \param fragment the fragment the classHolder is appended to
+	 */
+	static void bakeStructOrClass(ClassHolder& classHolder, BakedFragment& fragment);
+
+	/**
+	 * \brief bakes a EnumHolder into a fragment instead of the files. Fragments can be baked into from any thread.
+	 * \param enumHolder the enumHolder that should get baked
+	 * \param fragment the fragment the enumHolder is appended to
+	 */
+	static void bakeEnum(EnumHolder& enumHolder, BakedFragment& fragment);
+
+	/**
+	 * \brief writes everything baked into a fragment to the files, as if it was baked directly. Must not be called from multiple threads at once.
+	 * \param fragment the fragment that should get written
+	 */
+	static void mergeFragment(const BakedFragment& fragment);
+
 
 	/**
-	 * \brief dumps all baked information to disk. This should be the final step
+	 * \brief dumps the offsets and finishes all files that were baked into. This should be the final step
+	 * \return false if any of the files couldn't be written completely
 	 */
-	static void dump();
+	static bool dump();
 };
\ No newline at end of file
@@ -11,8 +11,14 @@
 
 using UnicodeCharRange = std::pair<char32_t, char32_t>;
 
-template<uint32_t Size>
-class UnicodeRangeTable
+/*
+* Two-level lookup table for sets of unicode characters, replacing a binary search over the ranges with two array accesses.
+* 
+* The unicode range is split into blocks of 0x100 characters. Each block is either entirely outside of the set, entirely inside of it, or
+* refers to a bitmap with one bit per character of the block. Only blocks partially covered by the ranges need a bitmap, which keeps the table small.
+*/
+template<uint32_t NumPartialBlocks>
+class UnicodeLookupTable
 {
 public:
     /* Accessor functions to guarantee XID_Continue checks also check XID_Start, as ranges already contained by XID_Start aren't dumplicated into XID_Continue. */
@@ -20,23 +26,105 @@ public:
     friend constexpr bool IsUnicodeCharXIDContinue(char32_t Character);
     friend constexpr bool IsUnicodeCharXIDContinueWithoutXIDStart(char32_t Character);
 
+public:
+    static constexpr uint32_t BlockSize = 0x100;
+    static constexpr uint32_t NumBlocks = 0x110000 / BlockSize;
+
+private:
+    static constexpr uint16_t EmptyBlock = 0xFFFF;
+    static constexpr uint16_t FullBlock = 0xFFFE;
+
+    static_assert(NumPartialBlocks < FullBlock, "Too many partial blocks to be indexed with a uint16_t!");
 
 private:
-    std::array<UnicodeCharRange, Size> CharRanges;
+    /* Per block: 'EmptyBlock', 'FullBlock', or the index of the blocks' bitmap in 'BlockBitmaps' */
+    std::array<uint16_t, NumBlocks> BlockIndices = {};
+
+    /* 256 bits per partially covered block */
+    std::array<std::array<uint64_t, BlockSize / 64>, NumPartialBlocks> BlockBitmaps = {};
 
 public:
-    consteval UnicodeRangeTable(const UnicodeCharRange(&Ranges)[Size])
+    template<uint32_t Size>
+    consteval UnicodeLookupTable(const UnicodeCharRange(&Ranges)[Size])
+    {
+        BlockIndices.fill(EmptyBlock);
+
+        uint16_t NumUsedBitmaps = 0;
+
+        for (const UnicodeCharRange& Range : Ranges)
+        {
+            for (uint32_t Block = Range.first / BlockSize; Block <= Range.second / BlockSize; Block++)
+            {
+                const uint32_t BlockStart = Block * BlockSize;
+                const uint32_t BlockEnd = BlockStart + BlockSize - 1;
+
+                const uint32_t First = std::max<uint32_t>(Range.first, BlockStart);
+                const uint32_t Last = std::min<uint32_t>(Range.second, BlockEnd);
+
+                if (First == BlockStart && Last == BlockEnd)
+                {
+                    BlockIndices[Block] = FullBlock;
+                    continue;
+                }
+
+                if (BlockIndices[Block] == EmptyBlock)
+                    BlockIndices[Block] = NumUsedBitmaps++;
+
+                std::array<uint64_t, BlockSize / 64>& Bitmap = BlockBitmaps[BlockIndices[Block]];
+
+                /* Set the bits word by word, keeps the number of steps for constant evaluation low */
+                for (uint32_t Word = (First - BlockStart) / 64; Word <= (Last - BlockStart) / 64; Word++)
+                {
+                    const uint32_t FirstBit = std::max<uint32_t>(First - BlockStart, Word * 64) % 64;
+                    const uint32_t LastBit = std::min<uint32_t>(Last - BlockStart, (Word * 64) + 63) % 64;
+
+                    const uint64_t Mask = (LastBit - FirstBit) == 63 ? ~0ull : (((1ull << (LastBit - FirstBit + 1)) - 1) << FirstBit);
+
+                    Bitmap[Word] |= Mask;
+                }
+            }
+        }
+    }
+
+    /* Number of blocks, which are only partially covered by any of the ranges, and therefore need a bitmap */
+    template<uint32_t Size>
+    static consteval uint32_t CountPartialBlocks(const UnicodeCharRange(&Ranges)[Size])
     {
-        std::copy_n(Ranges, Size, std::begin(CharRanges));
+        std::array<bool, NumBlocks> IsPartialBlock = {};
+
+        for (const UnicodeCharRange& Range : Ranges)
+        {
+            const uint32_t FirstBlock = Range.first / BlockSize;
+            const uint32_t LastBlock = Range.second / BlockSize;
+
+            if ((Range.first % BlockSize) != 0 || (FirstBlock == LastBlock && (Range.second % BlockSize) != (BlockSize - 1)))
+                IsPartialBlock[FirstBlock] = true;
+
+            if ((Range.second % BlockSize) != (BlockSize - 1))
+                IsPartialBlock[LastBlock] = true;
+        }
+
+        return static_cast<uint32_t>(std::count(std::begin(IsPartialBlock), std::end(IsPartialBlock), true));
     }
 
     /* Restrict access to this function to friend functions to guarantee checks for XID_Continue also check XID_Start */
 private:
     constexpr bool Contains(char32_t Character) const
     {
-        auto UnicodeRangeCompareLess = [](const UnicodeCharRange& L, const UnicodeCharRange& R) { return L.second < R.first; };
+        if (Character >= (NumBlocks * BlockSize))
+            return false;
 
-        return std::binary_search(std::begin(CharRanges), std::end(CharRanges), UnicodeCharRange{ Character, Character }, UnicodeRangeCompareLess);
+        const uint16_t BlockIndex = BlockIndices[Character / BlockSize];
+
+        if (BlockIndex == EmptyBlock)
+            return false;
+
+        if (BlockIndex == FullBlock)
+            return true;
+
+        const uint32_t Bit = Character % BlockSize;
+
+        return (BlockBitmaps[BlockIndex][Bit / 64] >> (Bit % 64)) & 0x1;
     }
 };
 
@@ -401,9 +489,9 @@ constexpr UnicodeCharRange XIDContinueRangesData[] = {
     { 0x1E950, 0x1E959 }, { 0x1FBF0, 0x1FBF9 }, { 0xE0100, 0xE01EF },
 };
 
-// Create objects with automatic size calculation
-constexpr UnicodeRangeTable XIDStartRanges(XIDStartRangesData);
-constexpr UnicodeRangeTable XIDContinueRanges(XIDContinueRangesData);
+// Create lookup-tables with automatic size calculation
+constexpr UnicodeLookupTable<UnicodeLookupTable<0>::CountPartialBlocks(XIDStartRangesData)> XIDStartRanges(XIDStartRangesData);
+constexpr UnicodeLookupTable<UnicodeLookupTable<0>::CountPartialBlocks(XIDContinueRangesData)> XIDContinueRanges(XIDContinueRangesData);
 
 /* Checks a character for the XID_Start property. XID_Start -> valid start character for a C++ name. */
 constexpr inline bool IsUnicodeCharXIDStart(char32_t Character)
@@ -422,3 +510,13 @@ constexpr bool IsUnicodeCharXIDContinueWithoutXIDStart(char32_t Character)
     return XIDContinueRanges.Contains(Character);
 }
 
+/* Lookup-table for the ASCII range. Names consisting of only ASCII characters can be checked without converting them to UTF-32 first. */
+constexpr std::array<bool, 0x80> AsciiXIDContinueTable = []() consteval
+{
+    std::array<bool, 0x80> Table = {};
+
+    for (char32_t Character = 0; Character < 0x80; Character++)
+        Table[Character] = IsUnicodeCharXIDContinue(Character);
+
+    return Table;
+}();
@@ -0,0 +1,145 @@
+
+#include <fstream>
+#include <iostream>
+
+#include <Windows.h>
+#include <Psapi.h>
+
+#include "Stats/DumpStats.h"
+#include "Json/json.hpp"
+
+#include "../Settings.h"
+
+
+DumpStats::ScopedPhase::ScopedPhase(const std::string& Name)
+	: PhaseIndex(Phases.size())
+	, PrivateBytesAtStart(0)
+{
+	if constexpr (!Settings::Debug::bWriteDumpStats)
+		return;
+
+	PrivateBytesAtStart = GetPrivateBytes();
+
+	/* Reserve the slot on construction, so phases are ordered by their start and nested phases follow their parent */
+	Phases.push_back({ Name, CurrentDepth, 0.0, 0 });
+	CurrentDepth++;
+
+	StartTime = std::chrono::high_resolution_clock::now();
+}
+
+DumpStats::ScopedPhase::~ScopedPhase()
+{
+	if constexpr (!Settings::Debug::bWriteDumpStats)
+		return;
+
+	std::chrono::duration<double, std::milli> Duration = std::chrono::high_resolution_clock::now() - StartTime;
+
+	PhaseInfo& Phase = Phases[PhaseIndex];
+	Phase.Milliseconds = Duration.count();
+	Phase.PrivateBytesDelta = static_cast<int64_t>(GetPrivateBytes()) - static_cast<int64_t>(PrivateBytesAtStart);
+
+	CurrentDepth--;
+}
+
+uint64_t DumpStats::GetPrivateBytes()
+{
+	PROCESS_MEMORY_COUNTERS_EX MemoryCounters;
+
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&MemoryCounters), sizeof(MemoryCounters)))
+		return 0;
+
+	return MemoryCounters.PrivateUsage;
+}
+
+const char* DumpStats::GetCounterName(ECounter Counter)
+{
+	switch (Counter)
+	{
+	case ECounter::ObjectsVisited:
+		return "ObjectsVisited";
+	case ECounter::FNameToStringCalls:
+		return "FNameToStringCalls";
+	case ECounter::BadReadPtrProbes:
+		return "BadReadPtrProbes";
+	case ECounter::HashStringTableLookups:
+		return "HashStringTableLookups";
+	case ECounter::HashStringTableProbes:
+		return "HashStringTableProbes";
+	default:
+		return "Unknown";
+	}
+}
+
+void DumpStats::WriteToFile(const fs::path& Folder)
+{
+	nlohmann::json Stats;
+
+	Stats["GameName"] = Settings::Generator::GameName;
+	Stats["GameVersion"] = Settings::Generator::GameVersion;
+
+	double TotalMilliseconds = 0.0;
+	nlohmann::json PhaseArray = nlohmann::json::array();
+
+	for (const PhaseInfo& Phase : Phases)
+	{
+		if (Phase.Depth == 0)
+			TotalMilliseconds += Phase.Milliseconds;
+
+		PhaseArray.push_back({
+			{ "Name", Phase.Name },
+			{ "Depth", Phase.Depth },
+			{ "Milliseconds", Phase.Milliseconds },
+			{ "PrivateBytesDelta", Phase.PrivateBytesDelta },
+		});
+	}
+
+	Stats["Phases"] = std::move(PhaseArray);
+	Stats["TotalMilliseconds"] = TotalMilliseconds;
+
+	for (size_t i = 0; i < static_cast<size_t>(ECounter::Num); i++)
+		Stats["Counters"][GetCounterName(static_cast<ECounter>(i))] = Counters[i].load(std::memory_order_relaxed);
+
+	const uint64_t NumLookups = Counters[static_cast<size_t>(ECounter::HashStringTableLookups)].load(std::memory_order_relaxed);
+	const uint64_t NumProbes = Counters[static_cast<size_t>(ECounter::HashStringTableProbes)].load(std::memory_order_relaxed);
+	Stats["Counters"]["HashStringTableAverageProbeLength"] = NumLookups != 0 ? static_cast<double>(NumProbes) / NumLookups : 0.0;
+
+	/* Process-wide values, they include the memory used by the game itself */
+	PROCESS_MEMORY_COUNTERS_EX MemoryCounters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&MemoryCounters), sizeof(MemoryCounters)))
+	{
+		Stats["Memory"]["PeakWorkingSetBytes"] = static_cast<uint64_t>(MemoryCounters.PeakWorkingSetSize);
+		Stats["Memory"]["PeakPrivateBytes"] = static_cast<uint64_t>(MemoryCounters.PeakPagefileUsage);
+		Stats["Memory"]["PrivateBytes"] = static_cast<uint64_t>(MemoryCounters.PrivateUsage);
+	}
+
+	uint64_t BytesWritten = 0;
+	uint64_t FilesWritten = 0;
+
+	std::error_code Error;
+	for (const fs::directory_entry& Entry : fs::recursive_directory_iterator(Folder, Error))
+	{
+		if (!Entry.is_regular_file(Error) || Entry.path().filename() == "DumpStats.json")
+			continue;
+
+		const uintmax_t FileSize = Entry.file_size(Error);
+
+		if (Error)
+			continue;
+
+		BytesWritten += FileSize;
+		FilesWritten++;
+	}
+
+	Stats["Output"]["BytesWritten"] = BytesWritten;
+	Stats["Output"]["FilesWritten"] = FilesWritten;
+
+	std::ofstream StatsFile(Folder / "DumpStats.json");
+
+	if (!StatsFile.is_open())
+	{
+		std::cout << "\nDumper-7: Failed to write 'DumpStats.json'!\n" << std::endl;
+		return;
+	}
+
+	StatsFile << Stats.dump(4);
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "../Settings.h"
+
+
+namespace fs = std::filesystem;
+
+/*
+* Lightweight instrumentation of a dump, written to "DumpStats.json" next to "GObjects-Dump.txt".
+*
+* Phases are measured on the main-thread and may be nested, counters may be incremented from any thread.
+* Both compile to nothing unless 'Settings::Debug::bWriteDumpStats' is enabled.
+*/
+class DumpStats
+{
+public:
+	enum class ECounter : uint8_t
+	{
+		ObjectsVisited,
+		FNameToStringCalls,
+		BadReadPtrProbes,
+		HashStringTableLookups,
+		HashStringTableProbes,
+
+		Num
+	};
+
+private:
+	struct PhaseInfo
+	{
+		std::string Name;
+		int32_t Depth;
+		double Milliseconds;
+
+		/* Change of the private bytes of the process during this phase, includes allocations made by the game */
+		int64_t PrivateBytesDelta;
+	};
+
+public:
+	class ScopedPhase
+	{
+	private:
+		size_t PhaseIndex;
+		uint64_t PrivateBytesAtStart;
+		std::chrono::high_resolution_clock::time_point StartTime;
+
+	public:
+		explicit ScopedPhase(const std::string& Name);
+		~ScopedPhase();
+
+		ScopedPhase(const ScopedPhase&) = delete;
+		ScopedPhase& operator=(const ScopedPhase&) = delete;
+	};
+
+private:
+	static inline std::vector<PhaseInfo> Phases;
+	static inline int32_t CurrentDepth = 0;
+
+	static inline std::atomic<uint64_t> Counters[static_cast<size_t>(ECounter::Num)] = {};
+
+private:
+	static uint64_t GetPrivateBytes();
+
+	static const char* GetCounterName(ECounter Counter);
+
+public:
+	static inline void Increment(ECounter Counter, uint64_t Amount = 1)
+	{
+		if constexpr (Settings::Debug::bWriteDumpStats)
+			Counters[static_cast<size_t>(Counter)].fetch_add(Amount, std::memory_order_relaxed);
+	}
+
+	template<typename CallbackType>
+	static inline void MeasurePhase(const std::string& Name, CallbackType&& Callback)
+	{
+		if constexpr (Settings::Debug::bWriteDumpStats)
+		{
+			ScopedPhase Phase(Name);
+			Callback();
+		}
+		else
+		{
+			Callback();
+		}
+	}
+
+	/* Writes "DumpStats.json" to 'Folder'. Sizes of all files within 'Folder' are summed up as the number of bytes written by the generators */
+	static void WriteToFile(const fs::path& Folder);
+};
@@ -6,6 +6,13 @@
 #include <string>
 #include <algorithm>
 #include <functional>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+
+#include "Stats/DumpStats.h"
 
 
 /* Credits: https://en.cppreference.com/w/cpp/string/byte/tolower */
@@ -311,6 +318,8 @@ inline bool IsInProcessRange(const void* Address)
 }
 inline bool IsBadReadPtr(const void* Ptr)
 {
+	DumpStats::Increment(DumpStats::ECounter::BadReadPtrProbes);
+
 	if(!IsValidVirtualAddress(reinterpret_cast<const uintptr_t>(Ptr)))
 		return true;
 
@@ -635,6 +644,66 @@ inline T* FindAlignedValueInProcess(T Value, const std::string& Sectionname = ".
 	return Result;
 }
 
+/*
+* Index of all pointer-aligned values within a section of the image that point outside of the image, eg. to heap-allocated objects.
+* 
+* Built in a single pass over the section. Finding "which global points to this object" is a hash-lookup, instead of a scan of the whole section.
+* Unlike FindAlignedValueInProcess a miss doesn't search the whole image, build a second index with 'bIndexAllSections' for that.
+*/
+class GlobalPointerIndex
+{
+private:
+	/* Pointer -> lowest address, within the section, at which the pointer is stored */
+	std::unordered_map<uintptr_t, uintptr_t> PointerToAddress;
+
+public:
+	inline GlobalPointerIndex(const std::string& SectionName = ".data", bool bIndexAllSections = false)
+	{
+		const auto [ImageBase, ImageSize] = GetImageBaseAndSize();
+
+		auto [SearchStart, SearchRange] = !bIndexAllSections ? GetSectionByName(ImageBase, SectionName) : std::pair<uintptr_t, DWORD>{ 0x0, 0x0 };
+
+		/* The whole image is indexed if requested, or if the image has no section with this name */
+		if (SearchStart == 0x0 || SearchRange == 0x0)
+		{
+			SearchStart = ImageBase;
+			SearchRange = static_cast<DWORD>(ImageSize);
+		}
+
+		/* Most values within the image are either null, or point to the image itself */
+		PointerToAddress.reserve(SearchRange / (sizeof(void*) * 0x10));
+
+		for (uintptr_t Offset = 0x0; (Offset + sizeof(void*)) <= SearchRange; Offset += sizeof(void*))
+		{
+			const uintptr_t Address = SearchStart + Offset;
+			const uintptr_t Value = *reinterpret_cast<const uintptr_t*>(Address);
+
+			if (Value == 0x0 || (Value & (sizeof(void*) - 1)) != 0x0 || !IsValidVirtualAddress(Value))
+				continue;
+
+			if (Value >= ImageBase && Value < (ImageBase + ImageSize))
+				continue;
+
+			/* Only keeps the first occurence, like a linear search would */
+			PointerToAddress.try_emplace(Value, Address);
+		}
+	}
+
+public:
+	inline size_t Num() const
+	{
+		return PointerToAddress.size();
+	}
+
+	/* Returns the address within the section at which 'Pointer' is stored, nullptr if there is none */
+	inline void* FindAddressOf(const void* Pointer) const
+	{
+		auto It = PointerToAddress.find(reinterpret_cast<uintptr_t>(Pointer));
+
+		return It != PointerToAddress.end() ? reinterpret_cast<void*>(It->second) : nullptr;
+	}
+};
+
 template<bool bShouldResolve32BitJumps = true>
 inline std::pair<const void*, int32_t> IterateVTableFunctions(void** VTable, const std::function<bool(const uint8_t* Addr, int32_t Index)>& CallBackForEachFunc, int32_t NumFunctions = 0x150, int32_t OffsetFromStart = 0x0)
 {
@@ -1085,3 +1154,190 @@ namespace FileNameHelper
 		}
 	}
 }
+
+namespace ParallelHelper
+{
+	/*
+	* Calls 'Generate(Index)' for every Index in [0, NumTasks) on multiple worker threads. 'Consume(Index)' is called on the calling thread, in ascending
+	* order of Index, as soon as the task at that index is done. This allows for parallel generation with output that doesn't depend on the timing of threads.
+	*
+	* At most 'MaxNumPendingTasks' tasks are done without being consumed, after which workers wait for 'Consume' to catch up. This limits memory usage.
+	*/
+	template<typename GenerateFuncType, typename ConsumeFuncType>
+	inline void GenerateInOrder(int32_t NumTasks, GenerateFuncType&& Generate, ConsumeFuncType&& Consume, int32_t MaxNumPendingTasks = 0x40)
+	{
+		const int32_t NumThreads = std::clamp(static_cast<int32_t>(std::thread::hardware_concurrency()), 1, std::max(NumTasks, 1));
+
+		std::vector<uint8_t> TasksDone(NumTasks, false);
+
+		std::mutex TaskMutex;
+		std::condition_variable TaskCondition;
+
+		std::atomic<int32_t> NextTaskIdx = 0;
+		int32_t NumConsumedTasks = 0;
+
+		auto Worker = [&]() -> void
+		{
+			for (int32_t TaskIdx = NextTaskIdx++; TaskIdx < NumTasks; TaskIdx = NextTaskIdx++)
+			{
+				{
+					std::unique_lock Lock(TaskMutex);
+					TaskCondition.wait(Lock, [&]() { return TaskIdx < (NumConsumedTasks + MaxNumPendingTasks); });
+				}
+
+				Generate(TaskIdx);
+
+				{
+					std::scoped_lock Lock(TaskMutex);
+					TasksDone[TaskIdx] = true;
+				}
+
+				TaskCondition.notify_all();
+			}
+		};
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(NumThreads);
+
+		for (int32_t i = 0; i < NumThreads; i++)
+			Workers.emplace_back(Worker);
+
+		for (int32_t TaskIdx = 0; TaskIdx < NumTasks; TaskIdx++)
+		{
+			{
+				std::unique_lock Lock(TaskMutex);
+				TaskCondition.wait(Lock, [&]() { return TasksDone[TaskIdx] != false; });
+			}
+
+			Consume(TaskIdx);
+
+			{
+				std::scoped_lock Lock(TaskMutex);
+				NumConsumedTasks = TaskIdx + 1;
+			}
+
+			TaskCondition.notify_all();
+		}
+
+		for (std::thread& Thread : Workers)
+			Thread.join();
+	}
+
+	struct GraphTask
+	{
+		std::function<void()> Execute;
+
+		/* Indices of tasks that need to be done before this task can run. Must be lower than the index of this task. */
+		std::vector<int32_t> Dependencies;
+	};
+
+	/*
+	* Runs every task on a worker thread as soon as all of its dependencies are done, ready tasks with a lower index are started first.
+	* 'OnTaskDone(Index)' is called on the calling thread, in ascending order of Index, so output doesn't depend on the timing of threads.
+	*
+	* With 'MaxNumThreads == 1' tasks are executed on the calling thread in declaration order, which is a valid order as dependencies always have a lower index.
+	*/
+	template<typename OnTaskDoneFuncType>
+	inline void RunTaskGraph(const std::vector<GraphTask>& Tasks, OnTaskDoneFuncType&& OnTaskDone, int32_t MaxNumThreads = 0)
+	{
+		const int32_t NumTasks = static_cast<int32_t>(Tasks.size());
+
+		if (MaxNumThreads <= 0)
+			MaxNumThreads = static_cast<int32_t>(std::thread::hardware_concurrency());
+
+		const int32_t NumThreads = std::clamp(MaxNumThreads, 1, std::max(NumTasks, 1));
+
+		if (NumThreads == 1)
+		{
+			for (int32_t TaskIdx = 0; TaskIdx < NumTasks; TaskIdx++)
+			{
+				Tasks[TaskIdx].Execute();
+				OnTaskDone(TaskIdx);
+			}
+
+			return;
+		}
+
+		std::vector<int32_t> NumPendingDependencies(NumTasks, 0);
+		std::vector<std::vector<int32_t>> Dependents(NumTasks);
+
+		for (int32_t TaskIdx = 0; TaskIdx < NumTasks; TaskIdx++)
+		{
+			for (const int32_t Dependency : Tasks[TaskIdx].Dependencies)
+			{
+				Dependents[Dependency].push_back(TaskIdx);
+				NumPendingDependencies[TaskIdx]++;
+			}
+		}
+
+		std::vector<uint8_t> TasksDone(NumTasks, false);
+
+		/* Sorted in descending order, so the ready task with the lowest index is at the back */
+		std::vector<int32_t> ReadyTasks;
+
+		for (int32_t TaskIdx = NumTasks - 1; TaskIdx >= 0; TaskIdx--)
+		{
+			if (NumPendingDependencies[TaskIdx] == 0)
+				ReadyTasks.push_back(TaskIdx);
+		}
+
+		std::mutex TaskMutex;
+		std::condition_variable TaskCondition;
+
+		int32_t NumStartedTasks = 0;
+
+		auto Worker = [&]() -> void
+		{
+			while (true)
+			{
+				int32_t TaskIdx = -1;
+
+				{
+					std::unique_lock Lock(TaskMutex);
+					TaskCondition.wait(Lock, [&]() { return !ReadyTasks.empty() || NumStartedTasks == NumTasks; });
+
+					if (ReadyTasks.empty())
+						return;
+
+					TaskIdx = ReadyTasks.back();
+					ReadyTasks.pop_back();
+					NumStartedTasks++;
+				}
+
+				Tasks[TaskIdx].Execute();
+
+				{
+					std::scoped_lock Lock(TaskMutex);
+					TasksDone[TaskIdx] = true;
+
+					for (const int32_t Dependent : Dependents[TaskIdx])
+					{
+						if (--NumPendingDependencies[Dependent] == 0)
+							ReadyTasks.insert(std::upper_bound(ReadyTasks.begin(), ReadyTasks.end(), Dependent, std::greater<int32_t>()), Dependent);
+					}
+				}
+
+				TaskCondition.notify_all();
+			}
+		};
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(NumThreads);
+
+		for (int32_t i = 0; i < NumThreads; i++)
+			Workers.emplace_back(Worker);
+
+		for (int32_t TaskIdx = 0; TaskIdx < NumTasks; TaskIdx++)
+		{
+			{
+				std::unique_lock Lock(TaskMutex);
+				TaskCondition.wait(Lock, [&]() { return TasksDone[TaskIdx] != false; });
+			}
+
+			OnTaskDone(TaskIdx);
+		}
+
+		for (std::thread& Thread : Workers)
+			Thread.join();
+	}
+}
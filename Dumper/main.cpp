@@ -58,6 +58,8 @@ DWORD MainThread(HMODULE Module)
 	Generator::Generate<IDAMappingGenerator>();
 	Generator::Generate<DumpspaceGenerator>();
 
+	if constexpr (Settings::Debug::bWriteDumpStats)
+		Generator::WriteDumpStats();
 
 	auto t_C = std::chrono::high_resolution_clock::now();
 
@@ -68,6 +70,20 @@ DWORD MainThread(HMODULE Module)
 
 	while (true)
 	{
+		if constexpr (Settings::Generator::bStayResident)
+		{
+			if (GetAsyncKeyState(VK_F5) & 1)
+			{
+				auto t_D1 = std::chrono::high_resolution_clock::now();
+
+				Generator::GenerateDelta<CppGenerator>();
+
+				std::chrono::duration<double, std::milli> ms_delta = std::chrono::high_resolution_clock::now() - t_D1;
+
+				std::cout << "\n\nUpdating CppSDK took (" << ms_delta.count() << "ms), Mappings and Dumpspace files were not updated\n\n\n";
+			}
+		}
+
 		if (GetAsyncKeyState(VK_F6) & 1)
 		{
 			fclose(stdout);
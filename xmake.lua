@@ -11,6 +11,7 @@ target("Dumper-7")
     add_includedirs("Dumper/Utils", {public = true})
     add_includedirs("Dumper/Engine/Public", {public = true})
     add_includedirs("Dumper/Generator/Public", {public = true})
+    add_includedirs("Dumper/Platform/Public", {public = true})
 
     add_cxflags("/wd4244", "/wd4267", "/wd4369", "/wd4715")
 